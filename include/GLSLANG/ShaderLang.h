@@ -26,7 +26,7 @@
 
 // Version number for shader translation API.
 // It is incremented every time the API changes.
-#define ANGLE_SH_VERSION 374
+#define ANGLE_SH_VERSION 383
 
 enum ShShaderSpec
 {
@@ -480,10 +480,57 @@ struct ShCompileOptions
     // Whether inactive shader variables from the output.
     uint64_t removeInactiveVariables : 1;
 
+    // Record the time, AST size and pool memory of every pass of the translator, to be queried
+    // with sh::GetPassStatistics().  This adds a walk of the tree after each pass.
+    uint64_t recordPassStatistics : 1;
+
+    // Look the compilation up in a process-wide cache of compilation results, keyed by the
+    // source, the compile options and the built-in resources, and add the results to the cache
+    // if not found.  Compilers with the same parameters then share the results without parsing
+    // the shader again.  Has no effect on HLSL output, or if recordPassStatistics is set.
+    //
+    // Tools that recompile shaders while they're being edited can set this too; switching back
+    // to a previous version of the source then doesn't run the translator.
+    uint64_t memoizeCompileResults : 1;
+
+    // Replace local variables that are never written after their declaration with their constant
+    // or copied initial value, and remove the branches and loops that become unreachable.  This
+    // makes the output smaller for drivers that don't optimize it well.
+    uint64_t optimizeAST : 1;
+
     ShCompileOptionsMetal metal;
     ShPixelLocalStorageOptions pls;
 };
 
+// Statistics of a pass of the translator, recorded if ShCompileOptions::recordPassStatistics is
+// set.  Parsing, the AST transformations and the generation of the output are all recorded as
+// passes, so the sum of the pass times is the time of the compilation.
+struct ShPassStatistics
+{
+    // Name of the pass, or of the passes that run in a single walk of the tree.
+    const char *name;
+    // Wall time spent in the pass.
+    double timeSeconds;
+    // Number of nodes of the AST before and after the pass.
+    size_t nodeCountBefore;
+    size_t nodeCountAfter;
+    // Bytes allocated from the pool allocator by the pass.
+    size_t poolBytesAllocated;
+};
+
+// Statistics of the cache used by compilations with ShCompileOptions::memoizeCompileResults.
+struct ShCompileResultCacheStatistics
+{
+    // Number of compilations whose results were found in the cache, or not found.
+    uint64_t hits;
+    uint64_t misses;
+    // Number of results removed from the cache to stay within its memory budget.
+    uint64_t evictions;
+    // Number of results currently in the cache, and their approximate size in bytes.
+    size_t entryCount;
+    size_t totalBytes;
+};
+
 // The 64 bits hash function. The first parameter is the input string; the
 // second parameter is the string length.
 using ShHashFunction64 = khronos_uint64_t (*)(const char *, size_t);
@@ -890,6 +937,20 @@ const std::vector<ShPixelLocalStorageFormat> *GetPixelLocalStorageFormats(const
 // Returns specialization constant usage bits
 uint32_t GetShaderSpecConstUsageBits(const ShHandle handle);
 
+// Returns the statistics of each pass of the last compilation, in the order they were run.  Only
+// populated if the shader was compiled with ShCompileOptions::recordPassStatistics.
+// Returns NULL on failure.
+// Parameters:
+// handle: Specifies the compiler
+const std::vector<ShPassStatistics> *GetPassStatistics(const ShHandle handle);
+
+// Returns the statistics of the cache of compilation results shared by all compilers in the
+// process.  See ShCompileOptions::memoizeCompileResults.
+ShCompileResultCacheStatistics GetCompileResultCacheStatistics();
+
+// Removes all results from the cache of compilation results and resets its statistics.
+void ClearCompileResultCache();
+
 // Returns true if the passed in variables pack in maxVectors followingthe packing rules from the
 // GLSL 1.017 spec, Appendix A, section 7.
 // Returns false otherwise. Also look at the enforcePackingRestrictions flag above.
@@ -1196,6 +1196,24 @@ struct FeaturesVk : FeatureSetBase
         &members,
     };
 
+    FeatureInfo enableParallelClientAttribStreaming = {
+        "enableParallelClientAttribStreaming",
+        FeatureCategory::VulkanFeatures,
+        &members,
+    };
+
+    FeatureInfo coalesceConsecutiveIndexedDraws = {
+        "coalesceConsecutiveIndexedDraws",
+        FeatureCategory::VulkanFeatures,
+        &members,
+    };
+
+    FeatureInfo shardGlobalPipelineCache = {
+        "shardGlobalPipelineCache",
+        FeatureCategory::VulkanFeatures,
+        &members,
+    };
+
     FeatureInfo supportsShaderNonSemanticInfo = {
         "supportsShaderNonSemanticInfo",
         FeatureCategory::VulkanFeatures,
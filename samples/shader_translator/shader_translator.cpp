@@ -37,6 +37,7 @@ static bool CompileFile(char *fileName, ShHandle compiler, const ShCompileOption
 static void LogMsg(const char *msg, const char *name, const int num, const char *logName);
 static void PrintVariable(const std::string &prefix, size_t index, const sh::ShaderVariable &var);
 static void PrintActiveVariables(ShHandle compiler);
+static void PrintPassStatistics(ShHandle compiler);
 
 // If NUM_SOURCE_STRINGS is set to a value > 1, the input file data is
 // broken into that many chunks. This will affect file/line numbering in
@@ -96,6 +97,7 @@ int main(int argc, char *argv[])
     GenerateResources(&resources);
 
     bool printActiveVariables = false;
+    bool printPassStatistics  = false;
 
     argc--;
     argv++;
@@ -114,6 +116,10 @@ int main(int argc, char *argv[])
                 case 'u':
                     printActiveVariables = true;
                     break;
+                case 'p':
+                    compileOptions.recordPassStatistics = true;
+                    printPassStatistics                 = true;
+                    break;
                 case 's':
                     if (argv[0][2] == '=')
                     {
@@ -377,6 +383,13 @@ int main(int argc, char *argv[])
                     LogMsg("END", "COMPILER", numCompiles, "VARIABLES");
                     printf("\n\n");
                 }
+                if (compiled && printPassStatistics)
+                {
+                    LogMsg("BEGIN", "COMPILER", numCompiles, "PASS STATISTICS");
+                    PrintPassStatistics(compiler);
+                    LogMsg("END", "COMPILER", numCompiles, "PASS STATISTICS");
+                    printf("\n\n");
+                }
                 if (!compiled)
                     failCode = EFailCompile;
                 ++numCompiles;
@@ -435,11 +448,12 @@ void usage()
 {
     // clang-format off
     printf(
-        "Usage: translate [-i -o -u -l -b=e -b=g -b=h9 -x=i -x=d] file1 file2 ...\n"
+        "Usage: translate [-i -o -u -p -l -b=e -b=g -b=h9 -x=i -x=d] file1 file2 ...\n"
         "Where: filename : filename ending in .frag*, .vert*, .comp*, .geom*, .tcs* or .tes*\n"
         "       -i       : print intermediate tree\n"
         "       -o       : print translated code\n"
         "       -u       : print active attribs, uniforms, varyings and program outputs\n"
+        "       -p       : print the time, AST size and pool memory of each translator pass\n"
         "       -s=e2    : use GLES2 spec (this is by default)\n"
         "       -s=e3    : use GLES3 spec\n"
         "       -s=e31   : use GLES31 spec (in development)\n"
@@ -797,6 +811,30 @@ static void PrintActiveVariables(ShHandle compiler)
     }
 }
 
+static void PrintPassStatistics(ShHandle compiler)
+{
+    const std::vector<ShPassStatistics> *passes = sh::GetPassStatistics(compiler);
+    if (passes == nullptr)
+    {
+        return;
+    }
+
+    // The pass name comes last, as the names of fused passes can be long.
+    printf("%10s %10s %10s %12s  %s\n", "time (us)", "nodes in", "nodes out", "pool bytes",
+           "pass");
+
+    double totalTime  = 0;
+    size_t totalBytes = 0;
+    for (const ShPassStatistics &pass : *passes)
+    {
+        printf("%10.1f %10zu %10zu %12zu  %s\n", pass.timeSeconds * 1e6, pass.nodeCountBefore,
+               pass.nodeCountAfter, pass.poolBytesAllocated, pass.name);
+        totalTime += pass.timeSeconds;
+        totalBytes += pass.poolBytesAllocated;
+    }
+    printf("%10.1f %10s %10s %12zu  %s\n", totalTime * 1e6, "", "", totalBytes, "total");
+}
+
 static bool ReadShaderSource(const char *fileName, ShaderSource &source)
 {
     FILE *in = fopen(fileName, "rb");
@@ -486,6 +486,15 @@ void PoolAllocator::unlock()
     mLocked = false;
 }
 
+size_t PoolAllocator::getTotalBytesAllocated() const
+{
+#if !defined(ANGLE_DISABLE_POOL_ALLOC)
+    return mTotalBytes;
+#else
+    return 0;
+#endif
+}
+
 //
 // Check all allocations in a list for damage by calling check on each.
 //
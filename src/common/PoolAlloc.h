@@ -138,6 +138,10 @@ class PoolAllocator : angle::NonCopyable
     void lock();
     void unlock();
 
+    // Returns the number of bytes requested through allocate() since the allocator was created.
+    // This is a statistic only, which is 0 if the pool allocator is disabled.
+    size_t getTotalBytesAllocated() const;
+
   private:
     size_t mAlignment;  // all returned allocations will be aligned at
                         // this granularity, which will be a power of 2
@@ -163,7 +163,11 @@ struct PerfMonitorTriplet
     FN(dynamicBufferAllocations)                   \
     FN(framebufferCacheSize)                       \
     FN(pendingSubmissionGarbageObjects)            \
-    FN(graphicsDriverUniformsUpdated)
+    FN(graphicsDriverUniformsUpdated)              \
+    FN(coalescedDraws)                             \
+    FN(indexRangeCacheHits)                        \
+    FN(indexRangeCacheMisses)                      \
+    FN(indexRangeCacheEvictions)
 
 #define ANGLE_DECLARE_PERF_COUNTER(COUNTER) uint64_t COUNTER;
 
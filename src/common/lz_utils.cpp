@@ -0,0 +1,292 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// lz_utils.cpp: A fast LZ77 compressor and decompressor, producing and consuming the LZ4 block
+// format.
+//
+// Every sequence of the format is made of a token byte, whose high and low nibbles hold the
+// literal length and the match length minus 4, followed by the extra bytes of the literal length
+// (if the nibble is 15), the literals, the 16-bit little-endian match offset and the extra bytes of
+// the match length (if the nibble is 15).  The last sequence only has literals.
+
+#include "common/lz_utils.h"
+
+#include <string.h>
+
+#include "common/mathutil.h"
+
+#include <algorithm>
+#include <memory>
+
+namespace angle
+{
+namespace
+{
+constexpr size_t kMinMatch = 4;
+// The last match must start this many bytes before the end of the input, and the last bytes of the
+// input are always literals.  These match the restrictions of the LZ4 block format, which let
+// decoders copy in large chunks.
+constexpr size_t kMatchFindLimit = 12;
+constexpr size_t kLastLiterals   = 5;
+constexpr size_t kMaxOffset      = 65535;
+
+constexpr uint32_t kHashLog     = 14;
+constexpr size_t kHashTableSize = 1 << kHashLog;
+constexpr uint32_t kLengthMask  = 15;
+constexpr uint32_t kSkipTrigger = 6;
+constexpr size_t kCopyChunkSize = 16;
+
+uint32_t Read32(const uint8_t *ptr)
+{
+    uint32_t value;
+    memcpy(&value, ptr, sizeof(value));
+    return value;
+}
+
+uint64_t Read64(const uint8_t *ptr)
+{
+    uint64_t value;
+    memcpy(&value, ptr, sizeof(value));
+    return value;
+}
+
+uint32_t Hash(uint32_t sequence)
+{
+    return (sequence * 2654435761u) >> (32 - kHashLog);
+}
+
+uint8_t *WriteLength(uint8_t *op, size_t length)
+{
+    for (; length >= 255; length -= 255)
+    {
+        *op++ = 255;
+    }
+    *op++ = static_cast<uint8_t>(length);
+    return op;
+}
+
+// Returns the worst-case size of a sequence.
+size_t GetMaxSequenceSize(size_t literalLength, size_t matchLength)
+{
+    return 1 + literalLength / 255 + 1 + literalLength + 2 + matchLength / 255 + 1;
+}
+
+bool ReadLength(const uint8_t *input, size_t inputSize, size_t *ip, size_t *length)
+{
+    uint8_t byte;
+    do
+    {
+        if (*ip >= inputSize)
+        {
+            return false;
+        }
+        byte = input[(*ip)++];
+        *length += byte;
+    } while (byte == 255);
+    return true;
+}
+}  // anonymous namespace
+
+size_t LZCompressBound(size_t inputSize)
+{
+    return inputSize + inputSize / 255 + 16;
+}
+
+size_t LZCompress(const uint8_t *input, size_t inputSize, uint8_t *output, size_t outputCapacity)
+{
+    uint8_t *op          = output;
+    const uint8_t *opEnd = output + outputCapacity;
+    size_t anchor        = 0;
+
+    if (inputSize > kMatchFindLimit)
+    {
+        // Positions of the last occurrence of every hashed 4-byte sequence.
+        std::unique_ptr<uint32_t[]> hashTable(new uint32_t[kHashTableSize]());
+
+        const size_t matchLimit  = inputSize - kLastLiterals;
+        const size_t searchLimit = inputSize - kMatchFindLimit;
+
+        size_t ip = 0;
+        while (ip < searchLimit)
+        {
+            const uint32_t sequence = Read32(input + ip);
+            const uint32_t hash     = Hash(sequence);
+            size_t candidate        = hashTable[hash];
+            hashTable[hash]         = static_cast<uint32_t>(ip);
+
+            if (candidate >= ip || ip - candidate > kMaxOffset ||
+                Read32(input + candidate) != sequence)
+            {
+                // Skip faster through data that doesn't compress.
+                ip += 1 + ((ip - anchor) >> kSkipTrigger);
+                continue;
+            }
+
+            // Extend the match backwards over the pending literals, then forwards.
+            while (ip > anchor && candidate > 0 && input[ip - 1] == input[candidate - 1])
+            {
+                --ip;
+                --candidate;
+            }
+            size_t matchLength = kMinMatch;
+            while (ip + matchLength + sizeof(uint64_t) <= matchLimit)
+            {
+                const uint64_t difference =
+                    Read64(input + ip + matchLength) ^ Read64(input + candidate + matchLength);
+                if (difference != 0)
+                {
+                    matchLength += gl::ScanForward(difference) / 8;
+                    break;
+                }
+                matchLength += sizeof(uint64_t);
+            }
+            while (ip + matchLength < matchLimit &&
+                   input[candidate + matchLength] == input[ip + matchLength])
+            {
+                ++matchLength;
+            }
+
+            const size_t literalLength = ip - anchor;
+            if (GetMaxSequenceSize(literalLength, matchLength) > static_cast<size_t>(opEnd - op))
+            {
+                return 0;
+            }
+
+            const size_t extraMatchLength = matchLength - kMinMatch;
+
+            *op++ = static_cast<uint8_t>((std::min<size_t>(literalLength, kLengthMask) << 4) |
+                                         std::min<size_t>(extraMatchLength, kLengthMask));
+            if (literalLength >= kLengthMask)
+            {
+                op = WriteLength(op, literalLength - kLengthMask);
+            }
+            memcpy(op, input + anchor, literalLength);
+            op += literalLength;
+
+            const size_t offset = ip - candidate;
+            *op++               = static_cast<uint8_t>(offset);
+            *op++               = static_cast<uint8_t>(offset >> 8);
+            if (extraMatchLength >= kLengthMask)
+            {
+                op = WriteLength(op, extraMatchLength - kLengthMask);
+            }
+
+            ip += matchLength;
+            anchor = ip;
+
+            // Index a position inside the match, which helps find the next match.
+            hashTable[Hash(Read32(input + ip - 2))] = static_cast<uint32_t>(ip - 2);
+        }
+    }
+
+    // The remaining input is stored as literals.
+    const size_t literalLength = inputSize - anchor;
+    if (1 + literalLength / 255 + 1 + literalLength > static_cast<size_t>(opEnd - op))
+    {
+        return 0;
+    }
+    *op++ = static_cast<uint8_t>(std::min<size_t>(literalLength, kLengthMask) << 4);
+    if (literalLength >= kLengthMask)
+    {
+        op = WriteLength(op, literalLength - kLengthMask);
+    }
+    if (literalLength > 0)
+    {
+        memcpy(op, input + anchor, literalLength);
+        op += literalLength;
+    }
+
+    return op - output;
+}
+
+bool LZDecompress(const uint8_t *input, size_t inputSize, uint8_t *output, size_t outputSize)
+{
+    size_t ip = 0;
+    size_t op = 0;
+
+    while (true)
+    {
+        if (ip >= inputSize)
+        {
+            return false;
+        }
+        const uint8_t token = input[ip++];
+
+        size_t literalLength = token >> 4;
+        if (literalLength == kLengthMask && !ReadLength(input, inputSize, &ip, &literalLength))
+        {
+            return false;
+        }
+        if (literalLength > inputSize - ip || literalLength > outputSize - op)
+        {
+            return false;
+        }
+        if (literalLength <= kCopyChunkSize && inputSize - ip >= kCopyChunkSize &&
+            outputSize - op >= kCopyChunkSize)
+        {
+            // Most literal runs are short; copy a fixed size chunk where there's room for it.
+            memcpy(output + op, input + ip, kCopyChunkSize);
+        }
+        else if (literalLength > 0)
+        {
+            memcpy(output + op, input + ip, literalLength);
+        }
+        ip += literalLength;
+        op += literalLength;
+
+        // The last sequence has no match.
+        if (ip == inputSize)
+        {
+            return op == outputSize;
+        }
+
+        if (inputSize - ip < 2)
+        {
+            return false;
+        }
+        const size_t offset = input[ip] | (input[ip + 1] << 8);
+        ip += 2;
+        if (offset == 0 || offset > op)
+        {
+            return false;
+        }
+
+        size_t matchLength = token & kLengthMask;
+        if (matchLength == kLengthMask && !ReadLength(input, inputSize, &ip, &matchLength))
+        {
+            return false;
+        }
+        matchLength += kMinMatch;
+        if (matchLength > outputSize - op)
+        {
+            return false;
+        }
+
+        // Matches may overlap the data they produce, which repeats the last |offset| bytes.
+        const uint8_t *match = output + op - offset;
+        uint8_t *dst         = output + op;
+        if (offset >= sizeof(uint64_t) && outputSize - op >= matchLength + sizeof(uint64_t))
+        {
+            // Every 8-byte chunk only reads bytes that were written before it.
+            for (size_t i = 0; i < matchLength; i += sizeof(uint64_t))
+            {
+                memcpy(dst + i, match + i, sizeof(uint64_t));
+            }
+        }
+        else if (offset >= matchLength)
+        {
+            memcpy(dst, match, matchLength);
+        }
+        else
+        {
+            for (size_t i = 0; i < matchLength; ++i)
+            {
+                dst[i] = match[i];
+            }
+        }
+        op += matchLength;
+    }
+}
+}  // namespace angle
@@ -0,0 +1,30 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// lz_utils.h: A fast LZ77 compressor and decompressor, producing and consuming the LZ4 block
+// format.  It trades compression ratio for speed compared to deflate, and is used where data is
+// decompressed far more often than it is compressed.
+
+#ifndef COMMON_LZ_UTILS_H_
+#define COMMON_LZ_UTILS_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace angle
+{
+// Returns the maximum compressed size of |inputSize| bytes of data.
+size_t LZCompressBound(size_t inputSize);
+
+// Compresses |input| into |output|, returning the size of the compressed data, or 0 if it doesn't
+// fit in |outputCapacity| bytes.  An |outputCapacity| of LZCompressBound(inputSize) always fits.
+size_t LZCompress(const uint8_t *input, size_t inputSize, uint8_t *output, size_t outputCapacity);
+
+// Decompresses |input| into |output|, which must be exactly the size of the original data.
+// Returns false if the compressed data is malformed, or doesn't decompress to |outputSize| bytes.
+bool LZDecompress(const uint8_t *input, size_t inputSize, uint8_t *output, size_t outputSize);
+}  // namespace angle
+
+#endif  // COMMON_LZ_UTILS_H_
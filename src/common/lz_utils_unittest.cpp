@@ -0,0 +1,113 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// lz_utils_unittest: Tests of the LZ compressor and decompressor.
+
+#include <gtest/gtest.h>
+
+#include "common/lz_utils.h"
+
+#include <random>
+#include <vector>
+
+using namespace angle;
+
+namespace
+{
+std::vector<uint8_t> Compress(const std::vector<uint8_t> &input)
+{
+    std::vector<uint8_t> compressed(LZCompressBound(input.size()));
+    size_t compressedSize =
+        LZCompress(input.data(), input.size(), compressed.data(), compressed.size());
+    EXPECT_NE(compressedSize, 0u);
+    compressed.resize(compressedSize);
+    return compressed;
+}
+
+void CheckRoundTrip(const std::vector<uint8_t> &input)
+{
+    std::vector<uint8_t> compressed = Compress(input);
+    std::vector<uint8_t> decompressed(input.size());
+    EXPECT_TRUE(
+        LZDecompress(compressed.data(), compressed.size(), decompressed.data(), input.size()));
+    EXPECT_EQ(input, decompressed);
+}
+
+std::vector<uint8_t> MakeRandomData(size_t size, uint32_t alphabetSize)
+{
+    std::mt19937 rng(size);
+    std::vector<uint8_t> data(size);
+    for (uint8_t &byte : data)
+    {
+        byte = static_cast<uint8_t>(rng() % alphabetSize);
+    }
+    return data;
+}
+
+// Tests round trips of data of various sizes and compressibility.
+TEST(LZUtilsTest, RoundTrip)
+{
+    for (size_t size : {0, 1, 5, 12, 13, 16, 17, 100, 1000, 65536, 200000})
+    {
+        CheckRoundTrip(MakeRandomData(size, 256));
+        CheckRoundTrip(MakeRandomData(size, 4));
+        CheckRoundTrip(std::vector<uint8_t>(size, 42));
+    }
+}
+
+// Tests that repetitive data is compressed, including matches that overlap the data they produce.
+TEST(LZUtilsTest, RepetitiveData)
+{
+    std::vector<uint8_t> input(100000);
+    for (size_t i = 0; i < input.size(); ++i)
+    {
+        input[i] = static_cast<uint8_t>(i % 3);
+    }
+
+    EXPECT_LT(Compress(input).size(), input.size() / 100);
+    CheckRoundTrip(input);
+}
+
+// Tests that compression fails if the output doesn't fit.
+TEST(LZUtilsTest, InsufficientCapacity)
+{
+    std::vector<uint8_t> input = MakeRandomData(1000, 256);
+    std::vector<uint8_t> compressed(input.size() / 2);
+    EXPECT_EQ(LZCompress(input.data(), input.size(), compressed.data(), compressed.size()), 0u);
+}
+
+// Tests that decompression fails if the output size doesn't match the original data.
+TEST(LZUtilsTest, MismatchedOutputSize)
+{
+    std::vector<uint8_t> input      = MakeRandomData(1000, 4);
+    std::vector<uint8_t> compressed = Compress(input);
+    std::vector<uint8_t> decompressed(input.size() + 1);
+
+    EXPECT_FALSE(
+        LZDecompress(compressed.data(), compressed.size(), decompressed.data(), input.size() - 1));
+    EXPECT_FALSE(
+        LZDecompress(compressed.data(), compressed.size(), decompressed.data(), input.size() + 1));
+}
+
+// Tests that malformed data is rejected without reading or writing out of bounds.
+TEST(LZUtilsTest, MalformedData)
+{
+    std::vector<uint8_t> input      = MakeRandomData(10000, 8);
+    std::vector<uint8_t> compressed = Compress(input);
+    std::vector<uint8_t> decompressed(input.size());
+
+    EXPECT_FALSE(LZDecompress(compressed.data(), compressed.size() - 1, decompressed.data(),
+                              input.size()));
+
+    std::mt19937 rng(0);
+    for (int i = 0; i < 1000; ++i)
+    {
+        std::vector<uint8_t> corrupted = compressed;
+        corrupted[rng() % corrupted.size()] ^= static_cast<uint8_t>(1 + rng() % 255);
+        // Corruption may or may not be detected, but must not crash.
+        LZDecompress(corrupted.data(), corrupted.size(), decompressed.data(), input.size());
+    }
+}
+}  // anonymous namespace
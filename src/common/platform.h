@@ -185,6 +185,20 @@
 #    define ANGLE_WITH_SANITIZER 1
 #endif  // defined(ANGLE_WITH_ASAN) || defined(ANGLE_WITH_TSAN) || defined(ANGLE_WITH_UBSAN)
 
+// Define macros for the SIMD instruction sets that are part of the target CPU's baseline and can be
+// used unconditionally.  Wider instruction sets such as AVX2 must be guarded with a runtime check
+// (see angle::SupportsAVX2()) and the functions using them annotated with ANGLE_AVX2_TARGET.
+#if defined(_M_X64) || defined(__x86_64__)
+#    define ANGLE_USE_SSE2 1
+#    if defined(__GNUC__) || defined(__clang__)
+#        define ANGLE_AVX2_TARGET __attribute__((target("avx2")))
+#    else
+#        define ANGLE_AVX2_TARGET
+#    endif
+#elif defined(_M_ARM64) || defined(__aarch64__)
+#    define ANGLE_USE_NEON 1
+#endif
+
 #include <stdint.h>
 #if INTPTR_MAX == INT64_MAX
 #    define ANGLE_IS_64_BIT_CPU 1
@@ -16,6 +16,11 @@
 #    include <windows.h>
 #endif
 
+#if defined(ANGLE_USE_SSE2) && defined(_MSC_VER)
+#    include <immintrin.h>
+#    include <intrin.h>
+#endif
+
 namespace angle
 {
 
@@ -171,4 +176,37 @@ bool Is64Bit()
 #endif  // defined(ANGLE_IS_64_BIT_CPU)
 }
 
+bool SupportsAVX2()
+{
+#if defined(ANGLE_USE_SSE2)
+#    if defined(__GNUC__) || defined(__clang__)
+    static const bool supportsAVX2 = __builtin_cpu_supports("avx2");
+    return supportsAVX2;
+#    else
+    static const bool supportsAVX2 = []() {
+        int info[4];
+        __cpuid(info, 0);
+        if (info[0] < 7)
+        {
+            return false;
+        }
+
+        // AVX2 also requires the OS to save the YMM registers (OSXSAVE and XCR0 bits 1 and 2).
+        __cpuid(info, 1);
+        constexpr int kOSXSAVEAndAVXBits = (1 << 27) | (1 << 28);
+        if ((info[2] & kOSXSAVEAndAVXBits) != kOSXSAVEAndAVXBits || (_xgetbv(0) & 0x6) != 0x6)
+        {
+            return false;
+        }
+
+        __cpuidex(info, 7, 0);
+        return ((info[1] >> 5) & 1) != 0;
+    }();
+    return supportsAVX2;
+#    endif
+#else
+    return false;
+#endif  // defined(ANGLE_USE_SSE2)
+}
+
 }  // namespace angle
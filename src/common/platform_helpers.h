@@ -128,6 +128,9 @@ bool IsWindows11OrLater();
 
 bool Is64Bit();
 
+// Runtime CPU feature checks
+bool SupportsAVX2();
+
 }  // namespace angle
 
 #endif  // COMMON_PLATFORM_HELPERS_H_
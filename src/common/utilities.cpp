@@ -10,10 +10,17 @@
 #include "GLES3/gl3.h"
 #include "common/mathutil.h"
 #include "common/platform.h"
+#include "common/platform_helpers.h"
 #include "common/string_utils.h"
 
 #include <set>
 
+#if defined(ANGLE_USE_SSE2)
+#    include <immintrin.h>
+#elif defined(ANGLE_USE_NEON)
+#    include <arm_neon.h>
+#endif
+
 #if defined(ANGLE_ENABLE_WINDOWS_UWP)
 #    include <windows.applicationmodel.core.h>
 #    include <windows.graphics.display.h>
@@ -24,6 +31,269 @@
 namespace
 {
 
+// The SIMD scanners below process as many whole vectors of |indices| as possible, folding the
+// result into |minIndexInOut| / |maxIndexInOut|, and return the number of indices consumed.  The
+// remainder is handled by the scalar loop in ComputeTypedIndexRange.
+//
+// The primitive restart index is the largest representable value of the index type, so it never
+// lowers the minimum.  Only the maximum needs to be masked: restart lanes are zeroed before being
+// folded into the running maximum.  Whether any non-restart index was seen at all is then derived
+// from the minimum by the caller, so no separate vertex count needs to be reduced.
+#if defined(ANGLE_USE_SSE2)
+// SSE2 only has unsigned 8-bit min/max.  16-bit and 32-bit values are biased into the signed
+// range so that signed comparisons can be used instead.
+template <class IndexType>
+struct SSE2IndexOps;
+
+template <>
+struct SSE2IndexOps<uint8_t>
+{
+    static __m128i Bias(__m128i v) { return v; }
+    static __m128i Equal(__m128i a, __m128i b) { return _mm_cmpeq_epi8(a, b); }
+    static __m128i Min(__m128i a, __m128i b) { return _mm_min_epu8(a, b); }
+    static __m128i Max(__m128i a, __m128i b) { return _mm_max_epu8(a, b); }
+};
+
+template <>
+struct SSE2IndexOps<uint16_t>
+{
+    static __m128i Bias(__m128i v) { return _mm_xor_si128(v, _mm_set1_epi16(-0x8000)); }
+    static __m128i Equal(__m128i a, __m128i b) { return _mm_cmpeq_epi16(a, b); }
+    static __m128i Min(__m128i a, __m128i b) { return _mm_min_epi16(a, b); }
+    static __m128i Max(__m128i a, __m128i b) { return _mm_max_epi16(a, b); }
+};
+
+template <>
+struct SSE2IndexOps<uint32_t>
+{
+    static __m128i Bias(__m128i v)
+    {
+        return _mm_xor_si128(v, _mm_set1_epi32(std::numeric_limits<int32_t>::min()));
+    }
+    static __m128i Equal(__m128i a, __m128i b) { return _mm_cmpeq_epi32(a, b); }
+    static __m128i Min(__m128i a, __m128i b)
+    {
+        __m128i aGreater = _mm_cmpgt_epi32(a, b);
+        return _mm_or_si128(_mm_and_si128(aGreater, b), _mm_andnot_si128(aGreater, a));
+    }
+    static __m128i Max(__m128i a, __m128i b)
+    {
+        __m128i aGreater = _mm_cmpgt_epi32(a, b);
+        return _mm_or_si128(_mm_and_si128(aGreater, a), _mm_andnot_si128(aGreater, b));
+    }
+};
+
+template <class IndexType, bool kPrimitiveRestart>
+size_t ScanIndexRangeSSE2(const IndexType *indices,
+                          size_t count,
+                          IndexType *minIndexInOut,
+                          IndexType *maxIndexInOut)
+{
+    using Ops               = SSE2IndexOps<IndexType>;
+    constexpr size_t kLanes = sizeof(__m128i) / sizeof(IndexType);
+
+    const __m128i restartIndex = _mm_set1_epi32(-1);
+    __m128i minVector          = Ops::Bias(restartIndex);
+    __m128i maxVector          = Ops::Bias(_mm_setzero_si128());
+
+    size_t i = 0;
+    for (; i + kLanes <= count; i += kLanes)
+    {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(indices + i));
+        minVector = Ops::Min(minVector, Ops::Bias(v));
+        if (kPrimitiveRestart)
+        {
+            v = _mm_andnot_si128(Ops::Equal(v, restartIndex), v);
+        }
+        maxVector = Ops::Max(maxVector, Ops::Bias(v));
+    }
+
+    alignas(16) IndexType minLanes[kLanes];
+    alignas(16) IndexType maxLanes[kLanes];
+    _mm_store_si128(reinterpret_cast<__m128i *>(minLanes), Ops::Bias(minVector));
+    _mm_store_si128(reinterpret_cast<__m128i *>(maxLanes), Ops::Bias(maxVector));
+    for (size_t lane = 0; lane < kLanes; ++lane)
+    {
+        *minIndexInOut = std::min(*minIndexInOut, minLanes[lane]);
+        *maxIndexInOut = std::max(*maxIndexInOut, maxLanes[lane]);
+    }
+
+    return i;
+}
+
+template <class IndexType>
+struct AVX2IndexOps;
+
+template <>
+struct AVX2IndexOps<uint8_t>
+{
+    ANGLE_AVX2_TARGET static __m256i Equal(__m256i a, __m256i b) { return _mm256_cmpeq_epi8(a, b); }
+    ANGLE_AVX2_TARGET static __m256i Min(__m256i a, __m256i b) { return _mm256_min_epu8(a, b); }
+    ANGLE_AVX2_TARGET static __m256i Max(__m256i a, __m256i b) { return _mm256_max_epu8(a, b); }
+};
+
+template <>
+struct AVX2IndexOps<uint16_t>
+{
+    ANGLE_AVX2_TARGET static __m256i Equal(__m256i a, __m256i b)
+    {
+        return _mm256_cmpeq_epi16(a, b);
+    }
+    ANGLE_AVX2_TARGET static __m256i Min(__m256i a, __m256i b) { return _mm256_min_epu16(a, b); }
+    ANGLE_AVX2_TARGET static __m256i Max(__m256i a, __m256i b) { return _mm256_max_epu16(a, b); }
+};
+
+template <>
+struct AVX2IndexOps<uint32_t>
+{
+    ANGLE_AVX2_TARGET static __m256i Equal(__m256i a, __m256i b)
+    {
+        return _mm256_cmpeq_epi32(a, b);
+    }
+    ANGLE_AVX2_TARGET static __m256i Min(__m256i a, __m256i b) { return _mm256_min_epu32(a, b); }
+    ANGLE_AVX2_TARGET static __m256i Max(__m256i a, __m256i b) { return _mm256_max_epu32(a, b); }
+};
+
+template <class IndexType, bool kPrimitiveRestart>
+ANGLE_AVX2_TARGET size_t ScanIndexRangeAVX2(const IndexType *indices,
+                                            size_t count,
+                                            IndexType *minIndexInOut,
+                                            IndexType *maxIndexInOut)
+{
+    using Ops               = AVX2IndexOps<IndexType>;
+    constexpr size_t kLanes = sizeof(__m256i) / sizeof(IndexType);
+
+    const __m256i restartIndex = _mm256_set1_epi32(-1);
+    __m256i minVector          = restartIndex;
+    __m256i maxVector          = _mm256_setzero_si256();
+
+    size_t i = 0;
+    for (; i + kLanes <= count; i += kLanes)
+    {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(indices + i));
+        minVector = Ops::Min(minVector, v);
+        if (kPrimitiveRestart)
+        {
+            v = _mm256_andnot_si256(Ops::Equal(v, restartIndex), v);
+        }
+        maxVector = Ops::Max(maxVector, v);
+    }
+
+    alignas(32) IndexType minLanes[kLanes];
+    alignas(32) IndexType maxLanes[kLanes];
+    _mm256_store_si256(reinterpret_cast<__m256i *>(minLanes), minVector);
+    _mm256_store_si256(reinterpret_cast<__m256i *>(maxLanes), maxVector);
+    for (size_t lane = 0; lane < kLanes; ++lane)
+    {
+        *minIndexInOut = std::min(*minIndexInOut, minLanes[lane]);
+        *maxIndexInOut = std::max(*maxIndexInOut, maxLanes[lane]);
+    }
+
+    return i;
+}
+#endif  // defined(ANGLE_USE_SSE2)
+
+#if defined(ANGLE_USE_NEON)
+template <class IndexType>
+struct NEONIndexOps;
+
+template <>
+struct NEONIndexOps<uint8_t>
+{
+    using Vector = uint8x16_t;
+    static Vector Load(const uint8_t *p) { return vld1q_u8(p); }
+    static Vector Splat(uint8_t v) { return vdupq_n_u8(v); }
+    static Vector Equal(Vector a, Vector b) { return vceqq_u8(a, b); }
+    static Vector AndNot(Vector a, Vector mask) { return vbicq_u8(a, mask); }
+    static Vector Min(Vector a, Vector b) { return vminq_u8(a, b); }
+    static Vector Max(Vector a, Vector b) { return vmaxq_u8(a, b); }
+    static uint8_t ReduceMin(Vector v) { return vminvq_u8(v); }
+    static uint8_t ReduceMax(Vector v) { return vmaxvq_u8(v); }
+};
+
+template <>
+struct NEONIndexOps<uint16_t>
+{
+    using Vector = uint16x8_t;
+    static Vector Load(const uint16_t *p) { return vld1q_u16(p); }
+    static Vector Splat(uint16_t v) { return vdupq_n_u16(v); }
+    static Vector Equal(Vector a, Vector b) { return vceqq_u16(a, b); }
+    static Vector AndNot(Vector a, Vector mask) { return vbicq_u16(a, mask); }
+    static Vector Min(Vector a, Vector b) { return vminq_u16(a, b); }
+    static Vector Max(Vector a, Vector b) { return vmaxq_u16(a, b); }
+    static uint16_t ReduceMin(Vector v) { return vminvq_u16(v); }
+    static uint16_t ReduceMax(Vector v) { return vmaxvq_u16(v); }
+};
+
+template <>
+struct NEONIndexOps<uint32_t>
+{
+    using Vector = uint32x4_t;
+    static Vector Load(const uint32_t *p) { return vld1q_u32(p); }
+    static Vector Splat(uint32_t v) { return vdupq_n_u32(v); }
+    static Vector Equal(Vector a, Vector b) { return vceqq_u32(a, b); }
+    static Vector AndNot(Vector a, Vector mask) { return vbicq_u32(a, mask); }
+    static Vector Min(Vector a, Vector b) { return vminq_u32(a, b); }
+    static Vector Max(Vector a, Vector b) { return vmaxq_u32(a, b); }
+    static uint32_t ReduceMin(Vector v) { return vminvq_u32(v); }
+    static uint32_t ReduceMax(Vector v) { return vmaxvq_u32(v); }
+};
+
+template <class IndexType, bool kPrimitiveRestart>
+size_t ScanIndexRangeNEON(const IndexType *indices,
+                          size_t count,
+                          IndexType *minIndexInOut,
+                          IndexType *maxIndexInOut)
+{
+    using Ops               = NEONIndexOps<IndexType>;
+    using Vector            = typename Ops::Vector;
+    constexpr size_t kLanes = sizeof(Vector) / sizeof(IndexType);
+
+    const Vector restartIndex = Ops::Splat(std::numeric_limits<IndexType>::max());
+    Vector minVector          = restartIndex;
+    Vector maxVector          = Ops::Splat(0);
+
+    size_t i = 0;
+    for (; i + kLanes <= count; i += kLanes)
+    {
+        Vector v  = Ops::Load(indices + i);
+        minVector = Ops::Min(minVector, v);
+        if (kPrimitiveRestart)
+        {
+            v = Ops::AndNot(v, Ops::Equal(v, restartIndex));
+        }
+        maxVector = Ops::Max(maxVector, v);
+    }
+
+    *minIndexInOut = std::min(*minIndexInOut, Ops::ReduceMin(minVector));
+    *maxIndexInOut = std::max(*maxIndexInOut, Ops::ReduceMax(maxVector));
+
+    return i;
+}
+#endif  // defined(ANGLE_USE_NEON)
+
+template <class IndexType, bool kPrimitiveRestart>
+size_t ScanIndexRangeSIMD(const IndexType *indices,
+                          size_t count,
+                          IndexType *minIndexInOut,
+                          IndexType *maxIndexInOut)
+{
+#if defined(ANGLE_USE_SSE2)
+    if (angle::SupportsAVX2())
+    {
+        return ScanIndexRangeAVX2<IndexType, kPrimitiveRestart>(indices, count, minIndexInOut,
+                                                                maxIndexInOut);
+    }
+    return ScanIndexRangeSSE2<IndexType, kPrimitiveRestart>(indices, count, minIndexInOut,
+                                                            maxIndexInOut);
+#elif defined(ANGLE_USE_NEON)
+    return ScanIndexRangeNEON<IndexType, kPrimitiveRestart>(indices, count, minIndexInOut,
+                                                            maxIndexInOut);
+#else
+    return 0;
+#endif
+}
+
 template <class IndexType>
 gl::IndexRange ComputeTypedIndexRange(const IndexType *indices,
                                       size_t count,
@@ -36,21 +306,24 @@ gl::IndexRange ComputeTypedIndexRange(const IndexType *indices,
 
     if (primitiveRestartEnabled)
     {
-        for (size_t i = 0; i < count; i++)
+        size_t i = ScanIndexRangeSIMD<IndexType, true>(indices, count, &minIndex, &maxIndex);
+        for (; i < count; i++)
         {
             IndexType index = indices[i];
             if (index == primitiveRestartIndex)
             {
                 continue;
             }
-            hasVertices = true;
-            minIndex    = std::min(minIndex, index);
-            maxIndex    = std::max(maxIndex, index);
+            minIndex = std::min(minIndex, index);
+            maxIndex = std::max(maxIndex, index);
         }
+        // Any index other than the restart index lowers the minimum below it.
+        hasVertices = minIndex != primitiveRestartIndex;
     }
     else
     {
-        for (size_t i = 0; i < count; i++)
+        size_t i = ScanIndexRangeSIMD<IndexType, false>(indices, count, &minIndex, &maxIndex);
+        for (; i < count; i++)
         {
             IndexType index = indices[i];
             minIndex        = std::min(minIndex, index);
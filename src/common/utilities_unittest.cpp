@@ -254,4 +254,60 @@ TEST(Utilities, IndexRanges)
     EXPECT_EQ(ComputeIndexRange(b, vertices2, 3, false), gl::IndexRange(2, 255));
 }
 
+// Tests gl::ComputeIndexRange() on inputs long enough to exercise the vectorized paths, with
+// the extrema and restart indices placed in every lane position and in the scalar tail.
+template <typename IndexType>
+void TestLongIndexRanges(gl::DrawElementsType type)
+{
+    constexpr IndexType kRestart = std::numeric_limits<IndexType>::max();
+    constexpr size_t kCount      = 131;
+
+    std::vector<IndexType> indices(kCount);
+    for (size_t i = 0; i < kCount; ++i)
+    {
+        indices[i] = static_cast<IndexType>(10 + i % 50);
+    }
+
+    EXPECT_EQ(ComputeIndexRange(type, indices.data(), kCount, false), gl::IndexRange(10, 59));
+    EXPECT_EQ(ComputeIndexRange(type, indices.data(), kCount, true), gl::IndexRange(10, 59));
+
+    for (size_t position = 0; position < kCount; ++position)
+    {
+        std::vector<IndexType> modified = indices;
+        modified[position]              = 3;
+        EXPECT_EQ(ComputeIndexRange(type, modified.data(), kCount, true), gl::IndexRange(3, 59));
+
+        modified[position] = kRestart;
+        EXPECT_EQ(ComputeIndexRange(type, modified.data(), kCount, true), gl::IndexRange(10, 59));
+        EXPECT_EQ(ComputeIndexRange(type, modified.data(), kCount, false),
+                  gl::IndexRange(10, kRestart));
+
+        modified[position] = kRestart - 1;
+        EXPECT_EQ(ComputeIndexRange(type, modified.data(), kCount, true),
+                  gl::IndexRange(10, kRestart - 1));
+    }
+
+    // Only restart indices, with a single vertex either inside a vector or in the tail.
+    std::vector<IndexType> restarts(kCount, kRestart);
+    EXPECT_EQ(ComputeIndexRange(type, restarts.data(), kCount, true), gl::IndexRange());
+    EXPECT_EQ(ComputeIndexRange(type, restarts.data(), kCount, false),
+              gl::IndexRange(kRestart, kRestart));
+    restarts[5] = 0;
+    EXPECT_EQ(ComputeIndexRange(type, restarts.data(), kCount, true), gl::IndexRange(0, 0));
+    restarts[5]          = kRestart;
+    restarts[kCount - 1] = 7;
+    EXPECT_EQ(ComputeIndexRange(type, restarts.data(), kCount, true), gl::IndexRange(7, 7));
+
+    // Unaligned start.
+    EXPECT_EQ(ComputeIndexRange(type, indices.data() + 1, kCount - 1, true),
+              gl::IndexRange(10, 59));
+}
+
+TEST(Utilities, LongIndexRanges)
+{
+    TestLongIndexRanges<GLubyte>(gl::DrawElementsType::UnsignedByte);
+    TestLongIndexRanges<GLushort>(gl::DrawElementsType::UnsignedShort);
+    TestLongIndexRanges<GLuint>(gl::DrawElementsType::UnsignedInt);
+}
+
 }  // anonymous namespace
@@ -7,11 +7,12 @@
 #ifndef COMPILER_PREPROCESSOR_MACRO_H_
 #define COMPILER_PREPROCESSOR_MACRO_H_
 
-#include <map>
 #include <memory>
 #include <string>
 #include <vector>
 
+#include "common/hash_containers.h"
+
 namespace angle
 {
 
@@ -44,7 +45,8 @@ struct Macro
     Replacements replacements;
 };
 
-typedef std::map<std::string, std::shared_ptr<Macro>> MacroSet;
+// Looked up for every identifier the preprocessor sees, so it's a hash map rather than a sorted map.
+typedef angle::HashMap<std::string, std::shared_ptr<Macro>> MacroSet;
 
 void PredefineMacro(MacroSet *macroSet, const char *name, int value);
 
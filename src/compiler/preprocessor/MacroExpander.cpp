@@ -142,7 +142,7 @@ void MacroExpander::lex(Token *token)
                 break;
             }
             auto iter              = mMacroSet->find(token->text);
-            std::string expression = iter != mMacroSet->end() ? "1" : "0";
+            const char *expression = iter != mMacroSet->end() ? "1" : "0";
 
             if (paren)
             {
@@ -209,7 +209,7 @@ void MacroExpander::getToken(Token *token)
 
     if (!mContextStack.empty())
     {
-        *token = mContextStack.back().get();
+        mContextStack.back().get(token);
     }
     else
     {
@@ -224,7 +224,12 @@ void MacroExpander::ungetToken(const Token &token)
     {
         MacroContext &context = mContextStack.back();
         context.unget();
-        ASSERT(context.replacements[context.index] == token);
+#if defined(ANGLE_ENABLE_ASSERTS)
+        Token replayed;
+        context.get(&replayed);
+        context.unget();
+        ASSERT(replayed == token);
+#endif
     }
     else
     {
@@ -252,14 +257,16 @@ bool MacroExpander::pushMacro(std::shared_ptr<Macro> macro, const Token &identif
     ASSERT(identifier.text == macro->name);
 
     std::vector<Token> replacements;
-    if (!expandMacro(*macro, identifier, &replacements))
+    SourceLocation replacementLocation;
+    if (!expandMacro(*macro, identifier, &replacements, &replacementLocation))
         return false;
 
     // Macro is disabled for expansion until it is popped off the stack.
     macro->disabled = true;
 
-    mTotalTokensInContexts += replacements.size();
-    mContextStack.emplace_back(std::move(macro), std::move(replacements));
+    mContextStack.emplace_back(std::move(macro), std::move(replacements), identifier,
+                               replacementLocation);
+    mTotalTokensInContexts += mContextStack.back().size();
     return true;
 }
 
@@ -282,12 +289,13 @@ void MacroExpander::popMacro()
         context.macro->disabled = false;
     }
     context.macro->expansionCount--;
-    mTotalTokensInContexts -= context.replacements.size();
+    mTotalTokensInContexts -= context.size();
 }
 
 bool MacroExpander::expandMacro(const Macro &macro,
                                 const Token &identifier,
-                                std::vector<Token> *replacements)
+                                std::vector<Token> *replacements,
+                                SourceLocation *replacementLocation)
 {
     replacements->clear();
 
@@ -295,16 +303,16 @@ bool MacroExpander::expandMacro(const Macro &macro,
     // from the identifier, but in the case of a function-like macro, the replacement
     // list gets its location from the closing parenthesis of the macro invocation.
     // This is tested by dEQP-GLES3.functional.shaders.preprocessor.predefined_macros.*
-    SourceLocation replacementLocation = identifier.location;
+    *replacementLocation = identifier.location;
     if (macro.type == Macro::kTypeObj)
     {
-        replacements->assign(macro.replacements.begin(), macro.replacements.end());
-
+        // The replacement list of other object-like macros is replayed from the macro itself.
         if (macro.predefined)
         {
             const char kLine[] = "__LINE__";
             const char kFile[] = "__FILE__";
 
+            replacements->assign(macro.replacements.begin(), macro.replacements.end());
             ASSERT(replacements->size() == 1);
             Token &repl = replacements->front();
             if (macro.name == kLine)
@@ -322,24 +330,11 @@ bool MacroExpander::expandMacro(const Macro &macro,
         ASSERT(macro.type == Macro::kTypeFunc);
         std::vector<MacroArg> args;
         args.reserve(macro.parameters.size());
-        if (!collectMacroArgs(macro, identifier, &args, &replacementLocation))
+        if (!collectMacroArgs(macro, identifier, &args, replacementLocation))
             return false;
 
         replaceMacroParams(macro, args, replacements);
     }
-
-    for (std::size_t i = 0; i < replacements->size(); ++i)
-    {
-        Token &repl = replacements->at(i);
-        if (i == 0)
-        {
-            // The first token in the replacement list inherits the padding
-            // properties of the identifier token.
-            repl.setAtStartOfLine(identifier.atStartOfLine());
-            repl.setHasLeadingSpace(identifier.hasLeadingSpace());
-        }
-        repl.location = replacementLocation;
-    }
     return true;
 }
 
@@ -503,14 +498,40 @@ void MacroExpander::replaceMacroParams(const Macro &macro,
     }
 }
 
+MacroExpander::MacroContext::MacroContext(std::shared_ptr<Macro> macroIn,
+                                          std::vector<Token> &&replacementsIn,
+                                          const Token &identifier,
+                                          const SourceLocation &locationIn)
+    : macro(std::move(macroIn)),
+      replacements(std::move(replacementsIn)),
+      replaysMacro(macro->type == Macro::kTypeObj && !macro->predefined),
+      atStartOfLine(identifier.atStartOfLine()),
+      hasLeadingSpace(identifier.hasLeadingSpace()),
+      location(locationIn)
+{}
+
 bool MacroExpander::MacroContext::empty() const
 {
-    return index == replacements.size();
+    return index == size();
 }
 
-const Token &MacroExpander::MacroContext::get()
+std::size_t MacroExpander::MacroContext::size() const
 {
-    return replacements[index++];
+    return tokens().size();
+}
+
+void MacroExpander::MacroContext::get(Token *token)
+{
+    *token = tokens()[index];
+    if (index == 0)
+    {
+        // The first token in the replacement list inherits the padding
+        // properties of the identifier token.
+        token->setAtStartOfLine(atStartOfLine);
+        token->setHasLeadingSpace(hasLeadingSpace);
+    }
+    token->location = location;
+    ++index;
 }
 
 void MacroExpander::MacroContext::unget()
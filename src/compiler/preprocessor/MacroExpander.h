@@ -44,7 +44,10 @@ class MacroExpander : public Lexer
     bool pushMacro(std::shared_ptr<Macro> macro, const Token &identifier);
     void popMacro();
 
-    bool expandMacro(const Macro &macro, const Token &identifier, std::vector<Token> *replacements);
+    bool expandMacro(const Macro &macro,
+                     const Token &identifier,
+                     std::vector<Token> *replacements,
+                     SourceLocation *replacementLocation);
 
     typedef std::vector<Token> MacroArg;
     bool collectMacroArgs(const Macro &macro,
@@ -55,18 +58,35 @@ class MacroExpander : public Lexer
                             const std::vector<MacroArg> &args,
                             std::vector<Token> *replacements);
 
+    // The tokens a macro invocation expands to.  Object-like macros are replayed directly from the
+    // macro's replacement list, while the replacement list of other macros is produced by
+    // expandMacro().  Either way, the tokens are adjusted for the invocation as they are read.
     struct MacroContext
     {
-        MacroContext(std::shared_ptr<Macro> macro, std::vector<Token> &&replacements)
-            : macro(std::move(macro)), replacements(std::move(replacements))
-        {}
+        MacroContext(std::shared_ptr<Macro> macro,
+                     std::vector<Token> &&replacements,
+                     const Token &identifier,
+                     const SourceLocation &location);
         bool empty() const;
-        const Token &get();
+        std::size_t size() const;
+        void get(Token *token);
         void unget();
 
         std::shared_ptr<Macro> macro;
         std::vector<Token> replacements;
+        bool replaysMacro;
+        // The padding of the macro name, which the first token inherits.
+        bool atStartOfLine;
+        bool hasLeadingSpace;
+        // The location of every token of the expansion.
+        SourceLocation location;
         std::size_t index = 0;
+
+      private:
+        const std::vector<Token> &tokens() const
+        {
+            return replaysMacro ? macro->replacements : replacements;
+        }
     };
 
     Lexer *mLexer;
@@ -7,16 +7,22 @@
 #include "compiler/translator/BuiltInFunctionEmulator.h"
 #include "angle_gl.h"
 #include "compiler/translator/Symbol.h"
-#include "compiler/translator/tree_util/IntermTraverse.h"
+#include "compiler/translator/tree_util/FusedTraverser.h"
 
 namespace sh
 {
 
-class BuiltInFunctionEmulator::BuiltInFunctionEmulationMarker : public TIntermTraverser
+class BuiltInFunctionEmulator::BuiltInFunctionEmulationMarker : public TFusableTraverser
 {
   public:
     BuiltInFunctionEmulationMarker(BuiltInFunctionEmulator &emulator)
-        : TIntermTraverser(true, false, false), mEmulator(emulator)
+        : TFusableTraverser(true,
+                            false,
+                            false,
+                            nullptr,
+                            FusedPassAccess::ReadOnly,
+                            TIntermNodeTypeSet{TIntermNodeType::Unary, TIntermNodeType::Aggregate}),
+          mEmulator(emulator)
     {}
 
     bool visitUnary(Visit visit, TIntermUnary *node) override
@@ -44,6 +50,8 @@ class BuiltInFunctionEmulator::BuiltInFunctionEmulationMarker : public TIntermTr
         return true;
     }
 
+    bool finishTraversal(TCompiler *compiler, TIntermBlock *root) override { return true; }
+
   private:
     BuiltInFunctionEmulator &mEmulator;
 };
@@ -140,6 +148,14 @@ void BuiltInFunctionEmulator::markBuiltInFunctionsForEmulation(TIntermNode *root
     root->traverse(&marker);
 }
 
+void BuiltInFunctionEmulator::markBuiltInFunctionsForEmulation(TFusedTraverser *fusedTraverser)
+{
+    if (mEmulatedFunctions.empty() && mQueryFunctions.empty())
+        return;
+
+    fusedTraverser->addTraverser(new BuiltInFunctionEmulationMarker(*this));
+}
+
 void BuiltInFunctionEmulator::cleanup()
 {
     mFunctions.clear();
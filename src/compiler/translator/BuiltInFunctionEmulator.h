@@ -12,6 +12,7 @@
 namespace sh
 {
 
+class TFusedTraverser;
 class TIntermNode;
 class TFunction;
 class TSymbolUniqueId;
@@ -29,6 +30,8 @@ class BuiltInFunctionEmulator
     BuiltInFunctionEmulator();
 
     void markBuiltInFunctionsForEmulation(TIntermNode *root);
+    // Same as above, as part of the walk of |fusedTraverser|.
+    void markBuiltInFunctionsForEmulation(TFusedTraverser *fusedTraverser);
 
     void cleanup();
 
@@ -0,0 +1,217 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// CompileResultCache.cpp: A process-wide cache of compilation results.
+
+#include "compiler/translator/CompileResultCache.h"
+
+#include <cstring>
+
+#include "common/base/anglebase/no_destructor.h"
+#include "compiler/translator/util.h"
+#include "xxhash.h"
+
+namespace sh
+{
+
+namespace
+{
+constexpr unsigned long long kKeyHashSeed = 0x5F3C9A71;
+
+template <typename T>
+void AppendKeyBytes(std::string *key, const T &value)
+{
+    key->append(reinterpret_cast<const char *>(&value), sizeof(value));
+}
+
+// Serializes everything the results of a compilation depend on.  ShCompileOptions and
+// ShBuiltInResources are zero-initialized and copied with memcpy, so their padding is always zero
+// and they can be serialized as a whole.
+std::string SerializeKey(const TCompiler *compiler,
+                         const char *const shaderStrings[],
+                         size_t numStrings,
+                         const ShCompileOptions &compileOptions)
+{
+    std::string key;
+
+    AppendKeyBytes(&key, compiler->getShaderType());
+    AppendKeyBytes(&key, compiler->getShaderSpec());
+    AppendKeyBytes(&key, compiler->getOutputType());
+    AppendKeyBytes(&key, compiler->getBuiltInResources());
+    AppendKeyBytes(&key, compileOptions);
+
+    // The length of each string is included, as the results depend on the string boundaries
+    // (e.g. through __LINE__ and the error locations).
+    AppendKeyBytes(&key, numStrings);
+    for (size_t index = 0; index < numStrings; ++index)
+    {
+        const size_t length = strlen(shaderStrings[index]);
+        AppendKeyBytes(&key, length);
+        key.append(shaderStrings[index], length);
+    }
+
+    return key;
+}
+
+template <typename VarT>
+size_t GetVariablesSize(const std::vector<VarT> &variables)
+{
+    // Approximate, as the names and fields of the variables are not included.
+    return variables.size() * sizeof(VarT);
+}
+
+size_t GetResultSize(const CompileResult &result)
+{
+    return sizeof(result) + result.infoLog.size() + result.objectCode.size() +
+           result.objectBinary.size() * sizeof(result.objectBinary[0]) +
+           GetVariablesSize(result.attributes) + GetVariablesSize(result.outputVariables) +
+           GetVariablesSize(result.uniforms) + GetVariablesSize(result.inputVaryings) +
+           GetVariablesSize(result.outputVaryings) + GetVariablesSize(result.sharedVariables) +
+           GetVariablesSize(result.interfaceBlocks) + GetVariablesSize(result.uniformBlocks) +
+           GetVariablesSize(result.shaderStorageBlocks);
+}
+}  // anonymous namespace
+
+CompileResult::CompileResult() = default;
+CompileResult::~CompileResult() = default;
+
+CompileResultCache::CompileResultCache() : mHits(0), mMisses(0), mEvictions(0) {}
+
+CompileResultCache::~CompileResultCache() = default;
+
+// static
+CompileResultCache *CompileResultCache::Get()
+{
+    static angle::base::NoDestructor<CompileResultCache> sCache;
+    return sCache.get();
+}
+
+// static
+bool CompileResultCache::CanMemoize(const TCompiler *compiler,
+                                    const ShCompileOptions &compileOptions)
+{
+    // The HLSL translator keeps register assignments that are queried separately.  Pass
+    // statistics are only meaningful if the passes actually run.
+    return compileOptions.memoizeCompileResults && !compileOptions.recordPassStatistics &&
+           !IsOutputHLSL(compiler->getOutputType());
+}
+
+bool CompileResultCache::compile(TCompiler *compiler,
+                                 const char *const shaderStrings[],
+                                 size_t numStrings,
+                                 const ShCompileOptions &compileOptions)
+{
+    ASSERT(CanMemoize(compiler, compileOptions));
+
+    std::string key        = SerializeKey(compiler, shaderStrings, numStrings, compileOptions);
+    const uint64_t keyHash = XXH64(key.data(), key.size(), kKeyHashSeed);
+    // The low bits of the hash select the bucket within the stripe, so use the high bits here.
+    Stripe *stripe = &mStripes[(keyHash >> 56) % kStripeCount];
+
+    std::shared_ptr<const CompileResult> cachedResult = find(stripe, key, keyHash);
+    if (cachedResult)
+    {
+        mHits++;
+        compiler->restoreResults(*cachedResult);
+        return cachedResult->success;
+    }
+    mMisses++;
+
+    const bool success = compiler->compile(shaderStrings, numStrings, compileOptions);
+
+    std::shared_ptr<CompileResult> result = std::make_shared<CompileResult>();
+    result->success                       = success;
+    compiler->saveResults(result.get());
+    insert(stripe, std::move(key), keyHash, std::move(result));
+    return success;
+}
+
+std::shared_ptr<const CompileResult> CompileResultCache::find(Stripe *stripe,
+                                                              const std::string &key,
+                                                              uint64_t keyHash)
+{
+    std::lock_guard<std::mutex> lock(stripe->mutex);
+
+    auto iter = stripe->lookup.find(keyHash);
+    if (iter == stripe->lookup.end() || iter->second->key != key)
+    {
+        return nullptr;
+    }
+
+    // Mark the entry as most recently used.
+    stripe->entries.splice(stripe->entries.begin(), stripe->entries, iter->second);
+    return iter->second->result;
+}
+
+void CompileResultCache::insert(Stripe *stripe,
+                                std::string &&key,
+                                uint64_t keyHash,
+                                std::shared_ptr<const CompileResult> &&result)
+{
+    const size_t size = key.size() + GetResultSize(*result);
+    if (size > kStripeByteBudget)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(stripe->mutex);
+
+    // Another thread may have compiled the same shader in the meantime, or a different key may
+    // have the same hash.  Either way, the newer result replaces the older one.
+    auto iter = stripe->lookup.find(keyHash);
+    if (iter != stripe->lookup.end())
+    {
+        stripe->totalBytes -= iter->second->size;
+        stripe->entries.erase(iter->second);
+        stripe->lookup.erase(iter);
+    }
+
+    stripe->entries.push_front({std::move(key), keyHash, size, std::move(result)});
+    stripe->lookup[keyHash] = stripe->entries.begin();
+    stripe->totalBytes += size;
+
+    while (stripe->totalBytes > kStripeByteBudget)
+    {
+        const Entry &leastRecentlyUsed = stripe->entries.back();
+        stripe->totalBytes -= leastRecentlyUsed.size;
+        stripe->lookup.erase(leastRecentlyUsed.keyHash);
+        stripe->entries.pop_back();
+        mEvictions++;
+    }
+}
+
+ShCompileResultCacheStatistics CompileResultCache::getStatistics() const
+{
+    ShCompileResultCacheStatistics statistics = {};
+    statistics.hits                           = mHits;
+    statistics.misses                         = mMisses;
+    statistics.evictions                      = mEvictions;
+
+    for (const Stripe &stripe : mStripes)
+    {
+        std::lock_guard<std::mutex> lock(stripe.mutex);
+        statistics.entryCount += stripe.entries.size();
+        statistics.totalBytes += stripe.totalBytes;
+    }
+
+    return statistics;
+}
+
+void CompileResultCache::clear()
+{
+    for (Stripe &stripe : mStripes)
+    {
+        std::lock_guard<std::mutex> lock(stripe.mutex);
+        stripe.entries.clear();
+        stripe.lookup.clear();
+        stripe.totalBytes = 0;
+    }
+
+    mHits      = 0;
+    mMisses    = 0;
+    mEvictions = 0;
+}
+
+}  // namespace sh
@@ -0,0 +1,145 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// CompileResultCache.h: A process-wide cache of compilation results, used by compilations with
+//   ShCompileOptions::memoizeCompileResults.  Results are keyed by the shader source and all the
+//   parameters of the compiler that affect it, so compilers with the same parameters share them
+//   without running the translator again.
+
+#ifndef COMPILER_TRANSLATOR_COMPILERESULTCACHE_H_
+#define COMPILER_TRANSLATOR_COMPILERESULTCACHE_H_
+
+#include <array>
+#include <atomic>
+#include <list>
+#include <memory>
+#include <mutex>
+
+#include "common/angleutils.h"
+#include "common/hash_containers.h"
+#include "compiler/translator/Compiler.h"
+
+namespace sh
+{
+
+// The results of a compilation, as queried through the ShaderLang.h API.  Once in the cache, a
+// result is never modified.
+struct CompileResult
+{
+    CompileResult();
+    ~CompileResult();
+
+    bool success;
+
+    std::string infoLog;
+    std::string objectCode;
+    BinaryBlob objectBinary;
+
+    int shaderVersion;
+    MetadataFlagBits metadataFlags;
+    SpecConstUsageBits specConstUsageBits;
+    bool earlyFragmentTestsSpecified;
+    bool computeShaderLocalSizeDeclared;
+    WorkGroupSize computeShaderLocalSize;
+    int numViews;
+    uint8_t clipDistanceSize;
+    uint8_t cullDistanceSize;
+
+    int geometryShaderMaxVertices;
+    int geometryShaderInvocations;
+    TLayoutPrimitiveType geometryShaderInputPrimitiveType;
+    TLayoutPrimitiveType geometryShaderOutputPrimitiveType;
+
+    int tessControlShaderOutputVertices;
+    TLayoutTessEvaluationType tessEvaluationShaderInputPrimitiveType;
+    TLayoutTessEvaluationType tessEvaluationShaderInputVertexSpacingType;
+    TLayoutTessEvaluationType tessEvaluationShaderInputOrderingType;
+    TLayoutTessEvaluationType tessEvaluationShaderInputPointType;
+
+    bool hasAnyPreciseType;
+    bool usesDerivatives;
+    AdvancedBlendEquations advancedBlendEquations;
+    std::vector<ShPixelLocalStorageFormat> pixelLocalStorageFormats;
+
+    std::vector<ShaderVariable> attributes;
+    std::vector<ShaderVariable> outputVariables;
+    std::vector<ShaderVariable> uniforms;
+    std::vector<ShaderVariable> inputVaryings;
+    std::vector<ShaderVariable> outputVaryings;
+    std::vector<ShaderVariable> sharedVariables;
+    std::vector<InterfaceBlock> interfaceBlocks;
+    std::vector<InterfaceBlock> uniformBlocks;
+    std::vector<InterfaceBlock> shaderStorageBlocks;
+
+    NameMap nameMap;
+};
+
+// The cache is split in stripes, each with its own lock and memory budget, so that compilations
+// on different threads rarely wait for each other.  Within a stripe, the least recently used
+// results are evicted first.
+class CompileResultCache : angle::NonCopyable
+{
+  public:
+    CompileResultCache();
+    ~CompileResultCache();
+
+    static CompileResultCache *Get();
+
+    // Whether the compilation can use the cache.  Some outputs keep results the cache doesn't
+    // know about in the translator.
+    static bool CanMemoize(const TCompiler *compiler, const ShCompileOptions &compileOptions);
+
+    // Restores the results of the compilation from the cache if found, otherwise compiles the
+    // shader and adds its results to the cache.  Returns whether the compilation succeeded.
+    bool compile(TCompiler *compiler,
+                 const char *const shaderStrings[],
+                 size_t numStrings,
+                 const ShCompileOptions &compileOptions);
+
+    ShCompileResultCacheStatistics getStatistics() const;
+    void clear();
+
+  private:
+    static constexpr size_t kStripeCount = 16;
+    // Results are mostly translated source or SPIR-V, which are rarely larger than a few tens of
+    // kilobytes.  A result larger than the budget of a stripe is not cached.
+    static constexpr size_t kStripeByteBudget = 1024 * 1024;
+
+    struct Entry
+    {
+        // The serialized key, compared on lookup to rule out hash collisions.
+        std::string key;
+        uint64_t keyHash;
+        size_t size;
+        std::shared_ptr<const CompileResult> result;
+    };
+
+    struct Stripe
+    {
+        mutable std::mutex mutex;
+        // Most recently used first.
+        std::list<Entry> entries;
+        angle::HashMap<uint64_t, std::list<Entry>::iterator> lookup;
+        size_t totalBytes = 0;
+    };
+
+    std::shared_ptr<const CompileResult> find(Stripe *stripe,
+                                              const std::string &key,
+                                              uint64_t keyHash);
+    void insert(Stripe *stripe,
+                std::string &&key,
+                uint64_t keyHash,
+                std::shared_ptr<const CompileResult> &&result);
+
+    std::array<Stripe, kStripeCount> mStripes;
+
+    std::atomic<uint64_t> mHits;
+    std::atomic<uint64_t> mMisses;
+    std::atomic<uint64_t> mEvictions;
+};
+
+}  // namespace sh
+
+#endif  // COMPILER_TRANSLATOR_COMPILERESULTCACHE_H_
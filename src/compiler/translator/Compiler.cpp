@@ -14,9 +14,11 @@
 #include "common/CompiledShaderState.h"
 #include "common/PackedEnums.h"
 #include "common/angle_version_info.h"
+#include "common/system_utils.h"
 
 #include "compiler/translator/CallDAG.h"
 #include "compiler/translator/CollectVariables.h"
+#include "compiler/translator/CompileResultCache.h"
 #include "compiler/translator/Initialize.h"
 #include "compiler/translator/IsASTDepthBelowLimit.h"
 #include "compiler/translator/OutputTree.h"
@@ -40,6 +42,8 @@
 #include "compiler/translator/tree_ops/ForcePrecisionQualifier.h"
 #include "compiler/translator/tree_ops/InitializeVariables.h"
 #include "compiler/translator/tree_ops/MonomorphizeUnsupportedFunctions.h"
+#include "compiler/translator/tree_ops/PropagateLocalValues.h"
+#include "compiler/translator/tree_ops/PruneConstantBranches.h"
 #include "compiler/translator/tree_ops/PruneEmptyCases.h"
 #include "compiler/translator/tree_ops/PruneInfiniteLoops.h"
 #include "compiler/translator/tree_ops/PruneNoOps.h"
@@ -63,6 +67,7 @@
 #include "compiler/translator/tree_ops/glsl/apple/UnfoldShortCircuitAST.h"
 #include "compiler/translator/tree_util/BuiltIn.h"
 #include "compiler/translator/tree_util/FindSymbolNode.h"
+#include "compiler/translator/tree_util/FusedTraverser.h"
 #include "compiler/translator/tree_util/IntermNodePatternMatcher.h"
 #include "compiler/translator/tree_util/ReplaceShadowingVariables.h"
 #include "compiler/translator/tree_util/ReplaceVariable.h"
@@ -364,6 +369,24 @@ bool ValidateFragColorAndFragData(GLenum shaderType,
     return true;
 }
 
+size_t CountNodes(TIntermNode *root)
+{
+    size_t count = 0;
+    std::vector<TIntermNode *> nodes{root};
+    while (!nodes.empty())
+    {
+        TIntermNode *node = nodes.back();
+        nodes.pop_back();
+        ++count;
+
+        for (size_t childIndex = 0; childIndex < node->getChildCount(); ++childIndex)
+        {
+            nodes.push_back(node->getChildNode(childIndex));
+        }
+    }
+    return count;
+}
+
 }  // namespace
 
 TShHandleBase::TShHandleBase()
@@ -401,7 +424,10 @@ TCompiler::TCompiler(sh::GLenum type, ShShaderSpec spec, ShShaderOutput output)
       mHasAnyPreciseType(false),
       mAdvancedBlendEquations(0),
       mUsesDerivatives(false),
-      mCompileOptions{}
+      mCompileOptions{},
+      mPassStartTime(0),
+      mPassStartPoolBytes(0),
+      mPassStartNodeCount(0)
 {}
 
 TCompiler::~TCompiler() {}
@@ -466,6 +492,11 @@ TIntermBlock *TCompiler::compileTreeImpl(const char *const shaderStrings[],
     ASSERT(numStrings > 0);
     ASSERT(GetGlobalPoolAllocator());
 
+    if (compileOptions.recordPassStatistics)
+    {
+        beginPassStatistics();
+    }
+
     // Reset the extension behavior for each compilation unit.
     ResetExtensionBehavior(mResources, mExtensionBehavior, compileOptions);
 
@@ -530,6 +561,8 @@ TIntermBlock *TCompiler::compileTreeImpl(const char *const shaderStrings[],
     }
 
     TIntermBlock *root = parseContext.getTreeRoot();
+    recordPassStatistics("Parse", root);
+
     if (!checkAndSimplifyAST(root, parseContext, compileOptions))
     {
         return nullptr;
@@ -792,9 +825,13 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     // Disallow expressions deemed too complex.
     // This needs to be checked before other functions that will traverse the AST
     // to prevent potential stack overflow crashes.
-    if (compileOptions.limitExpressionComplexity && !limitExpressionComplexity(root))
+    if (compileOptions.limitExpressionComplexity)
     {
-        return false;
+        if (!limitExpressionComplexity(root))
+        {
+            return false;
+        }
+        recordPassStatistics("LimitExpressionComplexity", root);
     }
 
     if (!validateAST(root))
@@ -813,6 +850,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         {
             return false;
         }
+        recordPassStatistics("RemoveUnusedFramebufferFetch", root);
     }
 
     // For now, rewrite pixel local storage before collecting variables or any operations on images.
@@ -831,18 +869,23 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
             mDiagnostics.globalError("internal compiler error translating pixel local storage");
             return false;
         }
+        recordPassStatistics("RewritePixelLocalStorage", root);
     }
 
-    if (shouldRunLoopAndIndexingValidation(compileOptions) &&
-        !ValidateLimitations(root, mShaderType, &mSymbolTable, &mDiagnostics))
+    if (shouldRunLoopAndIndexingValidation(compileOptions))
     {
-        return false;
+        if (!ValidateLimitations(root, mShaderType, &mSymbolTable, &mDiagnostics))
+        {
+            return false;
+        }
+        recordPassStatistics("ValidateLimitations", root);
     }
 
     if (!ValidateFragColorAndFragData(mShaderType, mShaderVersion, mSymbolTable, &mDiagnostics))
     {
         return false;
     }
+    recordPassStatistics("ValidateFragColorAndFragData", root);
 
     // Fold expressions that could not be folded before validation that was done as a part of
     // parsing.
@@ -850,6 +893,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     {
         return false;
     }
+    recordPassStatistics("FoldExpressions", root);
     // Folding should only be able to generate warnings.
     ASSERT(mDiagnostics.numErrors() == 0);
 
@@ -869,13 +913,18 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         {
             return false;
         }
+        recordPassStatistics("ValidateClipCullDistance", root);
         mMetadataFlags[MetadataFlags::HasClipDistance] = isClipDistanceUsed;
     }
 
     // Validate no barrier() after return before prunning it in |PruneNoOps()| below.
-    if (mShaderType == GL_TESS_CONTROL_SHADER && !ValidateBarrierFunctionCall(root, &mDiagnostics))
+    if (mShaderType == GL_TESS_CONTROL_SHADER)
     {
-        return false;
+        if (!ValidateBarrierFunctionCall(root, &mDiagnostics))
+        {
+            return false;
+        }
+        recordPassStatistics("ValidateBarrierFunctionCall", root);
     }
 
     // We prune no-ops to work around driver bugs and to keep AST processing and output simple.
@@ -890,6 +939,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     {
         return false;
     }
+    recordPassStatistics("PruneNoOps", root);
     mValidateASTOptions.validateNoStatementsAfterBranch = true;
 
     // We need to generate globals early if we have non constant initializers enabled
@@ -913,12 +963,15 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     // This is because MSL doesn't allow statically initialized non-const globals.
     bool forceDeferNonConstGlobalInitializers = getOutputType() == SH_MSL_METAL_OUTPUT;
 
-    if (enableNonConstantInitializers &&
-        !DeferGlobalInitializers(this, root, initializeLocalsAndGlobals, canUseLoopsToInitialize,
-                                 highPrecisionSupported, forceDeferNonConstGlobalInitializers,
-                                 &mSymbolTable))
+    if (enableNonConstantInitializers)
     {
-        return false;
+        if (!DeferGlobalInitializers(this, root, initializeLocalsAndGlobals,
+                                     canUseLoopsToInitialize, highPrecisionSupported,
+                                     forceDeferNonConstGlobalInitializers, &mSymbolTable))
+        {
+            return false;
+        }
+        recordPassStatistics("DeferGlobalInitializers", root);
     }
 
     // Create the function DAG and check there is no recursion
@@ -926,10 +979,15 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     {
         return false;
     }
+    recordPassStatistics("InitCallDag", root);
 
-    if (compileOptions.limitCallStackDepth && !checkCallDepth())
+    if (compileOptions.limitCallStackDepth)
     {
-        return false;
+        if (!checkCallDepth())
+        {
+            return false;
+        }
+        recordPassStatistics("CheckCallDepth", root);
     }
 
     // Checks which functions are used and if "main" exists
@@ -944,6 +1002,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     {
         return false;
     }
+    recordPassStatistics("PruneUnusedFunctions", root);
 
     if (IsSpecWithFunctionBodyNewScope(mShaderSpec, mShaderVersion))
     {
@@ -951,27 +1010,43 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         {
             return false;
         }
+        recordPassStatistics("ReplaceShadowingVariables", root);
     }
 
-    if (mShaderVersion >= 310 && !ValidateVaryingLocations(root, &mDiagnostics, mShaderType))
+    // Validate the shader interface in a single walk of the tree.
     {
-        return false;
+        TFusedTraverser validateInterface;
+        if (mShaderVersion >= 310)
+        {
+            ValidateVaryingLocations(&validateInterface, &mDiagnostics, mShaderType);
+        }
+        if (mShaderVersion >= 300 && mShaderType == GL_FRAGMENT_SHADER)
+        {
+            ValidateOutputs(&validateInterface, getExtensionBehavior(), mResources,
+                            hasPixelLocalStorageUniforms(), IsWebGLBasedSpec(mShaderSpec),
+                            &mDiagnostics);
+        }
+        if (!validateInterface.empty())
+        {
+            if (!validateInterface.run(this, root))
+            {
+                return false;
+            }
+            recordPassStatistics("ValidateVaryingLocations+ValidateOutputs", root);
+        }
     }
 
     // anglebug.com/42265954: The ESSL spec has a bug with images as function arguments. The
     // recommended workaround is to inline functions that accept image arguments.
-    if (mShaderVersion >= 310 && !MonomorphizeUnsupportedFunctions(
-                                     this, root, &mSymbolTable,
-                                     UnsupportedFunctionArgsBitSet{UnsupportedFunctionArgs::Image}))
-    {
-        return false;
-    }
-
-    if (mShaderVersion >= 300 && mShaderType == GL_FRAGMENT_SHADER &&
-        !ValidateOutputs(root, getExtensionBehavior(), mResources, hasPixelLocalStorageUniforms(),
-                         IsWebGLBasedSpec(mShaderSpec), &mDiagnostics))
+    if (mShaderVersion >= 310)
     {
-        return false;
+        if (!MonomorphizeUnsupportedFunctions(
+                this, root, &mSymbolTable,
+                UnsupportedFunctionArgsBitSet{UnsupportedFunctionArgs::Image}))
+        {
+            return false;
+        }
+        recordPassStatistics("MonomorphizeUnsupportedFunctions", root);
     }
 
     // Clamping uniform array bounds needs to happen after validateLimitations pass.
@@ -981,6 +1056,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         {
             return false;
         }
+        recordPassStatistics("ClampIndirectIndices", root);
     }
 
     if (compileOptions.initializeBuiltinsForInstancedMultiview &&
@@ -993,6 +1069,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         {
             return false;
         }
+        recordPassStatistics("DeclareAndInitBuiltinsForInstancedMultiview", root);
     }
 
     // This pass might emit short circuits so keep it before the short circuit unfolding
@@ -1002,6 +1079,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         {
             return false;
         }
+        recordPassStatistics("RewriteDoWhile", root);
     }
 
     if (compileOptions.addAndTrueToLoopCondition)
@@ -1010,6 +1088,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         {
             return false;
         }
+        recordPassStatistics("AddAndTrueToLoopCondition", root);
     }
 
     if (compileOptions.unfoldShortCircuit)
@@ -1018,6 +1097,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         {
             return false;
         }
+        recordPassStatistics("UnfoldShortCircuitAST", root);
     }
 
     if (compileOptions.regenerateStructNames)
@@ -1026,6 +1106,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         {
             return false;
         }
+        recordPassStatistics("RegenerateStructNames", root);
     }
 
     if (mShaderType == GL_VERTEX_SHADER &&
@@ -1037,6 +1118,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
             {
                 return false;
             }
+            recordPassStatistics("EmulateGLDrawID", root);
         }
     }
 
@@ -1051,6 +1133,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
             {
                 return false;
             }
+            recordPassStatistics("EmulateGLBaseVertexBaseInstance", root);
         }
     }
 
@@ -1064,6 +1147,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         {
             return false;
         }
+        recordPassStatistics("EmulateGLFragColorBroadcast", root);
     }
 
     if (compileOptions.simplifyLoopConditions)
@@ -1072,6 +1156,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         {
             return false;
         }
+        recordPassStatistics("SimplifyLoopConditions", root);
     }
     else
     {
@@ -1085,6 +1170,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         {
             return false;
         }
+        recordPassStatistics("SimplifyLoopConditions", root);
     }
 
     // Note that separate declarations need to be run before other AST transformations that
@@ -1093,6 +1179,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     {
         return false;
     }
+    recordPassStatistics("SeparateDeclarations", root);
 
     if (IsWebGLBasedSpec(mShaderSpec))
     {
@@ -1102,6 +1189,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         {
             return false;
         }
+        recordPassStatistics("PruneInfiniteLoops", root);
 
         // If requested, reject shaders with infinite loops.  If not requested, the same loops are
         // removed from the shader as a fallback.
@@ -1118,6 +1206,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         {
             return false;
         }
+        recordPassStatistics("RescopeGlobalVariables", root);
     }
 
     mValidateASTOptions.validateMultiDeclarations = true;
@@ -1127,45 +1216,60 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     {
         return false;
     }
+    recordPassStatistics("SplitSequenceOperator", root);
 
     if (!RemoveArrayLengthMethod(this, root))
     {
         return false;
     }
+    recordPassStatistics("RemoveArrayLengthMethod", root);
     // Fold the expressions again, because |RemoveArrayLengthMethod| can introduce new constants.
     if (!FoldExpressions(this, root, &mDiagnostics))
     {
         return false;
     }
+    recordPassStatistics("FoldExpressions", root);
 
     if (!RemoveUnreferencedVariables(this, root, &mSymbolTable))
     {
         return false;
     }
+    recordPassStatistics("RemoveUnreferencedVariables", root);
 
-    // In case the last case inside a switch statement is a certain type of no-op, GLSL compilers in
-    // drivers may not accept it. In this case we clean up the dead code from the end of switch
-    // statements. This is also required because PruneNoOps or RemoveUnreferencedVariables may have
-    // left switch statements that only contained an empty declaration inside the final case in an
-    // invalid state. Relies on that PruneNoOps and RemoveUnreferencedVariables have already been
-    // run.
-    if (!PruneEmptyCases(this, root))
+    // The following passes run in a single walk of the tree.
     {
-        return false;
-    }
+        TFusedTraverser fusedTraverser;
 
-    // Run after RemoveUnreferencedVariables, validate that the shader does not have excessively
-    // large variables.
-    if (shouldLimitTypeSizes() && !ValidateTypeSizeLimitations(root, &mSymbolTable, &mDiagnostics))
-    {
-        return false;
-    }
+        // Run after RemoveUnreferencedVariables, validate that the shader does not have
+        // excessively large variables.
+        if (shouldLimitTypeSizes())
+        {
+            ValidateTypeSizeLimitations(&fusedTraverser, &mSymbolTable, &mDiagnostics);
+        }
 
-    // Built-in function emulation needs to happen after validateLimitations pass.
-    GetGlobalPoolAllocator()->lock();
-    initBuiltInFunctionEmulator(&mBuiltInFunctionEmulator, compileOptions);
-    GetGlobalPoolAllocator()->unlock();
-    mBuiltInFunctionEmulator.markBuiltInFunctionsForEmulation(root);
+        // Built-in function emulation needs to happen after validateLimitations pass.
+        GetGlobalPoolAllocator()->lock();
+        initBuiltInFunctionEmulator(&mBuiltInFunctionEmulator, compileOptions);
+        GetGlobalPoolAllocator()->unlock();
+        mBuiltInFunctionEmulator.markBuiltInFunctionsForEmulation(&fusedTraverser);
+
+        // In case the last case inside a switch statement is a certain type of no-op, GLSL
+        // compilers in drivers may not accept it. In this case we clean up the dead code from the
+        // end of switch statements. This is also required because PruneNoOps or
+        // RemoveUnreferencedVariables may have left switch statements that only contained an
+        // empty declaration inside the final case in an invalid state. Relies on that PruneNoOps
+        // and RemoveUnreferencedVariables have already been run.
+        //
+        // This rewrites the tree, so it must be the last pass of the walk.
+        PruneEmptyCases(&fusedTraverser);
+
+        if (!fusedTraverser.run(this, root))
+        {
+            return false;
+        }
+        recordPassStatistics("ValidateTypeSizeLimitations+EmulateBuiltInFunctions+PruneEmptyCases",
+                             root);
+    }
 
     if (compileOptions.scalarizeVecAndMatConstructorArgs)
     {
@@ -1173,6 +1277,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         {
             return false;
         }
+        recordPassStatistics("ScalarizeVecAndMatConstructorArgs", root);
     }
 
     if (compileOptions.forceShaderPrecisionHighpToMediump)
@@ -1181,6 +1286,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         {
             return false;
         }
+        recordPassStatistics("ForceShaderPrecisionToMediump", root);
     }
 
     ASSERT(!mVariablesCollected);
@@ -1190,12 +1296,52 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
                      mResources, mTessControlShaderOutputVertices);
     collectInterfaceBlocks();
     mVariablesCollected = true;
+    recordPassStatistics("CollectVariables", root);
+
+    // Optimize after collecting the variables, so that the variables used only in the pruned code
+    // are still reported as statically used.
+    if (compileOptions.optimizeAST)
+    {
+        if (!PropagateLocalValues(this, root, &mSymbolTable))
+        {
+            return false;
+        }
+        recordPassStatistics("PropagateLocalValues", root);
+
+        // Fold the expressions whose operands became constant, and then the branches on them.
+        if (!FoldExpressions(this, root, &mDiagnostics))
+        {
+            return false;
+        }
+        recordPassStatistics("FoldExpressions", root);
+
+        if (!PruneConstantBranches(this, root))
+        {
+            return false;
+        }
+        recordPassStatistics("PruneConstantBranches", root);
+
+        // Remove the locals that are no longer used, and the cases that pruning left empty.
+        if (!RemoveUnreferencedVariables(this, root, &mSymbolTable))
+        {
+            return false;
+        }
+        recordPassStatistics("RemoveUnreferencedVariables", root);
+
+        if (!PruneEmptyCases(this, root))
+        {
+            return false;
+        }
+        recordPassStatistics("PruneEmptyCases", root);
+    }
+
     if (compileOptions.useUnusedStandardSharedBlocks)
     {
         if (!useAllMembersInUnusedStandardAndSharedBlocks(root))
         {
             return false;
         }
+        recordPassStatistics("UseAllMembersInUnusedStandardAndSharedBlocks", root);
     }
     if (compileOptions.enforcePackingRestrictions)
     {
@@ -1211,6 +1357,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
             mDiagnostics.globalError("too many uniforms");
             return false;
         }
+        recordPassStatistics("CheckVariablesInPackingLimits", root);
     }
 
     // Remove declarations of inactive shader interface variables so backends don't need to account
@@ -1228,6 +1375,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         {
             return false;
         }
+        recordPassStatistics("RemoveInactiveInterfaceVariables", root);
     }
 
     bool needInitializeOutputVariables =
@@ -1240,6 +1388,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         {
             return false;
         }
+        recordPassStatistics("InitializeOutputVariables", root);
     }
 
     // Removing invariant declarations must be done after collecting variables.
@@ -1250,6 +1399,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         {
             return false;
         }
+        recordPassStatistics("RemoveInvariantDeclaration", root);
     }
 
     // gl_Position is always written in compatibility output mode.
@@ -1263,6 +1413,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
             return false;
         }
         mGLPositionInitialized = true;
+        recordPassStatistics("InitializeGLPosition", root);
     }
 
     // DeferGlobalInitializers needs to be run before other AST transformations that generate new
@@ -1272,12 +1423,15 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     // Exception: if EXT_shader_non_constant_global_initializers is enabled, we must generate global
     // initializers before we generate the DAG, since initializers may call functions which must not
     // be optimized out
-    if (!enableNonConstantInitializers &&
-        !DeferGlobalInitializers(this, root, initializeLocalsAndGlobals, canUseLoopsToInitialize,
-                                 highPrecisionSupported, forceDeferNonConstGlobalInitializers,
-                                 &mSymbolTable))
+    if (!enableNonConstantInitializers)
     {
-        return false;
+        if (!DeferGlobalInitializers(this, root, initializeLocalsAndGlobals,
+                                     canUseLoopsToInitialize, highPrecisionSupported,
+                                     forceDeferNonConstGlobalInitializers, &mSymbolTable))
+        {
+            return false;
+        }
+        recordPassStatistics("DeferGlobalInitializers", root);
     }
 
     if (initializeLocalsAndGlobals)
@@ -1299,6 +1453,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
             {
                 return false;
             }
+            recordPassStatistics("SimplifyLoopConditions", root);
         }
 
         if (!InitializeUninitializedLocals(this, root, getShaderVersion(), canUseLoopsToInitialize,
@@ -1306,6 +1461,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         {
             return false;
         }
+        recordPassStatistics("InitializeUninitializedLocals", root);
     }
 
     if (getShaderType() == GL_VERTEX_SHADER && compileOptions.clampPointSize)
@@ -1315,6 +1471,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         {
             return false;
         }
+        recordPassStatistics("ClampPointSize", root);
     }
 
     if (getShaderType() == GL_FRAGMENT_SHADER && compileOptions.clampFragDepth)
@@ -1323,6 +1480,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         {
             return false;
         }
+        recordPassStatistics("ClampFragDepth", root);
     }
 
     if (compileOptions.rewriteRepeatedAssignToSwizzled)
@@ -1331,6 +1489,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         {
             return false;
         }
+        recordPassStatistics("RewriteRepeatedAssignToSwizzled", root);
     }
 
     if (compileOptions.removeDynamicIndexingOfSwizzledVector)
@@ -1339,6 +1498,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         {
             return false;
         }
+        recordPassStatistics("RemoveDynamicIndexingOfSwizzledVector", root);
     }
 
     return true;
@@ -1652,6 +1812,136 @@ void TCompiler::clearResults()
     mSourcePath = nullptr;
 
     mSymbolTable.clearCompilationResults();
+
+    mPassStatistics.clear();
+}
+
+void TCompiler::saveResults(CompileResult *resultOut) const
+{
+    resultOut->infoLog = mInfoSink.info.str();
+    if (mInfoSink.obj.isBinary())
+    {
+        resultOut->objectBinary = mInfoSink.obj.getBinary();
+    }
+    else
+    {
+        resultOut->objectCode = mInfoSink.obj.str();
+    }
+
+    resultOut->shaderVersion                  = mShaderVersion;
+    resultOut->metadataFlags                  = mMetadataFlags;
+    resultOut->specConstUsageBits             = mSpecConstUsageBits;
+    resultOut->earlyFragmentTestsSpecified    = mEarlyFragmentTestsSpecified;
+    resultOut->computeShaderLocalSizeDeclared = mComputeShaderLocalSizeDeclared;
+    resultOut->computeShaderLocalSize         = mComputeShaderLocalSize;
+    resultOut->numViews                       = mNumViews;
+    resultOut->clipDistanceSize               = mClipDistanceSize;
+    resultOut->cullDistanceSize               = mCullDistanceSize;
+
+    resultOut->geometryShaderMaxVertices         = mGeometryShaderMaxVertices;
+    resultOut->geometryShaderInvocations         = mGeometryShaderInvocations;
+    resultOut->geometryShaderInputPrimitiveType  = mGeometryShaderInputPrimitiveType;
+    resultOut->geometryShaderOutputPrimitiveType = mGeometryShaderOutputPrimitiveType;
+
+    resultOut->tessControlShaderOutputVertices        = mTessControlShaderOutputVertices;
+    resultOut->tessEvaluationShaderInputPrimitiveType = mTessEvaluationShaderInputPrimitiveType;
+    resultOut->tessEvaluationShaderInputVertexSpacingType =
+        mTessEvaluationShaderInputVertexSpacingType;
+    resultOut->tessEvaluationShaderInputOrderingType = mTessEvaluationShaderInputOrderingType;
+    resultOut->tessEvaluationShaderInputPointType    = mTessEvaluationShaderInputPointType;
+
+    resultOut->hasAnyPreciseType        = mHasAnyPreciseType;
+    resultOut->usesDerivatives          = mUsesDerivatives;
+    resultOut->advancedBlendEquations   = mAdvancedBlendEquations;
+    resultOut->pixelLocalStorageFormats = mPixelLocalStorageFormats;
+
+    resultOut->attributes          = mAttributes;
+    resultOut->outputVariables     = mOutputVariables;
+    resultOut->uniforms            = mUniforms;
+    resultOut->inputVaryings       = mInputVaryings;
+    resultOut->outputVaryings      = mOutputVaryings;
+    resultOut->sharedVariables     = mSharedVariables;
+    resultOut->interfaceBlocks     = mInterfaceBlocks;
+    resultOut->uniformBlocks       = mUniformBlocks;
+    resultOut->shaderStorageBlocks = mShaderStorageBlocks;
+
+    resultOut->nameMap = mNameMap;
+}
+
+void TCompiler::restoreResults(const CompileResult &result)
+{
+    clearResults();
+
+    mInfoSink.info << result.infoLog;
+    if (!result.objectBinary.empty())
+    {
+        mInfoSink.obj.setBinary(BinaryBlob(result.objectBinary));
+    }
+    else
+    {
+        mInfoSink.obj << result.objectCode;
+    }
+
+    mShaderVersion                  = result.shaderVersion;
+    mMetadataFlags                  = result.metadataFlags;
+    mSpecConstUsageBits             = result.specConstUsageBits;
+    mEarlyFragmentTestsSpecified    = result.earlyFragmentTestsSpecified;
+    mComputeShaderLocalSizeDeclared = result.computeShaderLocalSizeDeclared;
+    mComputeShaderLocalSize         = result.computeShaderLocalSize;
+    mNumViews                       = result.numViews;
+    mClipDistanceSize               = result.clipDistanceSize;
+    mCullDistanceSize               = result.cullDistanceSize;
+
+    mGeometryShaderMaxVertices         = result.geometryShaderMaxVertices;
+    mGeometryShaderInvocations         = result.geometryShaderInvocations;
+    mGeometryShaderInputPrimitiveType  = result.geometryShaderInputPrimitiveType;
+    mGeometryShaderOutputPrimitiveType = result.geometryShaderOutputPrimitiveType;
+
+    mTessControlShaderOutputVertices            = result.tessControlShaderOutputVertices;
+    mTessEvaluationShaderInputPrimitiveType     = result.tessEvaluationShaderInputPrimitiveType;
+    mTessEvaluationShaderInputVertexSpacingType = result.tessEvaluationShaderInputVertexSpacingType;
+    mTessEvaluationShaderInputOrderingType      = result.tessEvaluationShaderInputOrderingType;
+    mTessEvaluationShaderInputPointType         = result.tessEvaluationShaderInputPointType;
+
+    mHasAnyPreciseType        = result.hasAnyPreciseType;
+    mUsesDerivatives          = result.usesDerivatives;
+    mAdvancedBlendEquations   = result.advancedBlendEquations;
+    mPixelLocalStorageFormats = result.pixelLocalStorageFormats;
+
+    mAttributes          = result.attributes;
+    mOutputVariables     = result.outputVariables;
+    mUniforms            = result.uniforms;
+    mInputVaryings       = result.inputVaryings;
+    mOutputVaryings      = result.outputVaryings;
+    mSharedVariables     = result.sharedVariables;
+    mInterfaceBlocks     = result.interfaceBlocks;
+    mUniformBlocks       = result.uniformBlocks;
+    mShaderStorageBlocks = result.shaderStorageBlocks;
+    mVariablesCollected  = true;
+
+    mNameMap = result.nameMap;
+}
+
+void TCompiler::beginPassStatistics()
+{
+    mPassStartNodeCount = 0;
+    mPassStartPoolBytes = GetGlobalPoolAllocator()->getTotalBytesAllocated();
+    mPassStartTime      = angle::GetCurrentSystemTime();
+}
+
+void TCompiler::recordPassStatisticsImpl(const char *passName, TIntermBlock *root)
+{
+    const double endTime      = angle::GetCurrentSystemTime();
+    const size_t endPoolBytes = GetGlobalPoolAllocator()->getTotalBytesAllocated();
+    const size_t nodeCount    = CountNodes(root);
+
+    mPassStatistics.push_back({passName, endTime - mPassStartTime, mPassStartNodeCount, nodeCount,
+                               endPoolBytes - mPassStartPoolBytes});
+
+    // Start measuring the next pass after counting the nodes, so the count isn't included in it.
+    mPassStartNodeCount = nodeCount;
+    mPassStartPoolBytes = GetGlobalPoolAllocator()->getTotalBytesAllocated();
+    mPassStartTime      = angle::GetCurrentSystemTime();
 }
 
 bool TCompiler::initCallDag(TIntermNode *root)
@@ -30,6 +30,7 @@
 namespace sh
 {
 
+struct CompileResult;
 class TCompiler;
 class TParseContext;
 #ifdef ANGLE_ENABLE_HLSL
@@ -124,6 +125,11 @@ class TCompiler : public TShHandleBase
     // Clears the results from the previous compilation.
     void clearResults();
 
+    // Copies the results of the previous compilation, or replaces them with results copied from
+    // an earlier compilation.  Used by CompileResultCache.
+    void saveResults(CompileResult *resultOut) const;
+    void restoreResults(const CompileResult &result);
+
     const std::vector<sh::ShaderVariable> &getAttributes() const { return mAttributes; }
     const std::vector<sh::ShaderVariable> &getOutputVariables() const { return mOutputVariables; }
     const std::vector<sh::ShaderVariable> &getUniforms() const { return mUniforms; }
@@ -199,6 +205,8 @@ class TCompiler : public TShHandleBase
 
     unsigned int getSharedMemorySize() const;
 
+    const std::vector<ShPassStatistics> &getPassStatistics() const { return mPassStatistics; }
+
     sh::GLenum getShaderType() const { return mShaderType; }
 
     // Generate a self-contained binary representation of the shader.
@@ -253,6 +261,16 @@ class TCompiler : public TShHandleBase
 
     const BuiltInFunctionEmulator &getBuiltInFunctionEmulator() const;
 
+    // If compileOptions.recordPassStatistics is set, records the statistics of the pass that just
+    // ran, which covers everything since the previous pass was recorded.
+    void recordPassStatistics(const char *passName, TIntermBlock *root)
+    {
+        if (ANGLE_UNLIKELY(mCompileOptions.recordPassStatistics))
+        {
+            recordPassStatisticsImpl(passName, root);
+        }
+    }
+
     virtual bool shouldFlattenPragmaStdglInvariantAll() = 0;
 
     std::vector<sh::ShaderVariable> mAttributes;
@@ -302,6 +320,9 @@ class TCompiler : public TShHandleBase
 
     void collectInterfaceBlocks();
 
+    void beginPassStatistics();
+    void recordPassStatisticsImpl(const char *passName, TIntermBlock *root);
+
     bool mVariablesCollected;
 
     bool mGLPositionInitialized;
@@ -396,6 +417,13 @@ class TCompiler : public TShHandleBase
     TPragma mPragma;
 
     ShCompileOptions mCompileOptions;
+
+    // Statistics of the passes of the last compilation, and the state of the compilation when the
+    // last pass was recorded.
+    std::vector<ShPassStatistics> mPassStatistics;
+    double mPassStartTime;
+    size_t mPassStartPoolBytes;
+    size_t mPassStartNodeCount;
 };
 
 //
@@ -202,7 +202,9 @@ void PropagatePrecisionIfApplicable(TIntermTyped *node, TPrecision precision)
 //
 ////////////////////////////////////////////////////////////////
 
-TIntermExpression::TIntermExpression(const TType &t) : TIntermTyped(), mType(t) {}
+TIntermExpression::TIntermExpression(TIntermNodeType nodeType, const TType &t)
+    : TIntermTyped(nodeType), mType(t)
+{}
 
 #define REPLACE_IF_IS(node, conversionFunc, original, replacement)                             \
     do                                                                                         \
@@ -433,7 +435,7 @@ bool TIntermAggregate::replaceChildNode(TIntermNode *original, TIntermNode *repl
     return replaceChildNodeInternal(original, replacement);
 }
 
-TIntermBlock::TIntermBlock(const TIntermBlock &node)
+TIntermBlock::TIntermBlock(const TIntermBlock &node) : TIntermNode(TIntermNodeType::Block)
 {
     for (TIntermNode *intermNode : node.mStatements)
     {
@@ -445,6 +447,7 @@ TIntermBlock::TIntermBlock(const TIntermBlock &node)
 }
 
 TIntermBlock::TIntermBlock(std::initializer_list<TIntermNode *> stmts)
+    : TIntermNode(TIntermNodeType::Block)
 {
     for (TIntermNode *stmt : stmts)
     {
@@ -489,6 +492,7 @@ bool TIntermFunctionPrototype::replaceChildNode(TIntermNode *original, TIntermNo
 }
 
 TIntermDeclaration::TIntermDeclaration(const TVariable *var, TIntermTyped *initExpr)
+    : TIntermDeclaration()
 {
     if (initExpr)
     {
@@ -534,7 +538,7 @@ bool TIntermDeclaration::replaceChildNode(TIntermNode *original, TIntermNode *re
     return replaceChildNodeInternal(original, replacement);
 }
 
-TIntermDeclaration::TIntermDeclaration(const TIntermDeclaration &node)
+TIntermDeclaration::TIntermDeclaration(const TIntermDeclaration &node) : TIntermDeclaration()
 {
     for (TIntermNode *intermNode : node.mDeclarators)
     {
@@ -578,7 +582,9 @@ bool TIntermAggregateBase::insertChildNodes(TIntermSequence::size_type position,
     return true;
 }
 
-TIntermSymbol::TIntermSymbol(const TVariable *variable) : TIntermTyped(), mVariable(variable) {}
+TIntermSymbol::TIntermSymbol(const TVariable *variable)
+    : TIntermTyped(TIntermNodeType::Symbol), mVariable(variable)
+{}
 
 bool TIntermSymbol::hasConstantValue() const
 {
@@ -652,7 +658,9 @@ TIntermAggregate::TIntermAggregate(const TFunction *func,
                                    const TType &type,
                                    TOperator op,
                                    TIntermSequence *arguments)
-    : TIntermOperator(op, type), mUseEmulatedFunction(false), mFunction(func)
+    : TIntermOperator(TIntermNodeType::Aggregate, op, type),
+      mUseEmulatedFunction(false),
+      mFunction(func)
 {
     if (arguments != nullptr)
     {
@@ -1128,8 +1136,8 @@ bool TIntermCase::replaceChildNode(TIntermNode *original, TIntermNode *replaceme
     return false;
 }
 
-TIntermTyped::TIntermTyped() : mIsPrecise(false) {}
-TIntermTyped::TIntermTyped(const TIntermTyped &node) : TIntermTyped()
+TIntermTyped::TIntermTyped(TIntermNodeType nodeType) : TIntermNode(nodeType), mIsPrecise(false) {}
+TIntermTyped::TIntermTyped(const TIntermTyped &node) : TIntermTyped(node.getNodeType())
 {
     // Copy constructor is disallowed for TIntermNode in order to disallow it for subclasses that
     // don't explicitly allow it, so normal TIntermNode constructor is used to construct the copy.
@@ -1173,7 +1181,7 @@ TIntermConstantUnion::TIntermConstantUnion(const TIntermConstantUnion &node)
 }
 
 TIntermFunctionPrototype::TIntermFunctionPrototype(const TFunction *function)
-    : TIntermTyped(), mFunction(function)
+    : TIntermTyped(TIntermNodeType::FunctionPrototype), mFunction(function)
 {
     ASSERT(mFunction->symbolType() != SymbolType::Empty);
 }
@@ -1538,7 +1546,7 @@ void TIntermUnary::propagatePrecision(TPrecision precision)
 }
 
 TIntermSwizzle::TIntermSwizzle(TIntermTyped *operand, const TVector<uint32_t> &swizzleOffsets)
-    : TIntermExpression(TType(EbtFloat, EbpUndefined)),
+    : TIntermExpression(TIntermNodeType::Swizzle, TType(EbtFloat, EbpUndefined)),
       mOperand(operand),
       mSwizzleOffsets(swizzleOffsets),
       mHasFoldedDuplicateOffsets(false)
@@ -1550,7 +1558,10 @@ TIntermSwizzle::TIntermSwizzle(TIntermTyped *operand, const TVector<uint32_t> &s
 }
 
 TIntermUnary::TIntermUnary(TOperator op, TIntermTyped *operand, const TFunction *function)
-    : TIntermOperator(op), mOperand(operand), mUseEmulatedFunction(false), mFunction(function)
+    : TIntermOperator(TIntermNodeType::Unary, op),
+      mOperand(operand),
+      mUseEmulatedFunction(false),
+      mFunction(function)
 {
     ASSERT(mOperand);
     ASSERT(!BuiltInGroup::IsBuiltIn(op) || (function != nullptr && function->getBuiltInOp() == op));
@@ -1558,7 +1569,7 @@ TIntermUnary::TIntermUnary(TOperator op, TIntermTyped *operand, const TFunction
 }
 
 TIntermBinary::TIntermBinary(TOperator op, TIntermTyped *left, TIntermTyped *right)
-    : TIntermOperator(op), mLeft(left), mRight(right)
+    : TIntermOperator(TIntermNodeType::Binary, op), mLeft(left), mRight(right)
 {
     ASSERT(mLeft);
     ASSERT(mRight);
@@ -1577,7 +1588,9 @@ TIntermBinary *TIntermBinary::CreateComma(TIntermTyped *left,
 TIntermGlobalQualifierDeclaration::TIntermGlobalQualifierDeclaration(TIntermSymbol *symbol,
                                                                      bool isPrecise,
                                                                      const TSourceLoc &line)
-    : TIntermNode(), mSymbol(symbol), mIsPrecise(isPrecise)
+    : TIntermNode(TIntermNodeType::GlobalQualifierDeclaration),
+      mSymbol(symbol),
+      mIsPrecise(isPrecise)
 {
     ASSERT(symbol);
     setLine(line);
@@ -1593,7 +1606,7 @@ TIntermGlobalQualifierDeclaration::TIntermGlobalQualifierDeclaration(
 TIntermTernary::TIntermTernary(TIntermTyped *cond,
                                TIntermTyped *trueExpression,
                                TIntermTyped *falseExpression)
-    : TIntermExpression(trueExpression->getType()),
+    : TIntermExpression(TIntermNodeType::Ternary, trueExpression->getType()),
       mCondition(cond),
       mTrueExpression(trueExpression),
       mFalseExpression(falseExpression)
@@ -1612,7 +1625,12 @@ TIntermLoop::TIntermLoop(TLoopType type,
                          TIntermTyped *cond,
                          TIntermTyped *expr,
                          TIntermBlock *body)
-    : mType(type), mInit(init), mCond(cond), mExpr(expr), mBody(EnsureBody(body))
+    : TIntermNode(TIntermNodeType::Loop),
+      mType(type),
+      mInit(init),
+      mCond(cond),
+      mExpr(expr),
+      mBody(EnsureBody(body))
 {
     // Declaration nodes with no children can appear if all the declarators just added constants to
     // the symbol table instead of generating code. They're no-ops so don't add them to the tree.
@@ -1632,7 +1650,7 @@ TIntermLoop::TIntermLoop(const TIntermLoop &node)
 {}
 
 TIntermIfElse::TIntermIfElse(TIntermTyped *cond, TIntermBlock *trueB, TIntermBlock *falseB)
-    : TIntermNode(), mCondition(cond), mTrueBlock(trueB), mFalseBlock(falseB)
+    : TIntermNode(TIntermNodeType::IfElse), mCondition(cond), mTrueBlock(trueB), mFalseBlock(falseB)
 {
     ASSERT(mCondition);
     // Prune empty false blocks so that there won't be unnecessary operations done on it.
@@ -1649,7 +1667,7 @@ TIntermIfElse::TIntermIfElse(const TIntermIfElse &node)
 {}
 
 TIntermSwitch::TIntermSwitch(TIntermTyped *init, TIntermBlock *statementList)
-    : TIntermNode(), mInit(init), mStatementList(statementList)
+    : TIntermNode(TIntermNodeType::Switch), mInit(init), mStatementList(statementList)
 {
     ASSERT(mInit);
     ASSERT(mStatementList);
@@ -4226,7 +4244,9 @@ TConstantUnion *TIntermConstantUnion::FoldAggregateBuiltIn(TIntermAggregate *agg
 // TIntermPreprocessorDirective implementation.
 TIntermPreprocessorDirective::TIntermPreprocessorDirective(PreprocessorDirective directive,
                                                            ImmutableString command)
-    : mDirective(directive), mCommand(std::move(command))
+    : TIntermNode(TIntermNodeType::PreprocessorDirective),
+      mDirective(directive),
+      mCommand(std::move(command))
 {}
 
 TIntermPreprocessorDirective::TIntermPreprocessorDirective(const TIntermPreprocessorDirective &node)
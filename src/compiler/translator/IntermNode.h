@@ -62,6 +62,33 @@ class TSymbolTable;
 class TFunction;
 class TVariable;
 
+// The concrete class of a node.  Traversal and the getAs*() functions switch on this rather than
+// going through the vtable.  The typed nodes come first, so that getAsTyped() is a single
+// comparison.
+enum class TIntermNodeType : uint8_t
+{
+    Symbol,
+    ConstantUnion,
+    FunctionPrototype,
+    Swizzle,
+    Binary,
+    Unary,
+    Ternary,
+    Aggregate,
+    LastTyped = Aggregate,
+
+    Block,
+    FunctionDefinition,
+    Declaration,
+    GlobalQualifierDeclaration,
+    IfElse,
+    Switch,
+    Case,
+    Loop,
+    Branch,
+    PreprocessorDirective,
+};
+
 //
 // Base class for the tree nodes
 //
@@ -69,7 +96,7 @@ class TIntermNode : angle::NonCopyable
 {
   public:
     POOL_ALLOCATOR_NEW_DELETE
-    TIntermNode()
+    explicit TIntermNode(TIntermNodeType nodeType) : mNodeType(nodeType)
     {
         // TODO: Move this to TSourceLoc constructor
         // after getting rid of TPublicType.
@@ -81,31 +108,32 @@ class TIntermNode : angle::NonCopyable
     const TSourceLoc &getLine() const { return mLine; }
     void setLine(const TSourceLoc &l) { mLine = l; }
 
-    virtual void traverse(TIntermTraverser *it);
+    TIntermNodeType getNodeType() const { return mNodeType; }
+
+    // Calls the traversal function of |it| for the concrete class of the node.
+    void traverse(TIntermTraverser *it);
     virtual bool visit(Visit visit, TIntermTraverser *it) = 0;
 
-    virtual TIntermTyped *getAsTyped() { return nullptr; }
-    virtual TIntermConstantUnion *getAsConstantUnion() { return nullptr; }
-    virtual TIntermFunctionDefinition *getAsFunctionDefinition() { return nullptr; }
-    virtual TIntermAggregate *getAsAggregate() { return nullptr; }
-    virtual TIntermBlock *getAsBlock() { return nullptr; }
-    virtual TIntermFunctionPrototype *getAsFunctionPrototypeNode() { return nullptr; }
-    virtual TIntermGlobalQualifierDeclaration *getAsGlobalQualifierDeclarationNode()
-    {
-        return nullptr;
-    }
-    virtual TIntermDeclaration *getAsDeclarationNode() { return nullptr; }
-    virtual TIntermSwizzle *getAsSwizzleNode() { return nullptr; }
-    virtual TIntermBinary *getAsBinaryNode() { return nullptr; }
-    virtual TIntermUnary *getAsUnaryNode() { return nullptr; }
-    virtual TIntermTernary *getAsTernaryNode() { return nullptr; }
-    virtual TIntermIfElse *getAsIfElseNode() { return nullptr; }
-    virtual TIntermSwitch *getAsSwitchNode() { return nullptr; }
-    virtual TIntermCase *getAsCaseNode() { return nullptr; }
-    virtual TIntermSymbol *getAsSymbolNode() { return nullptr; }
-    virtual TIntermLoop *getAsLoopNode() { return nullptr; }
-    virtual TIntermBranch *getAsBranchNode() { return nullptr; }
-    virtual TIntermPreprocessorDirective *getAsPreprocessorDirective() { return nullptr; }
+    // Defined after the node classes.
+    TIntermTyped *getAsTyped();
+    TIntermConstantUnion *getAsConstantUnion();
+    TIntermFunctionDefinition *getAsFunctionDefinition();
+    TIntermAggregate *getAsAggregate();
+    TIntermBlock *getAsBlock();
+    TIntermFunctionPrototype *getAsFunctionPrototypeNode();
+    TIntermGlobalQualifierDeclaration *getAsGlobalQualifierDeclarationNode();
+    TIntermDeclaration *getAsDeclarationNode();
+    TIntermSwizzle *getAsSwizzleNode();
+    TIntermBinary *getAsBinaryNode();
+    TIntermUnary *getAsUnaryNode();
+    TIntermTernary *getAsTernaryNode();
+    TIntermIfElse *getAsIfElseNode();
+    TIntermSwitch *getAsSwitchNode();
+    TIntermCase *getAsCaseNode();
+    TIntermSymbol *getAsSymbolNode();
+    TIntermLoop *getAsLoopNode();
+    TIntermBranch *getAsBranchNode();
+    TIntermPreprocessorDirective *getAsPreprocessorDirective();
 
     virtual TIntermNode *deepCopy() const = 0;
 
@@ -119,6 +147,9 @@ class TIntermNode : angle::NonCopyable
 
   protected:
     TSourceLoc mLine;
+
+  private:
+    const TIntermNodeType mNodeType;
 };
 
 //
@@ -136,12 +167,10 @@ struct TIntermNodePair
 class TIntermTyped : public TIntermNode
 {
   public:
-    TIntermTyped();
+    explicit TIntermTyped(TIntermNodeType nodeType);
 
     virtual TIntermTyped *deepCopy() const override = 0;
 
-    TIntermTyped *getAsTyped() override { return this; }
-
     virtual TIntermTyped *fold(TDiagnostics *diagnostics) { return this; }
 
     // getConstantValue() returns the constant value that this node represents, if any. It
@@ -218,8 +247,6 @@ class TIntermLoop : public TIntermNode
                 TIntermTyped *expr,
                 TIntermBlock *body);
 
-    TIntermLoop *getAsLoopNode() override { return this; }
-    void traverse(TIntermTraverser *it) final;
     bool visit(Visit visit, TIntermTraverser *it) final;
 
     size_t getChildCount() const final;
@@ -258,9 +285,10 @@ class TIntermLoop : public TIntermNode
 class TIntermBranch : public TIntermNode
 {
   public:
-    TIntermBranch(TOperator op, TIntermTyped *e) : mFlowOp(op), mExpression(e) {}
+    TIntermBranch(TOperator op, TIntermTyped *e)
+        : TIntermNode(TIntermNodeType::Branch), mFlowOp(op), mExpression(e)
+    {}
 
-    TIntermBranch *getAsBranchNode() override { return this; }
     bool visit(Visit visit, TIntermTraverser *it) final;
 
     size_t getChildCount() const final;
@@ -301,8 +329,6 @@ class TIntermSymbol : public TIntermTyped
     ImmutableString getName() const;
     const TVariable &variable() const { return *mVariable; }
 
-    TIntermSymbol *getAsSymbolNode() override { return this; }
-    void traverse(TIntermTraverser *it) final;
     bool visit(Visit visit, TIntermTraverser *it) final;
 
     size_t getChildCount() const final;
@@ -320,7 +346,7 @@ class TIntermSymbol : public TIntermTyped
 class TIntermExpression : public TIntermTyped
 {
   public:
-    TIntermExpression(const TType &t);
+    TIntermExpression(TIntermNodeType nodeType, const TType &t);
 
     const TType &getType() const override { return mType; }
 
@@ -343,7 +369,7 @@ class TIntermConstantUnion : public TIntermExpression
 {
   public:
     TIntermConstantUnion(const TConstantUnion *unionPointer, const TType &type)
-        : TIntermExpression(type), mUnionArrayPointer(unionPointer)
+        : TIntermExpression(TIntermNodeType::ConstantUnion, type), mUnionArrayPointer(unionPointer)
     {
         ASSERT(unionPointer);
     }
@@ -377,8 +403,6 @@ class TIntermConstantUnion : public TIntermExpression
         return mUnionArrayPointer ? mUnionArrayPointer[index].isZero() : false;
     }
 
-    TIntermConstantUnion *getAsConstantUnion() override { return this; }
-    void traverse(TIntermTraverser *it) final;
     bool visit(Visit visit, TIntermTraverser *it) final;
 
     size_t getChildCount() const final;
@@ -436,8 +460,12 @@ class TIntermOperator : public TIntermExpression
     bool hasSideEffects() const override { return isAssignment(); }
 
   protected:
-    TIntermOperator(TOperator op) : TIntermExpression(TType(EbtFloat, EbpUndefined)), mOp(op) {}
-    TIntermOperator(TOperator op, const TType &type) : TIntermExpression(type), mOp(op) {}
+    TIntermOperator(TIntermNodeType nodeType, TOperator op)
+        : TIntermExpression(nodeType, TType(EbtFloat, EbpUndefined)), mOp(op)
+    {}
+    TIntermOperator(TIntermNodeType nodeType, TOperator op, const TType &type)
+        : TIntermExpression(nodeType, type), mOp(op)
+    {}
 
     TIntermOperator(const TIntermOperator &) = default;
 
@@ -453,7 +481,6 @@ class TIntermSwizzle : public TIntermExpression
 
     TIntermTyped *deepCopy() const override { return new TIntermSwizzle(*this); }
 
-    TIntermSwizzle *getAsSwizzleNode() override { return this; }
     bool visit(Visit visit, TIntermTraverser *it) final;
 
     size_t getChildCount() const final;
@@ -506,8 +533,6 @@ class TIntermBinary : public TIntermOperator
     static TOperator GetMulOpBasedOnOperands(const TType &left, const TType &right);
     static TOperator GetMulAssignOpBasedOnOperands(const TType &left, const TType &right);
 
-    TIntermBinary *getAsBinaryNode() override { return this; }
-    void traverse(TIntermTraverser *it) final;
     bool visit(Visit visit, TIntermTraverser *it) final;
 
     size_t getChildCount() const final;
@@ -552,8 +577,6 @@ class TIntermUnary : public TIntermOperator
 
     TIntermTyped *deepCopy() const override { return new TIntermUnary(*this); }
 
-    TIntermUnary *getAsUnaryNode() override { return this; }
-    void traverse(TIntermTraverser *it) final;
     bool visit(Visit visit, TIntermTraverser *it) final;
 
     size_t getChildCount() const final;
@@ -637,8 +660,6 @@ class TIntermAggregate : public TIntermOperator, public TIntermAggregateBase
     bool isConstantNullValue() const override;
     const TConstantUnion *getConstantValue() const override;
 
-    TIntermAggregate *getAsAggregate() override { return this; }
-    void traverse(TIntermTraverser *it) final;
     bool visit(Visit visit, TIntermTraverser *it) final;
 
     size_t getChildCount() const final;
@@ -689,12 +710,10 @@ class TIntermAggregate : public TIntermOperator, public TIntermAggregateBase
 class TIntermBlock : public TIntermNode, public TIntermAggregateBase
 {
   public:
-    TIntermBlock() : TIntermNode(), mIsTreeRoot(false) {}
+    TIntermBlock() : TIntermNode(TIntermNodeType::Block), mIsTreeRoot(false) {}
     TIntermBlock(std::initializer_list<TIntermNode *> stmts);
     ~TIntermBlock() override {}
 
-    TIntermBlock *getAsBlock() override { return this; }
-    void traverse(TIntermTraverser *it) final;
     bool visit(Visit visit, TIntermTraverser *it) final;
 
     size_t getChildCount() const final;
@@ -733,8 +752,6 @@ class TIntermFunctionPrototype : public TIntermTyped
     TIntermFunctionPrototype(const TFunction *function);
     ~TIntermFunctionPrototype() override {}
 
-    TIntermFunctionPrototype *getAsFunctionPrototypeNode() override { return this; }
-    void traverse(TIntermTraverser *it) final;
     bool visit(Visit visit, TIntermTraverser *it) final;
 
     size_t getChildCount() const final;
@@ -766,14 +783,12 @@ class TIntermFunctionDefinition : public TIntermNode
 {
   public:
     TIntermFunctionDefinition(TIntermFunctionPrototype *prototype, TIntermBlock *body)
-        : TIntermNode(), mPrototype(prototype), mBody(body)
+        : TIntermNode(TIntermNodeType::FunctionDefinition), mPrototype(prototype), mBody(body)
     {
         ASSERT(prototype != nullptr);
         ASSERT(body != nullptr);
     }
 
-    TIntermFunctionDefinition *getAsFunctionDefinition() override { return this; }
-    void traverse(TIntermTraverser *it) final;
     bool visit(Visit visit, TIntermTraverser *it) final;
 
     size_t getChildCount() const final;
@@ -800,13 +815,12 @@ class TIntermFunctionDefinition : public TIntermNode
 class TIntermDeclaration : public TIntermNode, public TIntermAggregateBase
 {
   public:
-    TIntermDeclaration() : TIntermNode() {}
+    TIntermDeclaration() : TIntermNode(TIntermNodeType::Declaration) {}
     TIntermDeclaration(const TVariable *var, TIntermTyped *initExpr);
     TIntermDeclaration(std::initializer_list<const TVariable *> declarators);
     TIntermDeclaration(std::initializer_list<TIntermTyped *> declarators);
     ~TIntermDeclaration() override {}
 
-    TIntermDeclaration *getAsDeclarationNode() override { return this; }
     bool visit(Visit visit, TIntermTraverser *it) final;
 
     size_t getChildCount() const final;
@@ -849,10 +863,6 @@ class TIntermGlobalQualifierDeclaration : public TIntermNode
                                       bool isPrecise,
                                       const TSourceLoc &line);
 
-    virtual TIntermGlobalQualifierDeclaration *getAsGlobalQualifierDeclarationNode() override
-    {
-        return this;
-    }
     bool visit(Visit visit, TIntermTraverser *it) final;
 
     TIntermSymbol *getSymbol() { return mSymbol; }
@@ -882,7 +892,6 @@ class TIntermTernary : public TIntermExpression
   public:
     TIntermTernary(TIntermTyped *cond, TIntermTyped *trueExpression, TIntermTyped *falseExpression);
 
-    TIntermTernary *getAsTernaryNode() override { return this; }
     bool visit(Visit visit, TIntermTraverser *it) final;
 
     size_t getChildCount() const final;
@@ -922,7 +931,6 @@ class TIntermIfElse : public TIntermNode
   public:
     TIntermIfElse(TIntermTyped *cond, TIntermBlock *trueB, TIntermBlock *falseB);
 
-    TIntermIfElse *getAsIfElseNode() override { return this; }
     bool visit(Visit visit, TIntermTraverser *it) final;
 
     size_t getChildCount() const final;
@@ -952,7 +960,6 @@ class TIntermSwitch : public TIntermNode
   public:
     TIntermSwitch(TIntermTyped *init, TIntermBlock *statementList);
 
-    TIntermSwitch *getAsSwitchNode() override { return this; }
     bool visit(Visit visit, TIntermTraverser *it) final;
 
     size_t getChildCount() const final;
@@ -981,9 +988,9 @@ class TIntermSwitch : public TIntermNode
 class TIntermCase : public TIntermNode
 {
   public:
-    TIntermCase(TIntermTyped *condition) : TIntermNode(), mCondition(condition) {}
+    TIntermCase(TIntermTyped *condition) : TIntermNode(TIntermNodeType::Case), mCondition(condition)
+    {}
 
-    TIntermCase *getAsCaseNode() override { return this; }
     bool visit(Visit visit, TIntermTraverser *it) final;
 
     size_t getChildCount() const final;
@@ -1022,11 +1029,9 @@ class TIntermPreprocessorDirective final : public TIntermNode
     TIntermPreprocessorDirective(PreprocessorDirective directive, ImmutableString command);
     ~TIntermPreprocessorDirective() final;
 
-    void traverse(TIntermTraverser *it) final;
     bool visit(Visit visit, TIntermTraverser *it) final;
     bool replaceChildNode(TIntermNode *, TIntermNode *) final { return false; }
 
-    TIntermPreprocessorDirective *getAsPreprocessorDirective() final { return this; }
     size_t getChildCount() const final;
     TIntermNode *getChildNode(size_t index) const final;
 
@@ -1045,6 +1050,117 @@ class TIntermPreprocessorDirective final : public TIntermNode
     TIntermPreprocessorDirective(const TIntermPreprocessorDirective &);
 };
 
+// The getAs*() functions only need to compare the node type, as the classes it names are never
+// derived from.
+inline TIntermTyped *TIntermNode::getAsTyped()
+{
+    return mNodeType <= TIntermNodeType::LastTyped ? static_cast<TIntermTyped *>(this) : nullptr;
+}
+
+inline TIntermConstantUnion *TIntermNode::getAsConstantUnion()
+{
+    return mNodeType == TIntermNodeType::ConstantUnion
+               ? static_cast<TIntermConstantUnion *>(this)
+               : nullptr;
+}
+
+inline TIntermFunctionDefinition *TIntermNode::getAsFunctionDefinition()
+{
+    return mNodeType == TIntermNodeType::FunctionDefinition
+               ? static_cast<TIntermFunctionDefinition *>(this)
+               : nullptr;
+}
+
+inline TIntermAggregate *TIntermNode::getAsAggregate()
+{
+    return mNodeType == TIntermNodeType::Aggregate
+               ? static_cast<TIntermAggregate *>(this)
+               : nullptr;
+}
+
+inline TIntermBlock *TIntermNode::getAsBlock()
+{
+    return mNodeType == TIntermNodeType::Block ? static_cast<TIntermBlock *>(this) : nullptr;
+}
+
+inline TIntermFunctionPrototype *TIntermNode::getAsFunctionPrototypeNode()
+{
+    return mNodeType == TIntermNodeType::FunctionPrototype
+               ? static_cast<TIntermFunctionPrototype *>(this)
+               : nullptr;
+}
+
+inline TIntermGlobalQualifierDeclaration *TIntermNode::getAsGlobalQualifierDeclarationNode()
+{
+    return mNodeType == TIntermNodeType::GlobalQualifierDeclaration
+               ? static_cast<TIntermGlobalQualifierDeclaration *>(this)
+               : nullptr;
+}
+
+inline TIntermDeclaration *TIntermNode::getAsDeclarationNode()
+{
+    return mNodeType == TIntermNodeType::Declaration
+               ? static_cast<TIntermDeclaration *>(this)
+               : nullptr;
+}
+
+inline TIntermSwizzle *TIntermNode::getAsSwizzleNode()
+{
+    return mNodeType == TIntermNodeType::Swizzle ? static_cast<TIntermSwizzle *>(this) : nullptr;
+}
+
+inline TIntermBinary *TIntermNode::getAsBinaryNode()
+{
+    return mNodeType == TIntermNodeType::Binary ? static_cast<TIntermBinary *>(this) : nullptr;
+}
+
+inline TIntermUnary *TIntermNode::getAsUnaryNode()
+{
+    return mNodeType == TIntermNodeType::Unary ? static_cast<TIntermUnary *>(this) : nullptr;
+}
+
+inline TIntermTernary *TIntermNode::getAsTernaryNode()
+{
+    return mNodeType == TIntermNodeType::Ternary ? static_cast<TIntermTernary *>(this) : nullptr;
+}
+
+inline TIntermIfElse *TIntermNode::getAsIfElseNode()
+{
+    return mNodeType == TIntermNodeType::IfElse ? static_cast<TIntermIfElse *>(this) : nullptr;
+}
+
+inline TIntermSwitch *TIntermNode::getAsSwitchNode()
+{
+    return mNodeType == TIntermNodeType::Switch ? static_cast<TIntermSwitch *>(this) : nullptr;
+}
+
+inline TIntermCase *TIntermNode::getAsCaseNode()
+{
+    return mNodeType == TIntermNodeType::Case ? static_cast<TIntermCase *>(this) : nullptr;
+}
+
+inline TIntermSymbol *TIntermNode::getAsSymbolNode()
+{
+    return mNodeType == TIntermNodeType::Symbol ? static_cast<TIntermSymbol *>(this) : nullptr;
+}
+
+inline TIntermLoop *TIntermNode::getAsLoopNode()
+{
+    return mNodeType == TIntermNodeType::Loop ? static_cast<TIntermLoop *>(this) : nullptr;
+}
+
+inline TIntermBranch *TIntermNode::getAsBranchNode()
+{
+    return mNodeType == TIntermNodeType::Branch ? static_cast<TIntermBranch *>(this) : nullptr;
+}
+
+inline TIntermPreprocessorDirective *TIntermNode::getAsPreprocessorDirective()
+{
+    return mNodeType == TIntermNodeType::PreprocessorDirective
+               ? static_cast<TIntermPreprocessorDirective *>(this)
+               : nullptr;
+}
+
 inline TIntermBlock *TIntermLoop::EnsureBody(TIntermBlock *body)
 {
     if (ANGLE_LIKELY(body))
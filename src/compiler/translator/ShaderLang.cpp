@@ -12,6 +12,7 @@
 #include "GLSLANG/ShaderLang.h"
 
 #include "common/PackedEnums.h"
+#include "compiler/translator/CompileResultCache.h"
 #include "compiler/translator/Compiler.h"
 #include "compiler/translator/InitializeDll.h"
 #include "compiler/translator/length_limits.h"
@@ -411,6 +412,12 @@ bool Compile(const ShHandle handle,
     TCompiler *compiler = GetCompilerFromHandle(handle);
     ASSERT(compiler);
 
+    if (numStrings > 0 && CompileResultCache::CanMemoize(compiler, compileOptions))
+    {
+        return CompileResultCache::Get()->compile(compiler, shaderStrings, numStrings,
+                                                  compileOptions);
+    }
+
     return compiler->compile(shaderStrings, numStrings, compileOptions);
 }
 
@@ -628,6 +635,26 @@ uint32_t GetShaderSpecConstUsageBits(const ShHandle handle)
     return compiler->getSpecConstUsageBits().bits();
 }
 
+const std::vector<ShPassStatistics> *GetPassStatistics(const ShHandle handle)
+{
+    TCompiler *compiler = GetCompilerFromHandle(handle);
+    if (compiler == nullptr)
+    {
+        return nullptr;
+    }
+    return &compiler->getPassStatistics();
+}
+
+ShCompileResultCacheStatistics GetCompileResultCacheStatistics()
+{
+    return CompileResultCache::Get()->getStatistics();
+}
+
+void ClearCompileResultCache()
+{
+    CompileResultCache::Get()->clear();
+}
+
 bool CheckVariablesWithinPackingLimits(int maxVectors, const std::vector<ShaderVariable> &variables)
 {
     return CheckVariablesInPackingLimits(maxVectors, variables);
@@ -13,7 +13,12 @@
 
 #include "compiler/translator/SymbolTable.h"
 
+#include <mutex>
+
 #include "angle_gl.h"
+#include "common/base/anglebase/no_destructor.h"
+#include "common/hash_containers.h"
+#include "common/hash_utils.h"
 #include "compiler/translator/ImmutableString.h"
 #include "compiler/translator/IntermNode.h"
 #include "compiler/translator/StaticType.h"
@@ -56,6 +61,140 @@ bool CheckExtension(uint32_t extensionIndex, const ShBuiltInResources &resources
     const int *resourcePtr = reinterpret_cast<const int *>(&resources);
     return resourcePtr[extensionIndex] > 0;
 }
+
+struct SharedBuiltInsKey
+{
+    bool operator==(const SharedBuiltInsKey &other) const
+    {
+        // ShBuiltInResources is zero-initialized and copied with memcpy, so it can be compared as
+        // a whole.
+        return shaderType == other.shaderType && spec == other.spec &&
+               memcmp(&resources, &other.resources, sizeof(resources)) == 0;
+    }
+
+    sh::GLenum shaderType;
+    ShShaderSpec spec;
+    ShBuiltInResources resources;
+};
+
+struct SharedBuiltInsKeyHash
+{
+    size_t operator()(const SharedBuiltInsKey &key) const
+    {
+        size_t hash = angle::ComputeGenericHash(key.resources);
+        angle::HashCombine(hash, key.shaderType, key.spec);
+        return hash;
+    }
+};
+
+void RealizeType(const TType &type);
+
+void RealizeFieldList(const TFieldListCollection &fieldList)
+{
+    fieldList.mangledFieldList();
+    fieldList.objectSize();
+    fieldList.deepestNesting();
+    for (const TField *field : fieldList.fields())
+    {
+        RealizeType(*field->type());
+    }
+}
+
+void RealizeType(const TType &type)
+{
+    type.getMangledName();
+    if (type.getStruct())
+    {
+        RealizeFieldList(*type.getStruct());
+    }
+    if (type.getInterfaceBlock())
+    {
+        RealizeFieldList(*type.getInterfaceBlock());
+    }
+}
+
+// Computes the lazily evaluated properties of the built-ins, which would otherwise be written to
+// (and allocated from the pool of) whichever compiler needs them first.
+void RealizeBuiltIns(const TSymbolTableBase &symbols)
+{
+    // TSymbolTableBase is generated, and only holds pointers to the built-ins.
+    constexpr size_t kSymbolCount = sizeof(TSymbolTableBase) / sizeof(TSymbol *);
+    static_assert(sizeof(TSymbolTableBase) == kSymbolCount * sizeof(TSymbol *),
+                  "TSymbolTableBase is expected to be an array of symbol pointers");
+    const TSymbol *const *symbolArray = reinterpret_cast<const TSymbol *const *>(&symbols);
+
+    for (size_t index = 0; index < kSymbolCount; ++index)
+    {
+        const TSymbol *symbol = symbolArray[index];
+        if (symbol == nullptr)
+        {
+            continue;
+        }
+        if (symbol->isVariable())
+        {
+            RealizeType(static_cast<const TVariable *>(symbol)->getType());
+        }
+        else if (symbol->isStruct())
+        {
+            RealizeFieldList(*static_cast<const TStructure *>(symbol));
+        }
+        else if (symbol->isInterfaceBlock())
+        {
+            RealizeFieldList(*static_cast<const TInterfaceBlock *>(symbol));
+        }
+    }
+}
+
+using DefaultPrecisions = std::array<TPrecision, EbtLast>;
+
+void InitSamplerDefaultPrecision(TBasicType samplerType, DefaultPrecisions *precisions)
+{
+    ASSERT(samplerType >= EbtGuardSamplerBegin && samplerType <= EbtGuardSamplerEnd);
+    (*precisions)[samplerType] = EbpLow;
+}
+
+void InitDefaultPrecisions(sh::GLenum type, ShShaderSpec spec, DefaultPrecisions *precisions)
+{
+    precisions->fill(EbpUndefined);
+
+    switch (type)
+    {
+        case GL_FRAGMENT_SHADER:
+            (*precisions)[EbtInt] = EbpMedium;
+            break;
+        case GL_VERTEX_SHADER:
+        case GL_COMPUTE_SHADER:
+        case GL_GEOMETRY_SHADER_EXT:
+        case GL_TESS_CONTROL_SHADER_EXT:
+        case GL_TESS_EVALUATION_SHADER_EXT:
+            (*precisions)[EbtInt]   = EbpHigh;
+            (*precisions)[EbtFloat] = EbpHigh;
+            break;
+        default:
+            UNREACHABLE();
+    }
+
+    // Set defaults for sampler types that have default precision, even those that are
+    // only available if an extension exists.
+    // New sampler types in ESSL3 don't have default precision. ESSL1 types do.
+    InitSamplerDefaultPrecision(EbtSampler2D, precisions);
+    InitSamplerDefaultPrecision(EbtSamplerCube, precisions);
+    // SamplerExternalOES is specified in the extension to have default precision.
+    InitSamplerDefaultPrecision(EbtSamplerExternalOES, precisions);
+    // SamplerExternal2DY2YEXT is specified in the extension to have default precision.
+    InitSamplerDefaultPrecision(EbtSamplerExternal2DY2YEXT, precisions);
+    // It isn't specified whether Sampler2DRect has default precision.
+    InitSamplerDefaultPrecision(EbtSampler2DRect, precisions);
+
+    if (spec < SH_GLES3_SPEC)
+    {
+        // Only set the default precision of shadow samplers in ESLL1. They become core in ESSL3
+        // where they do not have a defalut precision.
+        InitSamplerDefaultPrecision(EbtSampler2DShadow, precisions);
+    }
+
+    (*precisions)[EbtAtomicCounter] = EbpHigh;
+}
 }  // namespace
 
 class TSymbolTable::TSymbolTableLevel
@@ -335,20 +474,19 @@ TPrecision TSymbolTable::getDefaultPrecision(TBasicType type) const
     TBasicType baseType = (type == EbtUInt) ? EbtInt : type;
 
     int level = static_cast<int>(mPrecisionStack.size()) - 1;
-    ASSERT(level >= 0);  // Just to be safe. Should not happen.
-    // If we dont find anything we return this. Some types don't have predefined default precision.
-    TPrecision prec = EbpUndefined;
     while (level >= 0)
     {
         PrecisionStackLevel::iterator it = mPrecisionStack[level]->find(baseType);
         if (it != mPrecisionStack[level]->end())
         {
-            prec = (*it).second;
-            break;
+            return (*it).second;
         }
         level--;
     }
-    return prec;
+
+    // Some types don't have predefined default precision, in which case this is EbpUndefined.
+    ASSERT(mBuiltIns);
+    return mBuiltIns->defaultPrecisions[baseType];
 }
 
 void TSymbolTable::clearCompilationResults()
@@ -376,55 +514,67 @@ void TSymbolTable::initializeBuiltIns(sh::GLenum type,
     mShaderSpec = spec;
     mResources  = resources;
 
-    // We need just one precision stack level for predefined precisions.
-    mPrecisionStack.emplace_back(new PrecisionStackLevel);
+    mBuiltIns = getSharedBuiltIns(type, spec, resources);
+    static_cast<TSymbolTableBase &>(*this) = mBuiltIns->symbols;
 
-    switch (type)
-    {
-        case GL_FRAGMENT_SHADER:
-            setDefaultPrecision(EbtInt, EbpMedium);
-            break;
-        case GL_VERTEX_SHADER:
-        case GL_COMPUTE_SHADER:
-        case GL_GEOMETRY_SHADER_EXT:
-        case GL_TESS_CONTROL_SHADER_EXT:
-        case GL_TESS_EVALUATION_SHADER_EXT:
-            setDefaultPrecision(EbtInt, EbpHigh);
-            setDefaultPrecision(EbtFloat, EbpHigh);
-            break;
-        default:
-            UNREACHABLE();
-    }
+    mUniqueIdCounter = kFirstUserDefinedSymbolId;
+}
 
-    // Set defaults for sampler types that have default precision, even those that are
-    // only available if an extension exists.
-    // New sampler types in ESSL3 don't have default precision. ESSL1 types do.
-    initSamplerDefaultPrecision(EbtSampler2D);
-    initSamplerDefaultPrecision(EbtSamplerCube);
-    // SamplerExternalOES is specified in the extension to have default precision.
-    initSamplerDefaultPrecision(EbtSamplerExternalOES);
-    // SamplerExternal2DY2YEXT is specified in the extension to have default precision.
-    initSamplerDefaultPrecision(EbtSamplerExternal2DY2YEXT);
-    // It isn't specified whether Sampler2DRect has default precision.
-    initSamplerDefaultPrecision(EbtSampler2DRect);
+std::shared_ptr<const TSymbolTable::SharedBuiltIns> TSymbolTable::getSharedBuiltIns(
+    sh::GLenum shaderType,
+    ShShaderSpec spec,
+    const ShBuiltInResources &resources)
+{
+    // The built-ins are freed when the last symbol table using them is destroyed.
+    using SharedBuiltInsCache =
+        angle::HashMap<SharedBuiltInsKey, std::weak_ptr<const SharedBuiltIns>,
+                       SharedBuiltInsKeyHash>;
+    static angle::base::NoDestructor<std::mutex> cacheMutex;
+    static angle::base::NoDestructor<SharedBuiltInsCache> cache;
 
-    if (spec < SH_GLES3_SPEC)
+    const SharedBuiltInsKey key = {shaderType, spec, resources};
+
+    std::lock_guard<std::mutex> lock(*cacheMutex);
+
+    auto iter = cache->find(key);
+    if (iter != cache->end())
     {
-        // Only set the default precision of shadow samplers in ESLL1. They become core in ESSL3
-        // where they do not have a defalut precision.
-        initSamplerDefaultPrecision(EbtSampler2DShadow);
+        std::shared_ptr<const SharedBuiltIns> builtIns = iter->second.lock();
+        if (builtIns)
+        {
+            return builtIns;
+        }
     }
 
-    setDefaultPrecision(EbtAtomicCounter, EbpHigh);
+    // The built-in variables are created by the generated initializeBuiltInVariables(), which
+    // sets them on this table.  They are allocated from their own pool, and copied from here.
+    std::shared_ptr<SharedBuiltIns> builtIns = std::make_shared<SharedBuiltIns>();
+    builtIns->allocator.push();
 
-    initializeBuiltInVariables(type, spec, resources);
-    mUniqueIdCounter = kFirstUserDefinedSymbolId;
-}
+    angle::PoolAllocator *compilerAllocator = GetGlobalPoolAllocator();
+    SetGlobalPoolAllocator(&builtIns->allocator);
+    initializeBuiltInVariables(shaderType, spec, resources);
+    builtIns->symbols = *this;
+    RealizeBuiltIns(builtIns->symbols);
+    SetGlobalPoolAllocator(compilerAllocator);
 
-void TSymbolTable::initSamplerDefaultPrecision(TBasicType samplerType)
-{
-    ASSERT(samplerType >= EbtGuardSamplerBegin && samplerType <= EbtGuardSamplerEnd);
-    setDefaultPrecision(samplerType, EbpLow);
+    InitDefaultPrecisions(shaderType, spec, &builtIns->defaultPrecisions);
+
+    // Drop the entries of built-ins that are no longer used before adding the new one.
+    for (auto entry = cache->begin(); entry != cache->end();)
+    {
+        if (entry->second.expired())
+        {
+            cache->erase(entry++);
+        }
+        else
+        {
+            ++entry;
+        }
+    }
+    (*cache)[key] = builtIns;
+
+    return builtIns;
 }
 
 TSymbolTable::VariableMetadata::VariableMetadata()
@@ -30,6 +30,7 @@
 //   are tracked in the intermediate representation, not the symbol table.
 //
 
+#include <array>
 #include <limits>
 #include <memory>
 #include <set>
@@ -275,6 +276,8 @@ class TSymbolTable : angle::NonCopyable, TSymbolTableBase
                                 int shaderVersion,
                                 const TExtensionBehavior &extensions) const;
 
+    // The built-ins that depend on the shader type, spec and resources are created once for each
+    // combination of them, and shared by all the symbol tables (on any thread) that use it.
     void initializeBuiltIns(sh::GLenum type,
                             ShShaderSpec spec,
                             const ShBuiltInResources &resources);
@@ -297,7 +300,22 @@ class TSymbolTable : angle::NonCopyable, TSymbolTableBase
 
     class TSymbolTableLevel;
 
-    void initSamplerDefaultPrecision(TBasicType samplerType);
+    using DefaultPrecisions = std::array<TPrecision, EbtLast>;
+
+    // The built-in variables created for a shader type, spec and resources combination.  These
+    // are immutable once created.
+    struct SharedBuiltIns : angle::NonCopyable
+    {
+        // Owns the memory of the built-ins, which outlive the compiler that created them.
+        angle::PoolAllocator allocator;
+        TSymbolTableBase symbols;
+        // The predefined default precisions, which are below all levels of the precision stack.
+        DefaultPrecisions defaultPrecisions;
+    };
+
+    std::shared_ptr<const SharedBuiltIns> getSharedBuiltIns(sh::GLenum shaderType,
+                                                            ShShaderSpec spec,
+                                                            const ShBuiltInResources &resources);
 
     void initializeBuiltInVariables(sh::GLenum shaderType,
                                     ShShaderSpec spec,
@@ -307,8 +325,10 @@ class TSymbolTable : angle::NonCopyable, TSymbolTableBase
 
     std::vector<std::unique_ptr<TSymbolTableLevel>> mTable;
 
-    // There's one precision stack level for predefined precisions and then one level for each scope
-    // in table.
+    std::shared_ptr<const SharedBuiltIns> mBuiltIns;
+
+    // There's one precision stack level for each scope in table.  The predefined precisions are
+    // part of the shared built-ins.
     typedef TMap<TBasicType, TPrecision> PrecisionStackLevel;
     std::vector<std::unique_ptr<PrecisionStackLevel>> mPrecisionStack;
 
@@ -13,7 +13,7 @@
 
 #include "compiler/translator/InfoSink.h"
 #include "compiler/translator/ParseContext.h"
-#include "compiler/translator/tree_util/IntermTraverse.h"
+#include "compiler/translator/tree_util/FusedTraverser.h"
 
 namespace sh
 {
@@ -26,15 +26,17 @@ void error(const TIntermSymbol &symbol, const char *reason, TDiagnostics *diagno
     diagnostics->error(symbol.getLine(), reason, symbol.getName().data());
 }
 
-class ValidateOutputsTraverser : public TIntermTraverser
+class ValidateOutputsTraverser : public TFusableTraverser
 {
   public:
     ValidateOutputsTraverser(const TExtensionBehavior &extBehavior,
                              const ShBuiltInResources &resources,
                              bool usesPixelLocalStorage,
-                             bool isWebGL);
+                             bool isWebGL,
+                             TDiagnostics *diagnostics);
 
     void validate(TDiagnostics *diagnostics) const;
+    bool finishTraversal(TCompiler *compiler, TIntermBlock *root) override;
 
     void visitSymbol(TIntermSymbol *) override;
 
@@ -52,13 +54,21 @@ class ValidateOutputsTraverser : public TIntermTraverser
     OutputVector mUnspecifiedLocationOutputs;
     OutputVector mYuvOutputs;
     std::set<int> mVisitedSymbols;  // Visited symbol ids.
+
+    TDiagnostics *mDiagnostics;
 };
 
 ValidateOutputsTraverser::ValidateOutputsTraverser(const TExtensionBehavior &extBehavior,
                                                    const ShBuiltInResources &resources,
                                                    bool usesPixelLocalStorage,
-                                                   bool isWebGL)
-    : TIntermTraverser(true, false, false),
+                                                   bool isWebGL,
+                                                   TDiagnostics *diagnostics)
+    : TFusableTraverser(true,
+                        false,
+                        false,
+                        nullptr,
+                        FusedPassAccess::ReadOnly,
+                        TIntermNodeTypeSet{TIntermNodeType::Symbol}),
       mMaxDrawBuffers(resources.MaxDrawBuffers),
       mMaxDualSourceDrawBuffers(resources.MaxDualSourceDrawBuffers),
       mEnablesBlendFuncExtended(
@@ -66,7 +76,8 @@ ValidateOutputsTraverser::ValidateOutputsTraverser(const TExtensionBehavior &ext
       mUsesIndex1(false),
       mUsesPixelLocalStorage(usesPixelLocalStorage),
       mIsWebGL(isWebGL),
-      mUsesFragDepth(false)
+      mUsesFragDepth(false),
+      mDiagnostics(diagnostics)
 {}
 
 void ValidateOutputsTraverser::visitSymbol(TIntermSymbol *symbol)
@@ -219,6 +230,13 @@ void ValidateOutputsTraverser::validate(TDiagnostics *diagnostics) const
     }
 }
 
+bool ValidateOutputsTraverser::finishTraversal(TCompiler *compiler, TIntermBlock *root)
+{
+    int numErrorsBefore = mDiagnostics->numErrors();
+    validate(mDiagnostics);
+    return (mDiagnostics->numErrors() == numErrorsBefore);
+}
+
 }  // anonymous namespace
 
 bool ValidateOutputs(TIntermBlock *root,
@@ -229,11 +247,20 @@ bool ValidateOutputs(TIntermBlock *root,
                      TDiagnostics *diagnostics)
 {
     ValidateOutputsTraverser validateOutputs(extBehavior, resources, usesPixelLocalStorage,
-                                             isWebGL);
+                                             isWebGL, diagnostics);
     root->traverse(&validateOutputs);
-    int numErrorsBefore = diagnostics->numErrors();
-    validateOutputs.validate(diagnostics);
-    return (diagnostics->numErrors() == numErrorsBefore);
+    return validateOutputs.finishTraversal(nullptr, root);
+}
+
+void ValidateOutputs(TFusedTraverser *fusedTraverser,
+                     const TExtensionBehavior &extBehavior,
+                     const ShBuiltInResources &resources,
+                     bool usesPixelLocalStorage,
+                     bool isWebGL,
+                     TDiagnostics *diagnostics)
+{
+    fusedTraverser->addTraverser(new ValidateOutputsTraverser(
+        extBehavior, resources, usesPixelLocalStorage, isWebGL, diagnostics));
 }
 
 }  // namespace sh
@@ -19,6 +19,7 @@ namespace sh
 {
 
 class TCompiler;
+class TFusedTraverser;
 class TIntermBlock;
 class TDiagnostics;
 
@@ -30,6 +31,15 @@ bool ValidateOutputs(TIntermBlock *root,
                      bool isWebGL,
                      TDiagnostics *diagnostics);
 
+// Same as above, as part of the walk of |fusedTraverser|.  The result is returned by
+// TFusedTraverser::run.
+void ValidateOutputs(TFusedTraverser *fusedTraverser,
+                     const TExtensionBehavior &extBehavior,
+                     const ShBuiltInResources &resources,
+                     bool usesPixelLocalStorage,
+                     bool isWebGL,
+                     TDiagnostics *diagnostics);
+
 }  // namespace sh
 
 #endif  // COMPILER_TRANSLATOR_VALIDATEOUTPUTS_H_
@@ -13,7 +13,7 @@
 #include "compiler/translator/Symbol.h"
 #include "compiler/translator/SymbolTable.h"
 #include "compiler/translator/blocklayout.h"
-#include "compiler/translator/tree_util/IntermTraverse.h"
+#include "compiler/translator/tree_util/FusedTraverser.h"
 #include "compiler/translator/util.h"
 
 namespace sh
@@ -34,11 +34,17 @@ constexpr size_t kMaxTotalPrivateVariableSizeInBytes = static_cast<size_t>(16) *
 // Traverses intermediate tree to ensure that the shader does not
 // exceed certain implementation-defined limits on the sizes of types.
 // Some code was copied from the CollectVariables pass.
-class ValidateTypeSizeLimitationsTraverser : public TIntermTraverser
+class ValidateTypeSizeLimitationsTraverser : public TFusableTraverser
 {
   public:
     ValidateTypeSizeLimitationsTraverser(TSymbolTable *symbolTable, TDiagnostics *diagnostics)
-        : TIntermTraverser(true, false, false, symbolTable),
+        : TFusableTraverser(true,
+                            false,
+                            false,
+                            symbolTable,
+                            FusedPassAccess::ReadOnly,
+                            TIntermNodeTypeSet{TIntermNodeType::Declaration,
+                                               TIntermNodeType::FunctionPrototype}),
           mDiagnostics(diagnostics),
           mTotalPrivateVariablesSize(0)
     {
@@ -223,6 +229,12 @@ class ValidateTypeSizeLimitationsTraverser : public TIntermTraverser
         }
     }
 
+    bool finishTraversal(TCompiler *compiler, TIntermBlock *root) override
+    {
+        validateTotalPrivateVariableSize();
+        return mDiagnostics->numErrors() == 0;
+    }
+
   private:
     void error(TSourceLoc loc, const char *reason, const ImmutableString &token)
     {
@@ -347,4 +359,12 @@ bool ValidateTypeSizeLimitations(TIntermNode *root,
     return diagnostics->numErrors() == 0;
 }
 
+void ValidateTypeSizeLimitations(TFusedTraverser *fusedTraverser,
+                                 TSymbolTable *symbolTable,
+                                 TDiagnostics *diagnostics)
+{
+    fusedTraverser->addTraverser(
+        new ValidateTypeSizeLimitationsTraverser(symbolTable, diagnostics));
+}
+
 }  // namespace sh
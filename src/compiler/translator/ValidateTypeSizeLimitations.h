@@ -13,6 +13,7 @@ namespace sh
 {
 
 class TDiagnostics;
+class TFusedTraverser;
 
 // Returns true if the given shader does not violate certain
 // implementation-defined limits on the size of variables' types.
@@ -20,6 +21,12 @@ bool ValidateTypeSizeLimitations(TIntermNode *root,
                                  TSymbolTable *symbolTable,
                                  TDiagnostics *diagnostics);
 
+// Same as above, as part of the walk of |fusedTraverser|.  The result is returned by
+// TFusedTraverser::run.
+void ValidateTypeSizeLimitations(TFusedTraverser *fusedTraverser,
+                                 TSymbolTable *symbolTable,
+                                 TDiagnostics *diagnostics);
+
 }  // namespace sh
 
 #endif  // COMPILER_TRANSLATOR_VALIDATETYPESIZELIMITATIONS_H_
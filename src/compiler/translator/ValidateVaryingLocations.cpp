@@ -11,7 +11,7 @@
 
 #include "compiler/translator/Diagnostics.h"
 #include "compiler/translator/SymbolTable.h"
-#include "compiler/translator/tree_util/IntermTraverse.h"
+#include "compiler/translator/tree_util/FusedTraverser.h"
 #include "compiler/translator/util.h"
 
 namespace sh
@@ -273,11 +273,11 @@ void ValidateShaderInterfaceAndAssignLocations(TDiagnostics *diagnostics,
     }
 }
 
-class ValidateVaryingLocationsTraverser : public TIntermTraverser
+class ValidateVaryingLocationsTraverser : public TFusableTraverser
 {
   public:
-    ValidateVaryingLocationsTraverser(GLenum shaderType);
-    void validate(TDiagnostics *diagnostics);
+    ValidateVaryingLocationsTraverser(GLenum shaderType, TDiagnostics *diagnostics);
+    bool finishTraversal(TCompiler *compiler, TIntermBlock *root) override;
 
   private:
     bool visitDeclaration(Visit visit, TIntermDeclaration *node) override;
@@ -286,11 +286,23 @@ class ValidateVaryingLocationsTraverser : public TIntermTraverser
     VaryingVector mInputVaryingsWithLocation;
     VaryingVector mOutputVaryingsWithLocation;
     GLenum mShaderType;
+    TDiagnostics *mDiagnostics;
 };
 
-ValidateVaryingLocationsTraverser::ValidateVaryingLocationsTraverser(GLenum shaderType)
-    : TIntermTraverser(true, false, false), mShaderType(shaderType)
-{}
+ValidateVaryingLocationsTraverser::ValidateVaryingLocationsTraverser(GLenum shaderType,
+                                                                     TDiagnostics *diagnostics)
+    : TFusableTraverser(
+          true,
+          false,
+          false,
+          nullptr,
+          FusedPassAccess::ReadOnly,
+          TIntermNodeTypeSet{TIntermNodeType::Declaration, TIntermNodeType::FunctionDefinition}),
+      mShaderType(shaderType),
+      mDiagnostics(diagnostics)
+{
+    ASSERT(diagnostics);
+}
 
 bool ValidateVaryingLocationsTraverser::visitDeclaration(Visit visit, TIntermDeclaration *node)
 {
@@ -332,13 +344,14 @@ bool ValidateVaryingLocationsTraverser::visitFunctionDefinition(Visit visit,
     return false;
 }
 
-void ValidateVaryingLocationsTraverser::validate(TDiagnostics *diagnostics)
+bool ValidateVaryingLocationsTraverser::finishTraversal(TCompiler *compiler, TIntermBlock *root)
 {
-    ASSERT(diagnostics);
-
-    ValidateShaderInterfaceAndAssignLocations(diagnostics, mInputVaryingsWithLocation, mShaderType);
-    ValidateShaderInterfaceAndAssignLocations(diagnostics, mOutputVaryingsWithLocation,
+    int numErrorsBefore = mDiagnostics->numErrors();
+    ValidateShaderInterfaceAndAssignLocations(mDiagnostics, mInputVaryingsWithLocation,
                                               mShaderType);
+    ValidateShaderInterfaceAndAssignLocations(mDiagnostics, mOutputVaryingsWithLocation,
+                                              mShaderType);
+    return (mDiagnostics->numErrors() == numErrorsBefore);
 }
 
 }  // anonymous namespace
@@ -358,11 +371,16 @@ unsigned int CalculateVaryingLocationCount(const TType &varyingType, GLenum shad
 
 bool ValidateVaryingLocations(TIntermBlock *root, TDiagnostics *diagnostics, GLenum shaderType)
 {
-    ValidateVaryingLocationsTraverser varyingValidator(shaderType);
+    ValidateVaryingLocationsTraverser varyingValidator(shaderType, diagnostics);
     root->traverse(&varyingValidator);
-    int numErrorsBefore = diagnostics->numErrors();
-    varyingValidator.validate(diagnostics);
-    return (diagnostics->numErrors() == numErrorsBefore);
+    return varyingValidator.finishTraversal(nullptr, root);
+}
+
+void ValidateVaryingLocations(TFusedTraverser *fusedTraverser,
+                              TDiagnostics *diagnostics,
+                              GLenum shaderType)
+{
+    fusedTraverser->addTraverser(new ValidateVaryingLocationsTraverser(shaderType, diagnostics));
 }
 
 }  // namespace sh
@@ -15,6 +15,7 @@
 namespace sh
 {
 
+class TFusedTraverser;
 class TIntermBlock;
 class TIntermSymbol;
 class TDiagnostics;
@@ -22,6 +23,11 @@ class TType;
 
 unsigned int CalculateVaryingLocationCount(const TType &varyingType, GLenum shaderType);
 bool ValidateVaryingLocations(TIntermBlock *root, TDiagnostics *diagnostics, GLenum shaderType);
+// Same as above, as part of the walk of |fusedTraverser|.  The result is returned by
+// TFusedTraverser::run.
+void ValidateVaryingLocations(TFusedTraverser *fusedTraverser,
+                              TDiagnostics *diagnostics,
+                              GLenum shaderType);
 
 }  // namespace sh
 
@@ -109,6 +109,7 @@ bool TranslatorESSL::translate(TIntermBlock *root,
     {
         return false;
     }
+    recordPassStatistics("RecordConstantPrecision", root);
 
     // Write emulated built-in functions if needed.
     if (!getBuiltInFunctionEmulator().isOutputEmpty())
@@ -164,10 +165,12 @@ bool TranslatorESSL::translate(TIntermBlock *root,
             if (!ZeroDisabledClipDistanceAssignments(this, root, &getSymbolTable(), getShaderType(),
                                                      clipDistanceEnabledSymbol))
                 return false;
+            recordPassStatistics("ZeroDisabledClipDistanceAssignments", root);
 
             // The previous operation always redeclares gl_ClipDistance
             if (!DeclarePerVertexBlocks(this, root, &getSymbolTable(), nullptr, nullptr))
                 return false;
+            recordPassStatistics("DeclarePerVertexBlocks", root);
         }
         else if (areClipDistanceOrCullDistanceUsed() &&
                  (IsExtensionEnabled(getExtensionBehavior(), TExtension::EXT_clip_cull_distance) ||
@@ -177,6 +180,7 @@ bool TranslatorESSL::translate(TIntermBlock *root,
             // the redeclared extension built-ins still should be moved to gl_PerVertex
             if (!DeclarePerVertexBlocks(this, root, &getSymbolTable(), nullptr, nullptr))
                 return false;
+            recordPassStatistics("DeclarePerVertexBlocks", root);
         }
 
         if (compileOptions.emulateClipOrigin)
@@ -185,6 +189,7 @@ bool TranslatorESSL::translate(TIntermBlock *root,
             {
                 return false;
             }
+            recordPassStatistics("EmulateClipOrigin", root);
         }
     }
 
@@ -210,6 +215,7 @@ bool TranslatorESSL::translate(TIntermBlock *root,
     TOutputESSL outputESSL(this, sink, compileOptions);
 
     root->traverse(&outputESSL);
+    recordPassStatistics("OutputESSL", root);
 
     return true;
 }
@@ -56,6 +56,7 @@ bool TranslatorGLSL::translate(TIntermBlock *root,
 
     // Write extension behaviour as needed
     writeExtensionBehavior(root, compileOptions);
+    recordPassStatistics("WriteVersionAndExtensionBehavior", root);
 
     // Write pragmas after extensions because some drivers consider pragmas
     // like non-preprocessor tokens.
@@ -101,6 +102,7 @@ bool TranslatorGLSL::translate(TIntermBlock *root,
             {
                 return false;
             }
+            recordPassStatistics("PreTransformTextureCubeGradDerivatives", root);
         }
     }
 
@@ -110,6 +112,7 @@ bool TranslatorGLSL::translate(TIntermBlock *root,
         {
             return false;
         }
+        recordPassStatistics("RewriteTexelFetchOffset", root);
     }
 
     if (compileOptions.rewriteFloatUnaryMinusOperator)
@@ -118,6 +121,7 @@ bool TranslatorGLSL::translate(TIntermBlock *root,
         {
             return false;
         }
+        recordPassStatistics("RewriteUnaryMinusOperatorFloat", root);
     }
 
     if (compileOptions.rewriteRowMajorMatrices && getShaderVersion() >= 300)
@@ -126,6 +130,7 @@ bool TranslatorGLSL::translate(TIntermBlock *root,
         {
             return false;
         }
+        recordPassStatistics("RewriteRowMajorMatrices", root);
     }
 
     // Write emulated built-in functions if needed.
@@ -227,6 +232,7 @@ bool TranslatorGLSL::translate(TIntermBlock *root,
     TOutputGLSL outputGLSL(this, sink, compileOptions);
 
     root->traverse(&outputGLSL);
+    recordPassStatistics("OutputGLSL", root);
 
     return true;
 }
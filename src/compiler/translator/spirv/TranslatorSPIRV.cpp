@@ -760,6 +760,7 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
         {
             return false;
         }
+        recordPassStatistics("ShaderBuiltinsWorkaround", root);
     }
 
     // Write out default uniforms into a uniform block assigned to a specific set/binding.
@@ -808,6 +809,7 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
     {
         return false;
     }
+    recordPassStatistics("MonomorphizeUnsupportedFunctions", root);
 
     if (aggregateTypesUsedForUniforms > 0)
     {
@@ -815,6 +817,7 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
         {
             return false;
         }
+        recordPassStatistics("SeparateStructFromUniformDeclarations", root);
 
         int removedUniformsCount;
 
@@ -823,6 +826,7 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
             return false;
         }
         defaultUniformCount -= removedUniformsCount;
+        recordPassStatistics("RewriteStructSamplers", root);
     }
 
     // Replace array of array of opaque uniforms with a flattened array.  This is run after
@@ -832,11 +836,13 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
     {
         return false;
     }
+    recordPassStatistics("RewriteArrayOfArrayOfOpaqueUniforms", root);
 
     if (!FlagSamplersForTexelFetch(this, root, &getSymbolTable(), &mUniforms))
     {
         return false;
     }
+    recordPassStatistics("FlagSamplersForTexelFetch", root);
 
     gl::ShaderType packedShaderType = gl::FromGLenum<gl::ShaderType>(getShaderType());
 
@@ -846,6 +852,7 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
         {
             return false;
         }
+        recordPassStatistics("DeclareDefaultUniforms", root);
     }
 
     if (getShaderType() == GL_COMPUTE_SHADER)
@@ -867,6 +874,7 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
         {
             return false;
         }
+        recordPassStatistics("RewriteR32fImages", root);
     }
 
     if (atomicCounterCount > 0)
@@ -881,6 +889,7 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
         }
         assignSpirvId(atomicCounters->getType().getInterfaceBlock()->uniqueId(),
                       vk::spirv::kIdAtomicCounterBlock);
+        recordPassStatistics("RewriteAtomicCounters", root);
     }
     else if (getShaderVersion() >= 310)
     {
@@ -891,6 +900,7 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
         {
             return false;
         }
+        recordPassStatistics("RemoveAtomicCounterBuiltins", root);
     }
 
     if (packedShaderType != gl::ShaderType::Compute)
@@ -899,6 +909,7 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
         {
             return false;
         }
+        recordPassStatistics("ReplaceGLDepthRangeWithDriverUniform", root);
 
         // Search for the gl_ClipDistance/gl_CullDistance usage, if its used, we need to do some
         // replacements.
@@ -927,16 +938,22 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
             }
         }
 
-        if (useClipDistance &&
-            !ReplaceClipDistanceAssignments(this, root, &getSymbolTable(), getShaderType(),
-                                            driverUniforms->getClipDistancesEnabled()))
+        if (useClipDistance)
         {
-            return false;
+            if (!ReplaceClipDistanceAssignments(this, root, &getSymbolTable(), getShaderType(),
+                                                driverUniforms->getClipDistancesEnabled()))
+            {
+                return false;
+            }
+            recordPassStatistics("ReplaceClipDistanceAssignments", root);
         }
-        if (useCullDistance &&
-            !ReplaceCullDistanceAssignments(this, root, &getSymbolTable(), getShaderType()))
+        if (useCullDistance)
         {
-            return false;
+            if (!ReplaceCullDistanceAssignments(this, root, &getSymbolTable(), getShaderType()))
+            {
+                return false;
+            }
+            recordPassStatistics("ReplaceCullDistanceAssignments", root);
         }
     }
 
@@ -949,6 +966,7 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
             {
                 return false;
             }
+            recordPassStatistics("AddXfbExtensionSupport", root);
         }
 
         // Add support code for pre-rotation and depth correction in the vertex processing stages.
@@ -957,6 +975,7 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
         {
             return false;
         }
+        recordPassStatistics("AddVertexTransformationSupport", root);
     }
 
     if (IsExtensionEnabled(getExtensionBehavior(), TExtension::EXT_YUV_target))
@@ -965,11 +984,13 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
         {
             return false;
         }
+        recordPassStatistics("EmulateYUVBuiltIns", root);
 
         if (!ReswizzleYUVTextureAccess(this, root, &getSymbolTable()))
         {
             return false;
         }
+        recordPassStatistics("ReswizzleYUVTextureAccess", root);
     }
 
     switch (packedShaderType)
@@ -1057,6 +1078,7 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
                 {
                     return false;
                 }
+                recordPassStatistics("RotateAndFlipBuiltinVariable", root);
             }
 
             if (useSamplePosition)
@@ -1079,6 +1101,7 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
                 {
                     return false;
                 }
+                recordPassStatistics("RotateAndFlipBuiltinVariable", root);
             }
 
             if (usesFragCoord)
@@ -1088,6 +1111,7 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
                 {
                     return false;
                 }
+                recordPassStatistics("InsertFragCoordCorrection", root);
             }
 
             // Emulate gl_FragColor and gl_FragData with normal output variables.
@@ -1095,6 +1119,7 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
             {
                 return false;
             }
+            recordPassStatistics("EmulateFragColorData", root);
 
             InputAttachmentMap inputAttachmentMap;
 
@@ -1105,6 +1130,7 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
                 {
                     return false;
                 }
+                recordPassStatistics("EmulateFramebufferFetch", root);
             }
 
             // This should be operated after doing ReplaceLastFragData and ReplaceInOutVariables,
@@ -1112,12 +1138,15 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
             // check the existing input attachment variables and if there is no existing input
             // attachment variable then create a new one.
             if (getAdvancedBlendEquations().any() &&
-                compileOptions.addAdvancedBlendEquationsEmulation &&
-                !EmulateAdvancedBlendEquations(this, root, &getSymbolTable(),
-                                               getAdvancedBlendEquations(), driverUniforms,
-                                               &inputAttachmentMap))
+                compileOptions.addAdvancedBlendEquationsEmulation)
             {
-                return false;
+                if (!EmulateAdvancedBlendEquations(this, root, &getSymbolTable(),
+                                                   getAdvancedBlendEquations(), driverUniforms,
+                                                   &inputAttachmentMap))
+                {
+                    return false;
+                }
+                recordPassStatistics("EmulateAdvancedBlendEquations", root);
             }
 
             // Input attachments are potentially added in framebuffer fetch and advanced blend
@@ -1129,16 +1158,22 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
             {
                 return false;
             }
+            recordPassStatistics("RewriteDfdy", root);
 
             if (!RewriteInterpolateAtOffset(this, root, &getSymbolTable(), getShaderVersion(),
                                             specConst, driverUniforms))
             {
                 return false;
             }
+            recordPassStatistics("RewriteInterpolateAtOffset", root);
 
-            if (usesSampleMaskIn && !RewriteSampleMaskIn(this, root, &getSymbolTable()))
+            if (usesSampleMaskIn)
             {
-                return false;
+                if (!RewriteSampleMaskIn(this, root, &getSymbolTable()))
+                {
+                    return false;
+                }
+                recordPassStatistics("RewriteSampleMaskIn", root);
             }
 
             if (hasGLSampleMask)
@@ -1148,6 +1183,7 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
                 {
                     return false;
                 }
+                recordPassStatistics("RewriteSampleMask", root);
             }
 
             {
@@ -1159,14 +1195,18 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
                 {
                     return false;
                 }
+                recordPassStatistics("ReplaceGLNumSamples", root);
             }
 
             if (IsExtensionEnabled(getExtensionBehavior(), TExtension::EXT_YUV_target))
             {
-                if (yuvOutput != nullptr &&
-                    !AdjustYUVOutput(this, root, &getSymbolTable(), *yuvOutput))
+                if (yuvOutput != nullptr)
                 {
-                    return false;
+                    if (!AdjustYUVOutput(this, root, &getSymbolTable(), *yuvOutput))
+                    {
+                        return false;
+                    }
+                    recordPassStatistics("AdjustYUVOutput", root);
                 }
             }
 
@@ -1175,6 +1215,7 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
             {
                 return false;
             }
+            recordPassStatistics("EmulateDithering", root);
 
             break;
         }
@@ -1190,6 +1231,7 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
                 {
                     return false;
                 }
+                recordPassStatistics("AddXfbEmulationSupport", root);
             }
 
             break;
@@ -1200,6 +1242,7 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
             {
                 return false;
             }
+            recordPassStatistics("ClampGLLayer", root);
             break;
 
         case gl::ShaderType::TessControl:
@@ -1208,6 +1251,7 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
             {
                 return false;
             }
+            recordPassStatistics("ReplaceGLBoundingBoxWithGlobal", root);
             break;
         }
 
@@ -1245,6 +1289,7 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
     {
         return false;
     }
+    recordPassStatistics("DeclarePerVertexBlocks", root);
 
     if (inputPerVertex)
     {
@@ -1286,7 +1331,13 @@ bool TranslatorSPIRV::translate(TIntermBlock *root,
         return false;
     }
 
-    return OutputSPIRV(this, root, compileOptions, mUniqueToSpirvIdMap, mFirstUnusedSpirvId);
+    if (!OutputSPIRV(this, root, compileOptions, mUniqueToSpirvIdMap, mFirstUnusedSpirvId))
+    {
+        return false;
+    }
+    recordPassStatistics("OutputSPIRV", root);
+
+    return true;
 }
 
 bool TranslatorSPIRV::shouldFlattenPragmaStdglInvariantAll()
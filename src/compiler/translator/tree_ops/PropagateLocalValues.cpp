@@ -0,0 +1,252 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// PropagateLocalValues.cpp: Replaces the uses of local variables that are never written after their
+// declaration with their initial value.
+//
+
+#include "compiler/translator/tree_ops/PropagateLocalValues.h"
+
+#include <map>
+
+#include "common/hash_containers.h"
+#include "compiler/translator/Symbol.h"
+#include "compiler/translator/tree_util/IntermTraverse.h"
+
+namespace sh
+{
+
+namespace
+{
+bool IsDeclarator(TIntermSymbol *node, TIntermNode *parent)
+{
+    TIntermBinary *initialization = parent != nullptr ? parent->getAsBinaryNode() : nullptr;
+    return initialization != nullptr && initialization->getOp() == EOpInitialize &&
+           initialization->getLeft() == node;
+}
+
+bool CanPropagateType(const TType &type)
+{
+    if (type.isArray() || type.getStruct() != nullptr)
+    {
+        return false;
+    }
+
+    switch (type.getBasicType())
+    {
+        case EbtFloat:
+        case EbtInt:
+        case EbtUInt:
+        case EbtBool:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// Variables with these qualifiers can only change through writes in the shader, so a copy of one
+// that is never written can be replaced with the variable itself.
+bool IsCopySourceQualifier(TQualifier qualifier)
+{
+    switch (qualifier)
+    {
+        case EvqTemporary:
+        case EvqParamIn:
+        case EvqParamConst:
+        case EvqUniform:
+            return true;
+        default:
+            return false;
+    }
+}
+
+class CollectLocalValuesTraverser : public TLValueTrackingTraverser
+{
+  public:
+    CollectLocalValuesTraverser(TSymbolTable *symbolTable)
+        : TLValueTrackingTraverser(true, false, false, symbolTable)
+    {}
+
+    void visitSymbol(TIntermSymbol *node) override;
+    void visitFunctionPrototype(TIntermFunctionPrototype *node) override;
+    bool visitDeclaration(Visit visit, TIntermDeclaration *node) override;
+
+    // Returns the value that the uses of the variable can be replaced with, or nullptr if they
+    // can't be replaced.  The returned node must be copied before it is added to the tree.
+    TIntermTyped *getReplacement(const TVariable &variable);
+
+  private:
+    struct VariableInfo
+    {
+        TIntermTyped *initializer = nullptr;
+        bool isWritten            = false;
+
+        bool isReplacementResolved = false;
+        TIntermTyped *replacement  = nullptr;
+    };
+
+    bool isUnchangingCopySource(const TVariable &variable) const;
+
+    angle::HashMap<int, VariableInfo> mVariables;
+    // Number of declarations of each name, including function parameters.
+    std::map<ImmutableString, int> mDeclaredNameCounts;
+};
+
+void CollectLocalValuesTraverser::visitSymbol(TIntermSymbol *node)
+{
+    if (isLValueRequiredHere() && !IsDeclarator(node, getParentNode()))
+    {
+        mVariables[node->uniqueId().get()].isWritten = true;
+    }
+}
+
+void CollectLocalValuesTraverser::visitFunctionPrototype(TIntermFunctionPrototype *node)
+{
+    const TFunction *function = node->getFunction();
+    for (size_t paramIndex = 0; paramIndex < function->getParamCount(); ++paramIndex)
+    {
+        mDeclaredNameCounts[function->getParam(paramIndex)->name()]++;
+    }
+}
+
+bool CollectLocalValuesTraverser::visitDeclaration(Visit visit, TIntermDeclaration *node)
+{
+    for (TIntermNode *declarator : *node->getSequence())
+    {
+        TIntermBinary *initialization = declarator->getAsBinaryNode();
+        TIntermSymbol *symbol         = initialization != nullptr
+                                            ? initialization->getLeft()->getAsSymbolNode()
+                                            : declarator->getAsSymbolNode();
+        ASSERT(symbol != nullptr);
+
+        mDeclaredNameCounts[symbol->getName()]++;
+
+        if (initialization != nullptr && symbol->getQualifier() == EvqTemporary)
+        {
+            mVariables[symbol->uniqueId().get()].initializer = initialization->getRight();
+        }
+    }
+    return true;
+}
+
+bool CollectLocalValuesTraverser::isUnchangingCopySource(const TVariable &variable) const
+{
+    if (variable.symbolType() != SymbolType::UserDefined ||
+        !IsCopySourceQualifier(variable.getType().getQualifier()))
+    {
+        return false;
+    }
+
+    // The source is read by name where the copy was read, so it must not be hidden by another
+    // declaration with the same name there.
+    auto nameIter = mDeclaredNameCounts.find(variable.name());
+    if (nameIter == mDeclaredNameCounts.end() || nameIter->second != 1)
+    {
+        return false;
+    }
+
+    auto iter = mVariables.find(variable.uniqueId().get());
+    return iter == mVariables.end() || !iter->second.isWritten;
+}
+
+TIntermTyped *CollectLocalValuesTraverser::getReplacement(const TVariable &variable)
+{
+    auto iter = mVariables.find(variable.uniqueId().get());
+    if (iter == mVariables.end())
+    {
+        return nullptr;
+    }
+
+    VariableInfo &info = iter->second;
+    if (info.isReplacementResolved)
+    {
+        return info.replacement;
+    }
+    info.isReplacementResolved = true;
+
+    const TType &type = variable.getType();
+    if (info.initializer == nullptr || info.isWritten || !CanPropagateType(type))
+    {
+        return nullptr;
+    }
+
+    TIntermConstantUnion *constant = info.initializer->getAsConstantUnion();
+    if (constant != nullptr)
+    {
+        // Keep the precision of the variable, so that the precision of the expressions it is used
+        // in doesn't change.
+        TType constantType(type);
+        constantType.setQualifier(EvqConst);
+        info.replacement = new TIntermConstantUnion(constant->getConstantValue(), constantType);
+        return info.replacement;
+    }
+
+    TIntermSymbol *source = info.initializer->getAsSymbolNode();
+    if (source == nullptr)
+    {
+        return nullptr;
+    }
+
+    const TVariable &sourceVariable = source->variable();
+    const TType &sourceType         = sourceVariable.getType();
+    if (!isUnchangingCopySource(sourceVariable) || sourceType != type ||
+        sourceType.getPrecision() != type.getPrecision())
+    {
+        return nullptr;
+    }
+
+    // Copies of copies and of constants are replaced with the original value.
+    TIntermTyped *sourceReplacement = getReplacement(sourceVariable);
+    info.replacement                = sourceReplacement != nullptr ? sourceReplacement : source;
+    return info.replacement;
+}
+
+class ReplaceLocalValuesTraverser : public TIntermTraverser
+{
+  public:
+    ReplaceLocalValuesTraverser(CollectLocalValuesTraverser *localValues)
+        : TIntermTraverser(true, false, false), mLocalValues(localValues)
+    {}
+
+    void visitSymbol(TIntermSymbol *node) override
+    {
+        TIntermNode *parent = getParentNode();
+        if (IsDeclarator(node, parent))
+        {
+            return;
+        }
+
+        // Keep dynamically indexed variables, as indexing a constant dynamically would otherwise
+        // need to be emulated by some outputs.
+        TIntermBinary *parentBinary = parent != nullptr ? parent->getAsBinaryNode() : nullptr;
+        if (parentBinary != nullptr && parentBinary->getOp() == EOpIndexIndirect &&
+            parentBinary->getLeft() == node)
+        {
+            return;
+        }
+
+        TIntermTyped *replacement = mLocalValues->getReplacement(node->variable());
+        if (replacement != nullptr)
+        {
+            queueReplacement(replacement->deepCopy(), OriginalNode::IS_DROPPED);
+        }
+    }
+
+  private:
+    CollectLocalValuesTraverser *mLocalValues;
+};
+}  // anonymous namespace
+
+bool PropagateLocalValues(TCompiler *compiler, TIntermBlock *root, TSymbolTable *symbolTable)
+{
+    CollectLocalValuesTraverser collect(symbolTable);
+    root->traverse(&collect);
+
+    ReplaceLocalValuesTraverser replace(&collect);
+    root->traverse(&replace);
+    return replace.updateTree(compiler, root);
+}
+
+}  // namespace sh
@@ -0,0 +1,33 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// PropagateLocalValues.h: Replaces the uses of local variables that are never written after their
+// declaration with the value they are initialized with, if that is a constant or another variable
+// that is never written.  For example:
+//     float scale = 2.0;
+//     vec4 color  = uColor;
+//     gl_FragColor = color * scale;
+// is turned into
+//     gl_FragColor = uColor * 2.0;
+// once RemoveUnreferencedVariables has removed the declarations.  The expressions that become
+// constant are left for FoldExpressions.
+
+#ifndef COMPILER_TRANSLATOR_TREEOPS_PROPAGATELOCALVALUES_H_
+#define COMPILER_TRANSLATOR_TREEOPS_PROPAGATELOCALVALUES_H_
+
+#include "common/angleutils.h"
+
+namespace sh
+{
+class TCompiler;
+class TIntermBlock;
+class TSymbolTable;
+
+[[nodiscard]] bool PropagateLocalValues(TCompiler *compiler,
+                                        TIntermBlock *root,
+                                        TSymbolTable *symbolTable);
+}  // namespace sh
+
+#endif  // COMPILER_TRANSLATOR_TREEOPS_PROPAGATELOCALVALUES_H_
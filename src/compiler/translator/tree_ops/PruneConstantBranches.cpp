@@ -0,0 +1,104 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// PruneConstantBranches.cpp: Removes the code that a constant condition makes unreachable.
+//
+
+#include "compiler/translator/tree_ops/PruneConstantBranches.h"
+
+#include "compiler/translator/tree_util/IntermTraverse.h"
+
+namespace sh
+{
+
+namespace
+{
+// Returns whether the condition is constant, and its value if so.
+bool GetConstantCondition(TIntermTyped *condition, bool *valueOut)
+{
+    TIntermConstantUnion *constant = condition->getAsConstantUnion();
+    if (constant == nullptr)
+    {
+        return false;
+    }
+
+    ASSERT(constant->getBasicType() == EbtBool && constant->isScalar());
+    *valueOut = constant->getBConst(0);
+    return true;
+}
+
+class PruneConstantBranchesTraverser : public TIntermTraverser
+{
+  public:
+    PruneConstantBranchesTraverser() : TIntermTraverser(true, false, false) {}
+
+    bool visitIfElse(Visit visit, TIntermIfElse *node) override;
+    bool visitLoop(Visit visit, TIntermLoop *node) override;
+
+  private:
+    void replaceStatement(TIntermNode *statement, TIntermBlock *replacement);
+};
+
+void PruneConstantBranchesTraverser::replaceStatement(TIntermNode *statement,
+                                                      TIntermBlock *replacement)
+{
+    // Statements are always in blocks.  The replacement is kept in its own block, so that the
+    // variables it declares keep their scope.
+    TIntermBlock *parentBlock = getParentNode()->getAsBlock();
+    ASSERT(parentBlock != nullptr);
+
+    TIntermSequence replacements;
+    if (replacement != nullptr && !replacement->getSequence()->empty())
+    {
+        replacements.push_back(replacement);
+    }
+    mMultiReplacements.emplace_back(parentBlock, statement, std::move(replacements));
+}
+
+bool PruneConstantBranchesTraverser::visitIfElse(Visit visit, TIntermIfElse *node)
+{
+    bool condition = false;
+    if (!GetConstantCondition(node->getCondition(), &condition))
+    {
+        return true;
+    }
+
+    TIntermBlock *taken = condition ? node->getTrueBlock() : node->getFalseBlock();
+    replaceStatement(node, taken);
+
+    // The taken block is moved to the parent as a whole, so the constant branches nested in it can
+    // still be replaced.
+    return true;
+}
+
+bool PruneConstantBranchesTraverser::visitLoop(Visit visit, TIntermLoop *node)
+{
+    // The body of a do-while loop runs once even if the condition is false, but the break and
+    // continue statements in it would have to be removed to keep it.
+    bool condition = true;
+    if (node->getType() == ELoopDoWhile || node->getCondition() == nullptr ||
+        !GetConstantCondition(node->getCondition(), &condition) || condition)
+    {
+        return true;
+    }
+
+    TIntermBlock *init = nullptr;
+    if (node->getInit() != nullptr)
+    {
+        init = new TIntermBlock({node->getInit()});
+    }
+    replaceStatement(node, init);
+    return false;
+}
+}  // anonymous namespace
+
+bool PruneConstantBranches(TCompiler *compiler, TIntermBlock *root)
+{
+    PruneConstantBranchesTraverser traverser;
+    root->traverse(&traverser);
+    return traverser.updateTree(compiler, root);
+}
+
+}  // namespace sh
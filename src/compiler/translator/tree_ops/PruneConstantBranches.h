@@ -0,0 +1,26 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// PruneConstantBranches.h: Removes the code that a constant condition makes unreachable:
+//   1. If statements over a constant are replaced with the block that is taken, if any.
+//   2. While and for loops whose condition is constant false are replaced with their init
+//      statement, if any.
+// Conditions usually become constant through PropagateLocalValues and FoldExpressions, for example
+// with debug flags that are kept in local variables.
+
+#ifndef COMPILER_TRANSLATOR_TREEOPS_PRUNECONSTANTBRANCHES_H_
+#define COMPILER_TRANSLATOR_TREEOPS_PRUNECONSTANTBRANCHES_H_
+
+#include "common/angleutils.h"
+
+namespace sh
+{
+class TCompiler;
+class TIntermBlock;
+
+[[nodiscard]] bool PruneConstantBranches(TCompiler *compiler, TIntermBlock *root);
+}  // namespace sh
+
+#endif  // COMPILER_TRANSLATOR_TREEOPS_PRUNECONSTANTBRANCHES_H_
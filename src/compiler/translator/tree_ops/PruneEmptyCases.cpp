@@ -9,7 +9,7 @@
 #include "compiler/translator/tree_ops/PruneEmptyCases.h"
 
 #include "compiler/translator/Symbol.h"
-#include "compiler/translator/tree_util/IntermTraverse.h"
+#include "compiler/translator/tree_util/FusedTraverser.h"
 
 namespace sh
 {
@@ -49,25 +49,32 @@ bool AreEmptyBlocks(const TIntermSequence *statements)
     return true;
 }
 
-class PruneEmptyCasesTraverser : private TIntermTraverser
+class PruneEmptyCasesTraverser : public TFusableTraverser
 {
   public:
-    [[nodiscard]] static bool apply(TCompiler *compiler, TIntermBlock *root);
+    PruneEmptyCasesTraverser();
+    bool finishTraversal(TCompiler *compiler, TIntermBlock *root) override;
 
   private:
-    PruneEmptyCasesTraverser();
     bool visitSwitch(Visit visit, TIntermSwitch *node) override;
 };
 
-bool PruneEmptyCasesTraverser::apply(TCompiler *compiler, TIntermBlock *root)
+PruneEmptyCasesTraverser::PruneEmptyCasesTraverser()
+    : TFusableTraverser(true,
+                        false,
+                        false,
+                        nullptr,
+                        FusedPassAccess::LocalRewrite,
+                        TIntermNodeTypeSet{TIntermNodeType::Switch},
+                        TIntermNodeTypeSet{TIntermNodeType::Switch, TIntermNodeType::Case,
+                                           TIntermNodeType::Block})
+{}
+
+bool PruneEmptyCasesTraverser::finishTraversal(TCompiler *compiler, TIntermBlock *root)
 {
-    PruneEmptyCasesTraverser prune;
-    root->traverse(&prune);
-    return prune.updateTree(compiler, root);
+    return updateTree(compiler, root);
 }
 
-PruneEmptyCasesTraverser::PruneEmptyCasesTraverser() : TIntermTraverser(true, false, false) {}
-
 bool PruneEmptyCasesTraverser::visitSwitch(Visit visit, TIntermSwitch *node)
 {
     // This may mutate the statementList, but that's okay, since traversal has not yet reached
@@ -121,7 +128,14 @@ bool PruneEmptyCasesTraverser::visitSwitch(Visit visit, TIntermSwitch *node)
 
 bool PruneEmptyCases(TCompiler *compiler, TIntermBlock *root)
 {
-    return PruneEmptyCasesTraverser::apply(compiler, root);
+    PruneEmptyCasesTraverser prune;
+    root->traverse(&prune);
+    return prune.finishTraversal(compiler, root);
+}
+
+void PruneEmptyCases(TFusedTraverser *fusedTraverser)
+{
+    fusedTraverser->addTraverser(new PruneEmptyCasesTraverser);
 }
 
 }  // namespace sh
@@ -14,9 +14,13 @@
 namespace sh
 {
 class TCompiler;
+class TFusedTraverser;
 class TIntermBlock;
 
 [[nodiscard]] bool PruneEmptyCases(TCompiler *compiler, TIntermBlock *root);
+// Same as above, as part of the walk of |fusedTraverser|.  This pass rewrites the tree, so it must
+// be the last one added to the walk.
+void PruneEmptyCases(TFusedTraverser *fusedTraverser);
 }  // namespace sh
 
 #endif  // COMPILER_TRANSLATOR_TREEOPS_PRUNEEMPTYCASES_H_
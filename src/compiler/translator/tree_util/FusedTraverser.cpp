@@ -0,0 +1,266 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// FusedTraverser.cpp: Runs several AST passes in a single walk of the tree.
+
+#include "compiler/translator/tree_util/FusedTraverser.h"
+
+namespace sh
+{
+
+TFusableTraverser::TFusableTraverser(bool preVisit,
+                                     bool inVisit,
+                                     bool postVisit,
+                                     TSymbolTable *symbolTable,
+                                     FusedPassAccess access,
+                                     TIntermNodeTypeSet dependencies,
+                                     TIntermNodeTypeSet invalidations)
+    : TIntermTraverser(preVisit, inVisit, postVisit, symbolTable),
+      mAccess(access),
+      mDependencies(dependencies),
+      mInvalidations(invalidations)
+{
+    ASSERT(mDependencies.any());
+    ASSERT(mInvalidations.any() == (mAccess == FusedPassAccess::LocalRewrite));
+}
+
+TFusableTraverser::~TFusableTraverser() = default;
+
+void TFusableTraverser::traverseBinary(TIntermBinary *node)
+{
+    TIntermTraverser::traverseBinary(node);
+}
+
+void TFusableTraverser::traverseUnary(TIntermUnary *node)
+{
+    TIntermTraverser::traverseUnary(node);
+}
+
+void TFusableTraverser::traverseFunctionDefinition(TIntermFunctionDefinition *node)
+{
+    TIntermTraverser::traverseFunctionDefinition(node);
+}
+
+void TFusableTraverser::traverseAggregate(TIntermAggregate *node)
+{
+    TIntermTraverser::traverseAggregate(node);
+}
+
+void TFusableTraverser::traverseBlock(TIntermBlock *node)
+{
+    TIntermTraverser::traverseBlock(node);
+}
+
+void TFusableTraverser::traverseLoop(TIntermLoop *node)
+{
+    TIntermTraverser::traverseLoop(node);
+}
+
+TFusedTraverser::TFusedTraverser() : TIntermTraverser(true, true, true) {}
+
+TFusedTraverser::~TFusedTraverser()
+{
+    for (Member &member : mMembers)
+    {
+        delete member.traverser;
+    }
+}
+
+void TFusedTraverser::addTraverser(TFusableTraverser *traverser)
+{
+    ASSERT(traverser);
+    // Nothing can follow a pass that rewrites the tree in the same walk.
+    ASSERT(mMembers.empty() ||
+           mMembers.back().traverser->getAccess() == FusedPassAccess::ReadOnly);
+#if defined(ANGLE_ENABLE_ASSERTS)
+    // The passes before a rewrite would otherwise see a partially rewritten tree.
+    for (const Member &member : mMembers)
+    {
+        ASSERT((member.traverser->getDependencies() & traverser->getInvalidations()).none());
+    }
+#endif  // ANGLE_ENABLE_ASSERTS
+    mMembers.push_back({traverser, kNotSkipping});
+}
+
+bool TFusedTraverser::run(TCompiler *compiler, TIntermBlock *root)
+{
+    root->traverse(this);
+
+    for (Member &member : mMembers)
+    {
+        ASSERT(member.skipDepth == kNotSkipping);
+        member.traverser->mMaxDepth = mMaxDepth;
+        if (!member.traverser->finishTraversal(compiler, root))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void TFusedTraverser::swapTraversalState(TFusableTraverser *traverser)
+{
+    std::swap(traverser->mPath, mPath);
+    std::swap(traverser->mParentBlockStack, mParentBlockStack);
+    std::swap(traverser->mCurrentChildIndex, mCurrentChildIndex);
+    std::swap(traverser->mInGlobalScope, mInGlobalScope);
+}
+
+bool TFusedTraverser::visitMembers(Visit visit, TIntermNode *node)
+{
+    const size_t depth = mPath.size();
+    bool anyActive     = false;
+
+    for (Member &member : mMembers)
+    {
+        if (member.skipDepth <= depth)
+        {
+            continue;
+        }
+
+        TFusableTraverser *traverser = member.traverser;
+        const bool visitEnabled      = visit == PreVisit  ? traverser->preVisit
+                                       : visit == InVisit ? traverser->inVisit
+                                                          : traverser->postVisit;
+        if (visitEnabled && traverser->getDependencies().test(node->getNodeType()))
+        {
+            swapTraversalState(traverser);
+            const bool visitChildren = node->visit(visit, traverser);
+            swapTraversalState(traverser);
+
+            if (!visitChildren)
+            {
+                member.skipDepth = depth;
+                continue;
+            }
+        }
+        anyActive = true;
+    }
+
+    // Once the walk leaves this node, passes that skipped its subtree resume with its siblings.
+    if (visit == PostVisit || !anyActive)
+    {
+        for (Member &member : mMembers)
+        {
+            if (member.skipDepth == depth)
+            {
+                member.skipDepth = kNotSkipping;
+            }
+        }
+    }
+
+    return anyActive;
+}
+
+void TFusedTraverser::visitMembersLeaf(TIntermNode *node)
+{
+    const size_t depth = mPath.size();
+
+    for (Member &member : mMembers)
+    {
+        if (member.skipDepth <= depth ||
+            !member.traverser->getDependencies().test(node->getNodeType()))
+        {
+            continue;
+        }
+
+        swapTraversalState(member.traverser);
+        node->visit(PreVisit, member.traverser);
+        swapTraversalState(member.traverser);
+    }
+}
+
+void TFusedTraverser::visitSymbol(TIntermSymbol *node)
+{
+    visitMembersLeaf(node);
+}
+
+void TFusedTraverser::visitConstantUnion(TIntermConstantUnion *node)
+{
+    visitMembersLeaf(node);
+}
+
+bool TFusedTraverser::visitSwizzle(Visit visit, TIntermSwizzle *node)
+{
+    return visitMembers(visit, node);
+}
+
+bool TFusedTraverser::visitBinary(Visit visit, TIntermBinary *node)
+{
+    return visitMembers(visit, node);
+}
+
+bool TFusedTraverser::visitUnary(Visit visit, TIntermUnary *node)
+{
+    return visitMembers(visit, node);
+}
+
+bool TFusedTraverser::visitTernary(Visit visit, TIntermTernary *node)
+{
+    return visitMembers(visit, node);
+}
+
+bool TFusedTraverser::visitIfElse(Visit visit, TIntermIfElse *node)
+{
+    return visitMembers(visit, node);
+}
+
+bool TFusedTraverser::visitSwitch(Visit visit, TIntermSwitch *node)
+{
+    return visitMembers(visit, node);
+}
+
+bool TFusedTraverser::visitCase(Visit visit, TIntermCase *node)
+{
+    return visitMembers(visit, node);
+}
+
+void TFusedTraverser::visitFunctionPrototype(TIntermFunctionPrototype *node)
+{
+    visitMembersLeaf(node);
+}
+
+bool TFusedTraverser::visitFunctionDefinition(Visit visit, TIntermFunctionDefinition *node)
+{
+    return visitMembers(visit, node);
+}
+
+bool TFusedTraverser::visitAggregate(Visit visit, TIntermAggregate *node)
+{
+    return visitMembers(visit, node);
+}
+
+bool TFusedTraverser::visitBlock(Visit visit, TIntermBlock *node)
+{
+    return visitMembers(visit, node);
+}
+
+bool TFusedTraverser::visitGlobalQualifierDeclaration(Visit visit,
+                                                      TIntermGlobalQualifierDeclaration *node)
+{
+    return visitMembers(visit, node);
+}
+
+bool TFusedTraverser::visitDeclaration(Visit visit, TIntermDeclaration *node)
+{
+    return visitMembers(visit, node);
+}
+
+bool TFusedTraverser::visitLoop(Visit visit, TIntermLoop *node)
+{
+    return visitMembers(visit, node);
+}
+
+bool TFusedTraverser::visitBranch(Visit visit, TIntermBranch *node)
+{
+    return visitMembers(visit, node);
+}
+
+void TFusedTraverser::visitPreprocessorDirective(TIntermPreprocessorDirective *node)
+{
+    visitMembersLeaf(node);
+}
+
+}  // namespace sh
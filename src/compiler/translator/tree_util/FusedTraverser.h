@@ -0,0 +1,147 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// FusedTraverser.h: Runs several AST passes in a single walk of the tree.  Most passes only look
+//   at a few node types, so walking the tree once per pass is dominated by the cost of the walk
+//   itself.
+
+#ifndef COMPILER_TRANSLATOR_TREEUTIL_FUSEDTRAVERSER_H_
+#define COMPILER_TRANSLATOR_TREEUTIL_FUSEDTRAVERSER_H_
+
+#include "common/bitset_utils.h"
+#include "compiler/translator/tree_util/IntermTraverse.h"
+
+namespace sh
+{
+
+constexpr size_t kIntermNodeTypeCount =
+    static_cast<size_t>(TIntermNodeType::PreprocessorDirective) + 1;
+using TIntermNodeTypeSet = angle::BitSetT<kIntermNodeTypeCount, uint32_t, TIntermNodeType>;
+
+// Declares how a fusable pass uses the tree, which determines what it can be fused with.
+enum class FusedPassAccess
+{
+    // The pass only reads the tree, or annotates the nodes it visits without affecting the
+    // result of other passes.
+    ReadOnly,
+    // The pass changes the tree through the replacement queue or by modifying the node it visits
+    // before its children are traversed.  Passes visited after it in the same walk would see a
+    // partially transformed tree, so it is always the last pass of the walk.
+    LocalRewrite,
+};
+
+// Base class for traversers of passes that can run as part of a TFusedTraverser walk.  Such
+// passes use the default traversal, so they can't override the traverse*() functions, and any
+// work that depends on the whole tree having been visited is done in finishTraversal().
+//
+// Each pass also declares the node types it depends on, which must include every node type whose
+// visit function it overrides, as the fused walk only calls the pass for those.  A LocalRewrite
+// pass additionally declares the node types it invalidates, i.e. replaces, removes or modifies.
+//
+// Run standalone, a fusable traverser is used as any other:
+//
+//     root->traverse(&traverser);
+//     if (!traverser.finishTraversal(compiler, root)) ...
+class TFusableTraverser : public TIntermTraverser
+{
+  public:
+    TFusableTraverser(bool preVisit,
+                      bool inVisit,
+                      bool postVisit,
+                      TSymbolTable *symbolTable,
+                      FusedPassAccess access,
+                      TIntermNodeTypeSet dependencies,
+                      TIntermNodeTypeSet invalidations = {});
+    ~TFusableTraverser() override;
+
+    FusedPassAccess getAccess() const { return mAccess; }
+    TIntermNodeTypeSet getDependencies() const { return mDependencies; }
+    TIntermNodeTypeSet getInvalidations() const { return mInvalidations; }
+
+    // Completes the pass once the tree is walked, for example by validating what was collected or
+    // by applying the queued replacements.  Returns false if the pass failed.
+    [[nodiscard]] virtual bool finishTraversal(TCompiler *compiler, TIntermBlock *root) = 0;
+
+    void traverseBinary(TIntermBinary *node) final;
+    void traverseUnary(TIntermUnary *node) final;
+    void traverseFunctionDefinition(TIntermFunctionDefinition *node) final;
+    void traverseAggregate(TIntermAggregate *node) final;
+    void traverseBlock(TIntermBlock *node) final;
+    void traverseLoop(TIntermLoop *node) final;
+
+  private:
+    const FusedPassAccess mAccess;
+    const TIntermNodeTypeSet mDependencies;
+    const TIntermNodeTypeSet mInvalidations;
+};
+
+// Walks the tree once on behalf of a number of fusable passes.  Every node is visited by the
+// passes in the order they were added, and each pass sees the traversal state (path, parent
+// blocks, global scope) as if it walked the tree alone.  A pass returning false from a visit only
+// skips the subtree for that pass.
+//
+// Passes in the same walk see the tree as it was before the walk, so a pass can only be fused
+// with the passes before it if it doesn't depend on their results.  The exception is a
+// LocalRewrite pass, which must be added last, and whose invalidations can't be dependencies of
+// the passes before it.  The walk is then equivalent to running it first.
+class TFusedTraverser : public TIntermTraverser
+{
+  public:
+    TFusedTraverser();
+    ~TFusedTraverser() override;
+
+    // Adds a pass to the walk.  The traverser must be pool allocated, and is owned by the fused
+    // traverser.
+    void addTraverser(TFusableTraverser *traverser);
+    bool empty() const { return mMembers.empty(); }
+
+    // Walks the tree, then finishes the passes in the order they were added.  Returns false as
+    // soon as one of them fails.
+    [[nodiscard]] bool run(TCompiler *compiler, TIntermBlock *root);
+
+    void visitSymbol(TIntermSymbol *node) override;
+    void visitConstantUnion(TIntermConstantUnion *node) override;
+    bool visitSwizzle(Visit visit, TIntermSwizzle *node) override;
+    bool visitBinary(Visit visit, TIntermBinary *node) override;
+    bool visitUnary(Visit visit, TIntermUnary *node) override;
+    bool visitTernary(Visit visit, TIntermTernary *node) override;
+    bool visitIfElse(Visit visit, TIntermIfElse *node) override;
+    bool visitSwitch(Visit visit, TIntermSwitch *node) override;
+    bool visitCase(Visit visit, TIntermCase *node) override;
+    void visitFunctionPrototype(TIntermFunctionPrototype *node) override;
+    bool visitFunctionDefinition(Visit visit, TIntermFunctionDefinition *node) override;
+    bool visitAggregate(Visit visit, TIntermAggregate *node) override;
+    bool visitBlock(Visit visit, TIntermBlock *node) override;
+    bool visitGlobalQualifierDeclaration(Visit visit,
+                                         TIntermGlobalQualifierDeclaration *node) override;
+    bool visitDeclaration(Visit visit, TIntermDeclaration *node) override;
+    bool visitLoop(Visit visit, TIntermLoop *node) override;
+    bool visitBranch(Visit visit, TIntermBranch *node) override;
+    void visitPreprocessorDirective(TIntermPreprocessorDirective *node) override;
+
+  private:
+    struct Member
+    {
+        TFusableTraverser *traverser;
+        // The depth of the node whose subtree the pass skips, or kNotSkipping.
+        size_t skipDepth;
+    };
+    static constexpr size_t kNotSkipping = std::numeric_limits<size_t>::max();
+
+    // Forwards the visit to the passes that haven't skipped this node.  Returns whether any of
+    // them still needs the node's remaining children visited.
+    bool visitMembers(Visit visit, TIntermNode *node);
+    // Leaf nodes are visited regardless of the traverser's visit flags.
+    void visitMembersLeaf(TIntermNode *node);
+
+    // Lends the traversal state of the walk to a pass for the duration of its visit.
+    void swapTraversalState(TFusableTraverser *traverser);
+
+    std::vector<Member> mMembers;
+};
+
+}  // namespace sh
+
+#endif  // COMPILER_TRANSLATOR_TREEUTIL_FUSEDTRAVERSER_H_
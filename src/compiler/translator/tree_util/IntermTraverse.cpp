@@ -59,62 +59,77 @@ void TIntermTraverser::traverse(T *node)
 // exported from the TU.
 template void TIntermTraverser::traverse(TIntermNode *);
 
+// Dispatches on the type of the node instead of through a virtual function.  All the calls below
+// are then on the concrete classes, whose visit and child accessors are final and can be inlined
+// in the instantiations of TIntermTraverser::traverse.
 void TIntermNode::traverse(TIntermTraverser *it)
 {
-    it->traverse(this);
-}
-
-void TIntermSymbol::traverse(TIntermTraverser *it)
-{
-    TIntermTraverser::ScopedNodeInTraversalPath addToPath(it, this);
-    it->visitSymbol(this);
-}
-
-void TIntermConstantUnion::traverse(TIntermTraverser *it)
-{
-    TIntermTraverser::ScopedNodeInTraversalPath addToPath(it, this);
-    it->visitConstantUnion(this);
-}
-
-void TIntermFunctionPrototype::traverse(TIntermTraverser *it)
-{
-    TIntermTraverser::ScopedNodeInTraversalPath addToPath(it, this);
-    it->visitFunctionPrototype(this);
-}
-
-void TIntermBinary::traverse(TIntermTraverser *it)
-{
-    it->traverseBinary(this);
-}
-
-void TIntermUnary::traverse(TIntermTraverser *it)
-{
-    it->traverseUnary(this);
-}
-
-void TIntermFunctionDefinition::traverse(TIntermTraverser *it)
-{
-    it->traverseFunctionDefinition(this);
-}
-
-void TIntermBlock::traverse(TIntermTraverser *it)
-{
-    it->traverseBlock(this);
-}
-
-void TIntermAggregate::traverse(TIntermTraverser *it)
-{
-    it->traverseAggregate(this);
-}
-
-void TIntermLoop::traverse(TIntermTraverser *it)
-{
-    it->traverseLoop(this);
-}
-
-void TIntermPreprocessorDirective::traverse(TIntermTraverser *it)
-{
-    it->visitPreprocessorDirective(this);
+    switch (mNodeType)
+    {
+        case TIntermNodeType::Symbol:
+        {
+            TIntermTraverser::ScopedNodeInTraversalPath addToPath(it, this);
+            it->visitSymbol(static_cast<TIntermSymbol *>(this));
+            break;
+        }
+        case TIntermNodeType::ConstantUnion:
+        {
+            TIntermTraverser::ScopedNodeInTraversalPath addToPath(it, this);
+            it->visitConstantUnion(static_cast<TIntermConstantUnion *>(this));
+            break;
+        }
+        case TIntermNodeType::FunctionPrototype:
+        {
+            TIntermTraverser::ScopedNodeInTraversalPath addToPath(it, this);
+            it->visitFunctionPrototype(static_cast<TIntermFunctionPrototype *>(this));
+            break;
+        }
+        case TIntermNodeType::Swizzle:
+            it->traverse(static_cast<TIntermSwizzle *>(this));
+            break;
+        case TIntermNodeType::Binary:
+            it->traverseBinary(static_cast<TIntermBinary *>(this));
+            break;
+        case TIntermNodeType::Unary:
+            it->traverseUnary(static_cast<TIntermUnary *>(this));
+            break;
+        case TIntermNodeType::Ternary:
+            it->traverse(static_cast<TIntermTernary *>(this));
+            break;
+        case TIntermNodeType::Aggregate:
+            it->traverseAggregate(static_cast<TIntermAggregate *>(this));
+            break;
+        case TIntermNodeType::Block:
+            it->traverseBlock(static_cast<TIntermBlock *>(this));
+            break;
+        case TIntermNodeType::FunctionDefinition:
+            it->traverseFunctionDefinition(static_cast<TIntermFunctionDefinition *>(this));
+            break;
+        case TIntermNodeType::Declaration:
+            it->traverse(static_cast<TIntermDeclaration *>(this));
+            break;
+        case TIntermNodeType::GlobalQualifierDeclaration:
+            it->traverse(static_cast<TIntermGlobalQualifierDeclaration *>(this));
+            break;
+        case TIntermNodeType::IfElse:
+            it->traverse(static_cast<TIntermIfElse *>(this));
+            break;
+        case TIntermNodeType::Switch:
+            it->traverse(static_cast<TIntermSwitch *>(this));
+            break;
+        case TIntermNodeType::Case:
+            it->traverse(static_cast<TIntermCase *>(this));
+            break;
+        case TIntermNodeType::Loop:
+            it->traverseLoop(static_cast<TIntermLoop *>(this));
+            break;
+        case TIntermNodeType::Branch:
+            it->traverse(static_cast<TIntermBranch *>(this));
+            break;
+        case TIntermNodeType::PreprocessorDirective:
+            it->visitPreprocessorDirective(static_cast<TIntermPreprocessorDirective *>(this));
+            break;
+    }
 }
 
 bool TIntermSymbol::visit(Visit visit, TIntermTraverser *it)
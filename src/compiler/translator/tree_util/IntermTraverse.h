@@ -130,10 +130,10 @@ class TIntermTraverser : angle::NonCopyable
         TIntermTraverser *mTraverser;
         bool mWithinDepthLimit;
     };
-    // Optimized traversal functions for leaf nodes directly access ScopedNodeInTraversalPath.
-    friend void TIntermSymbol::traverse(TIntermTraverser *);
-    friend void TIntermConstantUnion::traverse(TIntermTraverser *);
-    friend void TIntermFunctionPrototype::traverse(TIntermTraverser *);
+    // Optimized traversal of leaf nodes directly accesses ScopedNodeInTraversalPath.
+    friend void TIntermNode::traverse(TIntermTraverser *);
+    // The fused traverser lends its traversal state to the traversers it runs.
+    friend class TFusedTraverser;
 
     TIntermNode *getParentNode() const
     {
@@ -2398,6 +2398,7 @@ bool TranslatorWGSL::preTranslateTreeModifications(TIntermBlock *root)
     {
         return false;
     }
+    recordPassStatistics("MonomorphizeUnsupportedFunctions", root);
 
     if (aggregateTypesUsedForUniforms > 0)
     {
@@ -2405,6 +2406,7 @@ bool TranslatorWGSL::preTranslateTreeModifications(TIntermBlock *root)
         {
             return false;
         }
+        recordPassStatistics("SeparateStructFromUniformDeclarations", root);
 
         int removedUniformsCount;
 
@@ -2413,6 +2415,7 @@ bool TranslatorWGSL::preTranslateTreeModifications(TIntermBlock *root)
         {
             return false;
         }
+        recordPassStatistics("RewriteStructSamplers", root);
     }
 
     // Replace array of array of opaque uniforms with a flattened array.  This is run after
@@ -2423,6 +2426,7 @@ bool TranslatorWGSL::preTranslateTreeModifications(TIntermBlock *root)
     {
         return false;
     }
+    recordPassStatistics("RewriteArrayOfArrayOfOpaqueUniforms", root);
 
     return true;
 }
@@ -2452,6 +2456,7 @@ bool TranslatorWGSL::translate(TIntermBlock *root,
     {
         return false;
     }
+    recordPassStatistics("GenerateMainFunctionAndIOStructs", root);
 
     TInfoSinkBase &sink = getInfoSink().obj;
     // Start writing the output structs that will be referred to by the `traverser`'s output.'
@@ -2464,12 +2469,14 @@ bool TranslatorWGSL::translate(TIntermBlock *root,
     {
         return false;
     }
+    recordPassStatistics("OutputUniformBlocksAndSamplers", root);
 
     UniformBlockMetadata uniformBlockMetadata;
     if (!RecordUniformBlockMetadata(root, uniformBlockMetadata))
     {
         return false;
     }
+    recordPassStatistics("RecordUniformBlockMetadata", root);
 
     // Generate the body of the WGSL including the GLSL main() function.
     TInfoSinkBase traverserOutput;
@@ -2489,6 +2496,7 @@ bool TranslatorWGSL::translate(TIntermBlock *root,
     {
         return false;
     }
+    recordPassStatistics("OutputWGSL", root);
 
     if (kOutputTranslatedShader)
     {
@@ -9,6 +9,7 @@
 
 #include "libANGLE/BlobCache.h"
 #include "common/utilities.h"
+#include "libANGLE/BlobCacheFileStore.h"
 #include "libANGLE/Context.h"
 #include "libANGLE/Display.h"
 #include "libANGLE/histogram_macros.h"
@@ -32,6 +33,14 @@ void BlobCache::put(const gl::Context *context,
     }
     else
     {
+        {
+            std::scoped_lock<angle::SimpleMutex> lock(mBlobCacheMutex);
+            if (mFileStore)
+            {
+                mFileStore->put(key, value.data(), value.size());
+            }
+        }
+        // The in-memory cache is kept in front of the file store.
         populate(key, std::move(value), CacheSource::Memory);
     }
 }
@@ -42,7 +51,8 @@ bool BlobCache::compressAndPut(const gl::Context *context,
                                size_t *compressedSize)
 {
     angle::MemoryBuffer compressedValue;
-    if (!angle::CompressBlob(uncompressedValue.size(), uncompressedValue.data(), &compressedValue))
+    if (!angle::CompressBlob(uncompressedValue.size(), uncompressedValue.data(),
+                             angle::BlobCodec::LZ, &compressedValue))
     {
         return false;
     }
@@ -69,6 +79,14 @@ void BlobCache::putApplication(const gl::Context *context,
         std::scoped_lock<angle::SimpleMutex> lock(mBlobCacheMutex);
         mSetBlobFunc(key.data(), key.size(), value.data(), value.size());
     }
+    else
+    {
+        std::scoped_lock<angle::SimpleMutex> lock(mBlobCacheMutex);
+        if (mFileStore)
+        {
+            mFileStore->put(key, value.data(), value.size());
+        }
+    }
 }
 
 void BlobCache::populate(const BlobCache::Key &key, angle::MemoryBuffer &&value, CacheSource source)
@@ -125,17 +143,49 @@ bool BlobCache::get(const gl::Context *context,
         return true;
     }
 
-    std::scoped_lock<angle::SimpleMutex> lock(mBlobCacheMutex);
     // Otherwise we are doing caching internally, so try to find it there
-    const CacheEntry *entry;
-    bool result = mBlobCache.get(key, &entry);
+    std::scoped_lock<angle::SimpleMutex> lock(mBlobCacheMutex);
+    return getInternalLocked(key, scratchBuffer, valueOut);
+}
 
-    if (result)
+bool BlobCache::getInternalLocked(const BlobCache::Key &key,
+                                  angle::ScratchBuffer *scratchBuffer,
+                                  BlobCache::Value *valueOut)
+{
+    const CacheEntry *entry;
+    if (mBlobCache.get(key, &entry))
     {
         *valueOut = BlobCache::Value(entry->first.data(), entry->first.size());
+        return true;
     }
 
-    return result;
+    BlobCache::Value fileValue;
+    if (!mFileStore || !mFileStore->get(key, &fileValue))
+    {
+        return false;
+    }
+
+    if (scratchBuffer == nullptr)
+    {
+        *valueOut = fileValue;
+        return true;
+    }
+
+    // A put from another thread may overwrite this part of the file's ring buffer as soon as the
+    // lock is released, so the blob is copied out of the mapping.
+    angle::MemoryBuffer *scratchMemory;
+    if (!scratchBuffer->get(fileValue.size(), &scratchMemory))
+    {
+        ERR() << "Failed to allocate memory for binary blob";
+        return false;
+    }
+    if (fileValue.size() > 0)
+    {
+        memcpy(scratchMemory->data(), fileValue.data(), fileValue.size());
+    }
+
+    *valueOut = BlobCache::Value(scratchMemory->data(), fileValue.size());
+    return true;
 }
 
 bool BlobCache::getAt(size_t index, const BlobCache::Key **keyOut, BlobCache::Value *valueOut)
@@ -160,20 +210,33 @@ BlobCache::GetAndDecompressResult BlobCache::getAndDecompress(
     ASSERT(uncompressedValueOut);
 
     Value compressedValue;
-    if (!get(context, scratchBuffer, key, &compressedValue))
-    {
-        return GetAndDecompressResult::NotFound;
-    }
-
+    if (areBlobCacheFuncsSet() || (context && context->areBlobCacheFuncsSet()))
     {
-        // This needs to be locked because `DecompressBlob` is reading shared memory from
-        // `compressedValue.data()`.
-        std::scoped_lock<angle::SimpleMutex> lock(mBlobCacheMutex);
+        // The value is copied to |scratchBuffer|, which is not shared with other threads.
+        if (!get(context, scratchBuffer, key, &compressedValue))
+        {
+            return GetAndDecompressResult::NotFound;
+        }
         if (!angle::DecompressBlob(compressedValue.data(), compressedValue.size(),
                                    maxUncompressedDataSize, uncompressedValueOut))
         {
             return GetAndDecompressResult::DecompressFailure;
         }
+        return GetAndDecompressResult::Success;
+    }
+
+    // The value is not copied, and points into the in-memory cache or the file store, so the lock
+    // is held until decompression is done, or another thread's put could overwrite it while it's
+    // read.
+    std::scoped_lock<angle::SimpleMutex> lock(mBlobCacheMutex);
+    if (!getInternalLocked(key, nullptr, &compressedValue))
+    {
+        return GetAndDecompressResult::NotFound;
+    }
+    if (!angle::DecompressBlob(compressedValue.data(), compressedValue.size(),
+                               maxUncompressedDataSize, uncompressedValueOut))
+    {
+        return GetAndDecompressResult::DecompressFailure;
     }
 
     return GetAndDecompressResult::Success;
@@ -182,6 +245,10 @@ BlobCache::GetAndDecompressResult BlobCache::getAndDecompress(
 void BlobCache::remove(const BlobCache::Key &key)
 {
     std::scoped_lock<angle::SimpleMutex> lock(mBlobCacheMutex);
+    if (mFileStore)
+    {
+        mFileStore->remove(key);
+    }
     mBlobCache.eraseByKey(key);
 }
 
@@ -203,7 +270,27 @@ bool BlobCache::areBlobCacheFuncsSet() const
 
 bool BlobCache::isCachingEnabled(const gl::Context *context) const
 {
-    return areBlobCacheFuncsSet() || (context && context->areBlobCacheFuncsSet()) || maxSize() > 0;
+    return areBlobCacheFuncsSet() || (context && context->areBlobCacheFuncsSet()) ||
+           hasFileStore() || maxSize() > 0;
+}
+
+bool BlobCache::openFileStore(const std::string &path, size_t maxSizeBytes)
+{
+    std::unique_ptr<BlobCacheFileStore> fileStore = BlobCacheFileStore::Open(path, maxSizeBytes);
+    if (!fileStore)
+    {
+        return false;
+    }
+
+    std::scoped_lock<angle::SimpleMutex> lock(mBlobCacheMutex);
+    mFileStore = std::move(fileStore);
+    return true;
+}
+
+bool BlobCache::hasFileStore() const
+{
+    std::scoped_lock<angle::SimpleMutex> lock(mBlobCacheMutex);
+    return mFileStore != nullptr;
 }
 
 size_t BlobCache::callBlobGetCallback(const gl::Context *context,
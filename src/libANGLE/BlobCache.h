@@ -12,6 +12,8 @@
 
 #include <array>
 #include <cstring>
+#include <memory>
+#include <string>
 
 #include "common/SimpleMutex.h"
 #include "libANGLE/Error.h"
@@ -25,6 +27,7 @@ class Context;
 
 namespace egl
 {
+class BlobCacheFileStore;
 
 // Used by MemoryProgramCache and MemoryShaderCache, this result indicates whether program/shader
 // cache load from blob was successful.
@@ -56,7 +59,8 @@ class BlobCache final : angle::NonCopyable
     ~BlobCache();
 
     // Store a key-blob pair in the cache.  If application callbacks are set, the application cache
-    // will be used.  Otherwise the value is cached in this object.
+    // will be used.  Otherwise the value is cached in this object, and in the file store if one is
+    // open.
     void put(const gl::Context *context, const BlobCache::Key &key, angle::MemoryBuffer &&value);
 
     // Store a key-blob pair in the cache, but compress the blob before insertion. Returns false if
@@ -66,7 +70,8 @@ class BlobCache final : angle::NonCopyable
                         angle::MemoryBuffer &&uncompressedValue,
                         size_t *compressedSize);
 
-    // Store a key-blob pair in the application cache, only if application callbacks are set.
+    // Store a key-blob pair in the application cache if application callbacks are set, or in the
+    // file store if one is open.  Nothing is cached in this object.
     void putApplication(const gl::Context *context,
                         const BlobCache::Key &key,
                         const angle::MemoryBuffer &value);
@@ -78,7 +83,9 @@ class BlobCache final : angle::NonCopyable
                   CacheSource source = CacheSource::Disk);
 
     // Check if the cache contains the blob corresponding to this key.  If application callbacks are
-    // set, those will be used.  Otherwise they key is looked up in this object's cache.
+    // set, those will be used, and the value is copied to |scratchBuffer|.  Otherwise the key is
+    // looked up in this object's cache, and then in the file store if one is open.  Values from the
+    // file store are also copied to |scratchBuffer|, if given.
     [[nodiscard]] bool get(const gl::Context *context,
                            angle::ScratchBuffer *scratchBuffer,
                            const BlobCache::Key &key,
@@ -132,9 +139,21 @@ class BlobCache final : angle::NonCopyable
 
     bool isCachingEnabled(const gl::Context *context) const;
 
+    // Persist the blobs in a memory-mapped file at |path| when the application doesn't provide
+    // caching callbacks.  Returns false if the file could not be opened.
+    bool openFileStore(const std::string &path, size_t maxSizeBytes);
+    bool hasFileStore() const;
+
     angle::SimpleMutex &getMutex() { return mBlobCacheMutex; }
 
   private:
+    // Looks up |key| in this object's cache and the file store.  Values from the file store are
+    // copied to |scratchBuffer|, unless it's null, in which case they point into the mapping and
+    // are only valid while the lock is held.
+    bool getInternalLocked(const BlobCache::Key &key,
+                           angle::ScratchBuffer *scratchBuffer,
+                           BlobCache::Value *valueOut);
+
     size_t callBlobGetCallback(const gl::Context *context,
                                const void *key,
                                size_t keySize,
@@ -147,6 +166,9 @@ class BlobCache final : angle::NonCopyable
     mutable angle::SimpleMutex mBlobCacheMutex;
     angle::SizedMRUCache<BlobCache::Key, CacheEntry> mBlobCache;
 
+    // Persists the blobs put in |mBlobCache| when set, and serves the blobs it doesn't hold.
+    std::unique_ptr<BlobCacheFileStore> mFileStore;
+
     EGLSetBlobFuncANDROID mSetBlobFunc;
     EGLGetBlobFuncANDROID mGetBlobFunc;
 };
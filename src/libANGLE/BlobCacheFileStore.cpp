@@ -0,0 +1,528 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// BlobCacheFileStore: A persistent store for BlobCache, kept in a memory-mapped file.
+
+#include "libANGLE/BlobCacheFileStore.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "common/debug.h"
+#include "common/hash_utils.h"
+#include "common/mathutil.h"
+
+#if defined(ANGLE_PLATFORM_POSIX)
+#    include <fcntl.h>
+#    include <sys/file.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif  // defined(ANGLE_PLATFORM_POSIX)
+
+namespace egl
+{
+namespace
+{
+constexpr uint32_t kFileMagic   = 0x42474E41;  // "ANGB"
+constexpr uint32_t kFileVersion = 1;
+
+// Records are aligned so that their headers can be accessed directly in the mapping.
+constexpr uint64_t kRecordAlignment = 8;
+// Record size marking the end of the used part of the ring, after which the ring wraps around.
+constexpr uint32_t kWrapMarker = 0xFFFFFFFF;
+
+// One index entry is reserved for every 4KB of blobs, which is far below the typical size of a
+// program binary.  At most 3/4 of the entries are used, to keep the probe sequences short.
+constexpr size_t kBytesPerIndexEntry = 4096;
+constexpr size_t kMinIndexCapacity   = 256;
+
+struct FileHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t indexCapacity;
+    uint32_t entryCount;
+    uint32_t removedCount;
+    uint32_t padding;
+    uint64_t ringCapacity;
+    // The next record is written at |head|, the oldest record starts at |tail|.  |usedBytes|
+    // disambiguates a full ring from an empty one, and includes the unused end of the ring when it
+    // wraps around.
+    uint64_t head;
+    uint64_t tail;
+    uint64_t usedBytes;
+};
+
+enum class EntryState : uint32_t
+{
+    Empty   = 0,
+    Used    = 1,
+    Removed = 2,
+};
+
+struct IndexEntry
+{
+    angle::BlobCacheKey key;
+    EntryState state;
+    uint64_t offset;
+    uint64_t checksum;
+    uint32_t size;
+    uint32_t padding;
+};
+
+// Every blob in the ring is preceded by its key and size, so that the ring can be walked when
+// evicting blobs.
+struct RecordHeader
+{
+    angle::BlobCacheKey key;
+    uint32_t size;
+};
+
+static_assert(sizeof(FileHeader) % kRecordAlignment == 0, "Index must be aligned");
+static_assert(sizeof(IndexEntry) % kRecordAlignment == 0, "Index entries must be aligned");
+static_assert(sizeof(RecordHeader) % kRecordAlignment == 0, "Record data must be aligned");
+
+FileHeader *GetHeader(uint8_t *mapping)
+{
+    return reinterpret_cast<FileHeader *>(mapping);
+}
+
+IndexEntry *GetIndex(uint8_t *mapping)
+{
+    return reinterpret_cast<IndexEntry *>(mapping + sizeof(FileHeader));
+}
+
+uint8_t *GetRing(uint8_t *mapping)
+{
+    return mapping + sizeof(FileHeader) + GetHeader(mapping)->indexCapacity * sizeof(IndexEntry);
+}
+
+size_t GetMaxLoad(uint32_t indexCapacity)
+{
+    return indexCapacity / 4 * 3;
+}
+
+uint64_t GetRecordSize(size_t size)
+{
+    return rx::roundUpPow2<uint64_t>(sizeof(RecordHeader) + size, kRecordAlignment);
+}
+
+size_t GetKeyHash(const angle::BlobCacheKey &key)
+{
+    // The keys are already SHA-1 hashes.
+    size_t hash = 0;
+    memcpy(&hash, key.data(), sizeof(hash));
+    return hash;
+}
+
+uint64_t ComputeChecksum(const uint8_t *data, size_t size)
+{
+    return XXH64(data, size, 0);
+}
+}  // anonymous namespace
+
+#if defined(ANGLE_PLATFORM_POSIX)
+// static
+std::unique_ptr<BlobCacheFileStore> BlobCacheFileStore::Open(const std::string &path,
+                                                             size_t maxSizeBytes)
+{
+    const uint32_t indexCapacity = gl::ceilPow2(static_cast<unsigned int>(
+        std::max(kMinIndexCapacity, maxSizeBytes / kBytesPerIndexEntry)));
+    const uint64_t ringCapacity = rx::roundUpPow2<uint64_t>(maxSizeBytes, kRecordAlignment);
+    const size_t mappingSize =
+        sizeof(FileHeader) + indexCapacity * sizeof(IndexEntry) + ringCapacity;
+
+    int fd = open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0600);
+    if (fd < 0)
+    {
+        WARN() << "Failed to open blob cache file " << path;
+        return nullptr;
+    }
+
+    // The lock is released when the file is closed, including when the process crashes.
+    if (flock(fd, LOCK_EX | LOCK_NB) != 0)
+    {
+        INFO() << "Blob cache file " << path << " is in use by another process";
+        close(fd);
+        return nullptr;
+    }
+
+    struct stat fileStat = {};
+    if (fstat(fd, &fileStat) != 0)
+    {
+        close(fd);
+        return nullptr;
+    }
+
+    // A file of a different size was created with a different size limit; start over.
+    const bool isNewFile = static_cast<size_t>(fileStat.st_size) != mappingSize;
+    if (isNewFile && (ftruncate(fd, 0) != 0 || ftruncate(fd, mappingSize) != 0))
+    {
+        WARN() << "Failed to resize blob cache file " << path;
+        close(fd);
+        return nullptr;
+    }
+
+    void *mapping = mmap(nullptr, mappingSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (mapping == MAP_FAILED)
+    {
+        WARN() << "Failed to map blob cache file " << path;
+        close(fd);
+        return nullptr;
+    }
+
+    std::unique_ptr<BlobCacheFileStore> store(
+        new BlobCacheFileStore(fd, static_cast<uint8_t *>(mapping), mappingSize));
+
+    const FileHeader *header = GetHeader(store->mMapping);
+    const bool isValid =
+        !isNewFile && header->magic == kFileMagic && header->version == kFileVersion &&
+        header->indexCapacity == indexCapacity && header->ringCapacity == ringCapacity &&
+        header->head <= ringCapacity && header->tail <= ringCapacity &&
+        header->usedBytes <= ringCapacity &&
+        header->entryCount + header->removedCount <= GetMaxLoad(indexCapacity);
+    if (!isValid)
+    {
+        // Write the magic last, so a crash during initialization leaves an invalid file behind.
+        FileHeader *newHeader    = GetHeader(store->mMapping);
+        newHeader->magic         = 0;
+        newHeader->version       = kFileVersion;
+        newHeader->indexCapacity = indexCapacity;
+        newHeader->ringCapacity  = ringCapacity;
+        store->reset();
+        newHeader->magic = kFileMagic;
+    }
+
+    return store;
+}
+
+BlobCacheFileStore::~BlobCacheFileStore()
+{
+    munmap(mMapping, mMappingSize);
+    close(mFd);
+}
+#else
+// static
+std::unique_ptr<BlobCacheFileStore> BlobCacheFileStore::Open(const std::string &path,
+                                                             size_t maxSizeBytes)
+{
+    WARN() << "Persistent blob cache is not supported on this platform";
+    return nullptr;
+}
+
+BlobCacheFileStore::~BlobCacheFileStore() = default;
+#endif  // defined(ANGLE_PLATFORM_POSIX)
+
+BlobCacheFileStore::BlobCacheFileStore(int fd, uint8_t *mapping, size_t mappingSize)
+    : mFd(fd), mMapping(mapping), mMappingSize(mappingSize)
+{}
+
+size_t BlobCacheFileStore::entryCount() const
+{
+    return GetHeader(mMapping)->entryCount;
+}
+
+void BlobCacheFileStore::put(const angle::BlobCacheKey &key, const uint8_t *data, size_t size)
+{
+    // Don't let a single blob evict most of the cache.
+    if (GetRecordSize(size) > GetHeader(mMapping)->ringCapacity / 2)
+    {
+        return;
+    }
+
+    refreshRecords();
+    putRecord(key, data, size);
+}
+
+void BlobCacheFileStore::putRecord(const angle::BlobCacheKey &key,
+                                   const uint8_t *data,
+                                   size_t size)
+{
+    FileHeader *header        = GetHeader(mMapping);
+    const uint64_t recordSize = GetRecordSize(size);
+
+    remove(key);
+
+    while (header->entryCount + 1 > GetMaxLoad(header->indexCapacity) && header->usedBytes > 0)
+    {
+        evictOldest();
+    }
+    if (header->entryCount + header->removedCount + 1 > GetMaxLoad(header->indexCapacity))
+    {
+        rehash();
+    }
+
+    // Write the record, then make it part of the ring, and only then index it.
+    const uint64_t offset = allocateRecord(recordSize);
+    RecordHeader *record  = reinterpret_cast<RecordHeader *>(GetRing(mMapping) + offset);
+    record->key           = key;
+    record->size          = static_cast<uint32_t>(size);
+    if (size > 0)
+    {
+        memcpy(record + 1, data, size);
+    }
+
+    header->head = offset + recordSize;
+    header->usedBytes += recordSize;
+
+    insertEntry(key, offset, static_cast<uint32_t>(size), ComputeChecksum(data, size));
+}
+
+bool BlobCacheFileStore::get(const angle::BlobCacheKey &key, angle::BlobCacheValue *valueOut)
+{
+    size_t slot = 0;
+    if (!findEntry(key, &slot))
+    {
+        return false;
+    }
+
+    const FileHeader *header = GetHeader(mMapping);
+    const IndexEntry &entry  = GetIndex(mMapping)[slot];
+    const uint64_t offset    = entry.offset;
+    const uint32_t size      = entry.size;
+
+    // Validate the record, which may have been lost if the system crashed.  A corrupted blob is
+    // left in place, and replaced when the blob is put again.
+    const RecordHeader *record =
+        reinterpret_cast<const RecordHeader *>(GetRing(mMapping) + offset);
+    const uint8_t *data = reinterpret_cast<const uint8_t *>(record + 1);
+    if (offset + GetRecordSize(size) > header->ringCapacity || record->key != key ||
+        record->size != size || ComputeChecksum(data, size) != entry.checksum)
+    {
+        WARN() << "Ignoring corrupted blob in the blob cache file";
+        return false;
+    }
+
+    // Blobs that are about to be evicted are written again at the head of the ring by the next
+    // |put|, so that frequently used blobs stay in the cache.
+    if (isCloseToTail(offset))
+    {
+        mKeysToRefresh.insert(key);
+    }
+
+    *valueOut = angle::BlobCacheValue(data, size);
+    return true;
+}
+
+void BlobCacheFileStore::refreshRecords()
+{
+    std::vector<uint8_t> value;
+    for (const angle::BlobCacheKey &key : mKeysToRefresh)
+    {
+        // The blob may have been removed or evicted since it was read.
+        size_t slot = 0;
+        if (!findEntry(key, &slot))
+        {
+            continue;
+        }
+
+        const IndexEntry &entry = GetIndex(mMapping)[slot];
+        if (!isCloseToTail(entry.offset))
+        {
+            continue;
+        }
+
+        // Making room for the blob may overwrite the blob itself, so it's copied first.
+        const uint8_t *data = GetRing(mMapping) + entry.offset + sizeof(RecordHeader);
+        value.assign(data, data + entry.size);
+        putRecord(key, value.data(), value.size());
+    }
+    mKeysToRefresh.clear();
+}
+
+bool BlobCacheFileStore::isCloseToTail(uint64_t offset) const
+{
+    const FileHeader *header = GetHeader(mMapping);
+    const uint64_t distanceFromTail =
+        (offset + header->ringCapacity - header->tail) % header->ringCapacity;
+    return header->usedBytes > header->ringCapacity / 2 &&
+           distanceFromTail < header->ringCapacity / 4;
+}
+
+void BlobCacheFileStore::remove(const angle::BlobCacheKey &key)
+{
+    size_t slot = 0;
+    if (findEntry(key, &slot))
+    {
+        removeEntry(slot);
+    }
+}
+
+bool BlobCacheFileStore::findEntry(const angle::BlobCacheKey &key, size_t *slotOut) const
+{
+    const IndexEntry *index = GetIndex(mMapping);
+    const size_t mask       = GetHeader(mMapping)->indexCapacity - 1;
+
+    // The index is never full, so there's always an empty entry to end the probe sequence.
+    for (size_t slot = GetKeyHash(key) & mask;; slot = (slot + 1) & mask)
+    {
+        const IndexEntry &entry = index[slot];
+        if (entry.state == EntryState::Empty)
+        {
+            return false;
+        }
+        if (entry.state == EntryState::Used && entry.key == key)
+        {
+            *slotOut = slot;
+            return true;
+        }
+    }
+}
+
+void BlobCacheFileStore::insertEntry(const angle::BlobCacheKey &key,
+                                     uint64_t offset,
+                                     uint32_t size,
+                                     uint64_t checksum)
+{
+    FileHeader *header = GetHeader(mMapping);
+    IndexEntry *index  = GetIndex(mMapping);
+    const size_t mask  = header->indexCapacity - 1;
+
+    size_t slot = GetKeyHash(key) & mask;
+    while (index[slot].state == EntryState::Used)
+    {
+        slot = (slot + 1) & mask;
+    }
+
+    IndexEntry &entry = index[slot];
+    if (entry.state == EntryState::Removed)
+    {
+        --header->removedCount;
+    }
+
+    // Mark the entry used last, so a partially written entry is never looked at.
+    entry.key      = key;
+    entry.offset   = offset;
+    entry.size     = size;
+    entry.checksum = checksum;
+    entry.state    = EntryState::Used;
+    ++header->entryCount;
+}
+
+void BlobCacheFileStore::removeEntry(size_t slot)
+{
+    FileHeader *header = GetHeader(mMapping);
+    IndexEntry &entry  = GetIndex(mMapping)[slot];
+
+    ASSERT(entry.state == EntryState::Used);
+    entry.state = EntryState::Removed;
+    --header->entryCount;
+    ++header->removedCount;
+}
+
+void BlobCacheFileStore::rehash()
+{
+    FileHeader *header = GetHeader(mMapping);
+    IndexEntry *index  = GetIndex(mMapping);
+
+    std::vector<IndexEntry> entries;
+    entries.reserve(header->entryCount);
+    for (uint32_t slot = 0; slot < header->indexCapacity; ++slot)
+    {
+        if (index[slot].state == EntryState::Used)
+        {
+            entries.push_back(index[slot]);
+        }
+    }
+
+    memset(index, 0, header->indexCapacity * sizeof(IndexEntry));
+    header->entryCount   = 0;
+    header->removedCount = 0;
+
+    for (const IndexEntry &entry : entries)
+    {
+        insertEntry(entry.key, entry.offset, entry.size, entry.checksum);
+    }
+}
+
+uint64_t BlobCacheFileStore::allocateRecord(uint64_t recordSize)
+{
+    FileHeader *header = GetHeader(mMapping);
+
+    // If the record doesn't fit before the end of the ring, the end is left unused and the record
+    // is placed at the start of the ring instead.
+    const bool wrap               = header->head + recordSize > header->ringCapacity;
+    const uint64_t wrapPadding    = wrap ? header->ringCapacity - header->head : 0;
+    const uint64_t neededFreeSize = wrapPadding + recordSize;
+
+    while (header->ringCapacity - header->usedBytes < neededFreeSize)
+    {
+        evictOldest();
+    }
+
+    if (header->usedBytes == 0)
+    {
+        header->head = 0;
+        header->tail = 0;
+        return 0;
+    }
+
+    if (!wrap)
+    {
+        return header->head;
+    }
+
+    if (wrapPadding >= sizeof(RecordHeader))
+    {
+        RecordHeader *marker = reinterpret_cast<RecordHeader *>(GetRing(mMapping) + header->head);
+        marker->size         = kWrapMarker;
+    }
+    header->usedBytes += wrapPadding;
+    header->head = 0;
+    return 0;
+}
+
+void BlobCacheFileStore::evictOldest()
+{
+    FileHeader *header = GetHeader(mMapping);
+    ASSERT(header->usedBytes > 0);
+
+    const uint64_t tail          = header->tail;
+    const uint64_t remainingSize = header->ringCapacity - tail;
+    const RecordHeader *record = reinterpret_cast<const RecordHeader *>(GetRing(mMapping) + tail);
+
+    // Skip over the unused end of the ring.
+    if (remainingSize < sizeof(RecordHeader) || record->size == kWrapMarker)
+    {
+        header->tail = 0;
+        header->usedBytes -= std::min(remainingSize, header->usedBytes);
+        return;
+    }
+
+    // The ring is expected to be consistent, but is reset if it's not.
+    const uint64_t recordSize = GetRecordSize(record->size);
+    if (recordSize > remainingSize || recordSize > header->usedBytes)
+    {
+        WARN() << "Blob cache file is corrupted, clearing it";
+        reset();
+        return;
+    }
+
+    // The record may have been replaced or removed since, in which case it's no longer indexed.
+    size_t slot = 0;
+    if (findEntry(record->key, &slot) && GetIndex(mMapping)[slot].offset == tail)
+    {
+        removeEntry(slot);
+    }
+
+    header->tail = tail + recordSize;
+    header->usedBytes -= recordSize;
+}
+
+void BlobCacheFileStore::reset()
+{
+    FileHeader *header = GetHeader(mMapping);
+
+    memset(GetIndex(mMapping), 0, header->indexCapacity * sizeof(IndexEntry));
+    header->entryCount   = 0;
+    header->removedCount = 0;
+    header->padding      = 0;
+    header->head         = 0;
+    header->tail         = 0;
+    header->usedBytes    = 0;
+}
+
+}  // namespace egl
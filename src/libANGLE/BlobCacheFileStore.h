@@ -0,0 +1,88 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// BlobCacheFileStore: A persistent store for BlobCache, kept in a memory-mapped file.  Used when
+//   the application doesn't provide blob cache callbacks, so that compiled programs, shaders and
+//   pipeline caches survive process restarts.
+
+#ifndef LIBANGLE_BLOB_CACHE_FILE_STORE_H_
+#define LIBANGLE_BLOB_CACHE_FILE_STORE_H_
+
+#include <memory>
+#include <set>
+#include <string>
+
+#include "libANGLE/angletypes.h"
+
+namespace egl
+{
+
+// The file is made of a header, a hash table indexing the blobs by key, and a ring buffer holding
+// the blobs themselves.  New blobs are appended at the head of the ring and the oldest blobs are
+// evicted from its tail to make room.  Blobs that are read while close to the tail are moved back
+// to the head by the next |put|, so eviction approximates least-recently-used order.
+//
+// A blob is written before it's indexed, and it's removed from the index before its space is
+// reused, so the file stays usable if the process crashes.  The file is not explicitly synced to
+// disk, so a system crash may lose recent blobs.  Every blob is checksummed, and blobs that fail
+// validation are treated as missing.
+//
+// The store is not thread-safe; BlobCache serializes access to it.  Only one process can use the
+// file at a time, other processes fail to open it and fall back to not persisting their blobs.
+class BlobCacheFileStore final : angle::NonCopyable
+{
+  public:
+    // Opens the store at |path|, creating it if necessary with room for |maxSizeBytes| of blobs.
+    // Returns nullptr if the file can't be mapped, or is in use by another process.
+    static std::unique_ptr<BlobCacheFileStore> Open(const std::string &path, size_t maxSizeBytes);
+    ~BlobCacheFileStore();
+
+    void put(const angle::BlobCacheKey &key, const uint8_t *data, size_t size);
+
+    // |valueOut| points into the mapping, and stays valid until the next |put| or |remove|.  The
+    // file itself is not modified, so concurrent readers don't invalidate each other's values.
+    [[nodiscard]] bool get(const angle::BlobCacheKey &key, angle::BlobCacheValue *valueOut);
+
+    void remove(const angle::BlobCacheKey &key);
+
+    // Returns the number of blobs in the store.
+    size_t entryCount() const;
+
+  private:
+    BlobCacheFileStore(int fd, uint8_t *mapping, size_t mappingSize);
+
+    void putRecord(const angle::BlobCacheKey &key, const uint8_t *data, size_t size);
+    // Writes the blobs read close to the tail of the ring again at its head.
+    void refreshRecords();
+    bool isCloseToTail(uint64_t offset) const;
+
+    // Looks up the slot of the index holding |key|.
+    bool findEntry(const angle::BlobCacheKey &key, size_t *slotOut) const;
+    void insertEntry(const angle::BlobCacheKey &key,
+                     uint64_t offset,
+                     uint32_t size,
+                     uint64_t checksum);
+    void removeEntry(size_t slot);
+    // Rebuilds the hash table to drop the markers left by removed entries.
+    void rehash();
+
+    // Makes room for |recordSize| bytes at the head of the ring, returning the offset to write at.
+    uint64_t allocateRecord(uint64_t recordSize);
+    // Evicts the record at the tail of the ring.
+    void evictOldest();
+    // Drops all blobs.
+    void reset();
+
+    int mFd;
+    uint8_t *mMapping;
+    size_t mMappingSize;
+
+    // Blobs read close to the tail of the ring since the last |put|.
+    std::set<angle::BlobCacheKey> mKeysToRefresh;
+};
+
+}  // namespace egl
+
+#endif  // LIBANGLE_BLOB_CACHE_FILE_STORE_H_
@@ -7,6 +7,7 @@
 
 #include <gtest/gtest.h>
 
+#include "common/system_utils.h"
 #include "libANGLE/BlobCache.h"
 
 namespace egl
@@ -22,9 +23,9 @@ using Key     = BlobCache::Key;
 template <typename T>
 void MakeSequence(T &seq, uint8_t start)
 {
-    for (uint8_t i = 0; i < seq.size(); ++i)
+    for (size_t i = 0; i < seq.size(); ++i)
     {
-        seq[i] = i + start;
+        seq[i] = static_cast<uint8_t>(i + start);
     }
 }
 
@@ -127,4 +128,148 @@ TEST(BlobCacheTest, OversizeValue)
     EXPECT_FALSE(blobCache.get(nullptr, nullptr, MakeKey(5), &qvalue));
 }
 
+#if defined(ANGLE_PLATFORM_POSIX) && !defined(ANGLE_PLATFORM_ANDROID)
+// Tests that blobs put in a cache backed by a file are found by the next cache using the file.
+TEST(BlobCacheTest, FileStorePersists)
+{
+    Optional<std::string> path = angle::CreateTemporaryFile();
+    ASSERT_TRUE(path.valid());
+
+    constexpr size_t kFileSize = 64 * 1024;
+    {
+        BlobCache blobCache(0);
+        ASSERT_TRUE(blobCache.openFileStore(path.value(), kFileSize));
+        EXPECT_TRUE(blobCache.isCachingEnabled(nullptr));
+
+        // The file can't be shared with another cache while in use.
+        BlobCache otherBlobCache(0);
+        EXPECT_FALSE(otherBlobCache.openFileStore(path.value(), kFileSize));
+
+        blobCache.put(nullptr, MakeKey(0), MakeBlob(100, 0));
+        blobCache.put(nullptr, MakeKey(1), MakeBlob(200, 1));
+        blobCache.remove(MakeKey(1));
+    }
+
+    BlobCache blobCache(0);
+    ASSERT_TRUE(blobCache.openFileStore(path.value(), kFileSize));
+
+    angle::ScratchBuffer scratchBuffer;
+    Blob blob;
+    ASSERT_TRUE(blobCache.get(nullptr, &scratchBuffer, MakeKey(0), &blob));
+    BlobPut expected = MakeBlob(100, 0);
+    ASSERT_EQ(expected.size(), blob.size());
+    EXPECT_EQ(0, memcmp(expected.data(), blob.data(), blob.size()));
+
+    EXPECT_FALSE(blobCache.get(nullptr, &scratchBuffer, MakeKey(1), &blob));
+
+    std::remove(path.value().c_str());
+}
+
+// Tests that a file backed cache evicts the oldest blobs once full, and keeps the blobs in use.
+TEST(BlobCacheTest, FileStoreEviction)
+{
+    Optional<std::string> path = angle::CreateTemporaryFile();
+    ASSERT_TRUE(path.valid());
+
+    constexpr size_t kFileSize  = 64 * 1024;
+    constexpr size_t kBlobSize  = 1000;
+    constexpr uint8_t kBlobCount = 200;
+
+    BlobCache blobCache(0);
+    ASSERT_TRUE(blobCache.openFileStore(path.value(), kFileSize));
+
+    angle::ScratchBuffer scratchBuffer;
+    Blob blob;
+    for (uint8_t value = 0; value < kBlobCount; ++value)
+    {
+        blobCache.put(nullptr, MakeKey(value), MakeBlob(kBlobSize, value));
+
+        // Keep using the first blob.
+        ASSERT_TRUE(blobCache.get(nullptr, &scratchBuffer, MakeKey(0), &blob)) << value;
+        EXPECT_EQ(kBlobSize, blob.size());
+        EXPECT_EQ(0u, blob.data()[0]);
+    }
+
+    EXPECT_FALSE(blobCache.get(nullptr, &scratchBuffer, MakeKey(1), &blob));
+    ASSERT_TRUE(blobCache.get(nullptr, &scratchBuffer, MakeKey(kBlobCount - 1), &blob));
+    EXPECT_EQ(kBlobCount - 1, blob.data()[0]);
+
+    // A blob too large for the file is not stored.
+    blobCache.put(nullptr, MakeKey(kBlobCount), MakeBlob(kFileSize, 0));
+    EXPECT_FALSE(blobCache.get(nullptr, &scratchBuffer, MakeKey(kBlobCount), &blob));
+
+    std::remove(path.value().c_str());
+}
+
+// Tests that blobs put in a file backed cache are also kept in memory, and that blobs only found in
+// the file are still found by a new cache.
+TEST(BlobCacheTest, FileStoreBehindMemoryCache)
+{
+    Optional<std::string> path = angle::CreateTemporaryFile();
+    ASSERT_TRUE(path.valid());
+
+    constexpr size_t kFileSize   = 64 * 1024;
+    constexpr size_t kMemorySize = 1024;
+    BlobPut expected             = MakeBlob(100, 0);
+    {
+        BlobCache blobCache(kMemorySize);
+        ASSERT_TRUE(blobCache.openFileStore(path.value(), kFileSize));
+
+        blobCache.put(nullptr, MakeKey(0), MakeBlob(100, 0));
+        EXPECT_EQ(1u, blobCache.entryCount());
+
+        Blob blob;
+        ASSERT_TRUE(blobCache.get(nullptr, nullptr, MakeKey(0), &blob));
+        ASSERT_EQ(expected.size(), blob.size());
+        EXPECT_EQ(0, memcmp(expected.data(), blob.data(), blob.size()));
+    }
+
+    BlobCache blobCache(kMemorySize);
+    ASSERT_TRUE(blobCache.openFileStore(path.value(), kFileSize));
+
+    angle::ScratchBuffer scratchBuffer;
+    Blob blob;
+    ASSERT_TRUE(blobCache.get(nullptr, &scratchBuffer, MakeKey(0), &blob));
+    ASSERT_EQ(expected.size(), blob.size());
+    EXPECT_EQ(0, memcmp(expected.data(), blob.data(), blob.size()));
+    EXPECT_EQ(0u, blobCache.entryCount());
+
+    std::remove(path.value().c_str());
+}
+
+// Tests that a blob read from the file store stays intact after the part of the file it was read
+// from is overwritten.
+TEST(BlobCacheTest, FileStoreValueOutlivesOverwrite)
+{
+    Optional<std::string> path = angle::CreateTemporaryFile();
+    ASSERT_TRUE(path.valid());
+
+    constexpr size_t kFileSize   = 64 * 1024;
+    constexpr size_t kBlobSize   = 1000;
+    constexpr uint8_t kBlobCount = 200;
+
+    BlobCache blobCache(0);
+    ASSERT_TRUE(blobCache.openFileStore(path.value(), kFileSize));
+    blobCache.put(nullptr, MakeKey(0), MakeBlob(kBlobSize, 0));
+
+    angle::ScratchBuffer scratchBuffer;
+    Blob blob;
+    ASSERT_TRUE(blobCache.get(nullptr, &scratchBuffer, MakeKey(0), &blob));
+
+    // Wrap around the file's ring buffer a few times.
+    for (uint8_t value = 1; value < kBlobCount; ++value)
+    {
+        blobCache.put(nullptr, MakeKey(value), MakeBlob(kBlobSize, value));
+    }
+    Blob evictedBlob;
+    EXPECT_FALSE(blobCache.get(nullptr, nullptr, MakeKey(1), &evictedBlob));
+
+    BlobPut expected = MakeBlob(kBlobSize, 0);
+    ASSERT_EQ(expected.size(), blob.size());
+    EXPECT_EQ(0, memcmp(expected.data(), blob.data(), blob.size()));
+
+    std::remove(path.value().c_str());
+}
+#endif  // defined(ANGLE_PLATFORM_POSIX) && !defined(ANGLE_PLATFORM_ANDROID)
+
 }  // namespace egl
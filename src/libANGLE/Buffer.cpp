@@ -10,6 +10,7 @@
 
 #include "libANGLE/Buffer.h"
 
+#include "common/FastVector.h"
 #include "libANGLE/Context.h"
 #include "libANGLE/renderer/BufferImpl.h"
 #include "libANGLE/renderer/GLImplFactory.h"
@@ -20,6 +21,11 @@ namespace
 {
 constexpr angle::SubjectIndex kImplementationSubjectIndex = 0;
 constexpr size_t kInvalidContentsObserverIndex            = std::numeric_limits<size_t>::max();
+// Index range queries at least this large are computed from per-block summaries.
+constexpr size_t kMinBlockSummaryQuerySize = 4 * IndexRangeBlockSummary::kBlockSize;
+// Spans read from the buffer by a block summary query without a heap allocation: the two partial
+// blocks at either end and a few invalid whole blocks.
+constexpr size_t kMaxInlineIndexRangeSpans = 8;
 }  // anonymous namespace
 
 BufferState::BufferState()
@@ -169,7 +175,7 @@ angle::Result Buffer::bufferDataImpl(Context *context,
                                      bufferStorage) == angle::Result::Stop)
     {
         // If setData fails, the buffer contents are undefined. Set a zero size to indicate that.
-        mIndexRangeCache.clear();
+        clearIndexRanges();
         mState.mSize = 0;
 
         // Notify when storage changes.
@@ -180,7 +186,7 @@ angle::Result Buffer::bufferDataImpl(Context *context,
 
     bool wholeBuffer = size == mState.mSize;
 
-    mIndexRangeCache.clear();
+    clearIndexRanges();
     mState.mUsage                = usage;
     mState.mSize                 = size;
     mState.mImmutable            = (bufferStorage == BufferStorage::Immutable);
@@ -223,7 +229,7 @@ angle::Result Buffer::bufferExternalDataImpl(Context *context,
                                      BufferStorage::Immutable) == angle::Result::Stop)
     {
         // If setData fails, the buffer contents are undefined. Set a zero size to indicate that.
-        mIndexRangeCache.clear();
+        clearIndexRanges();
         mState.mSize = 0;
 
         // Notify when storage changes.
@@ -232,7 +238,7 @@ angle::Result Buffer::bufferExternalDataImpl(Context *context,
         return angle::Result::Stop;
     }
 
-    mIndexRangeCache.clear();
+    clearIndexRanges();
     mState.mUsage                = BufferUsage::InvalidEnum;
     mState.mSize                 = size;
     mState.mImmutable            = GL_TRUE;
@@ -253,8 +259,22 @@ angle::Result Buffer::bufferSubData(const Context *context,
 {
     ANGLE_TRY(mImpl->setSubData(context, target, data, size, offset));
 
-    mIndexRangeCache.invalidateRange(static_cast<unsigned int>(offset),
-                                     static_cast<unsigned int>(size));
+    if (data != nullptr)
+    {
+        mIndexRangeCache.invalidateRange(static_cast<size_t>(offset), static_cast<size_t>(size));
+        for (std::array<IndexRangeBlockSummary, 2> &summaries : mIndexRangeBlockSummaries)
+        {
+            for (IndexRangeBlockSummary &summary : summaries)
+            {
+                summary.updateRange(static_cast<size_t>(offset), static_cast<size_t>(size),
+                                    static_cast<const uint8_t *>(data));
+            }
+        }
+    }
+    else
+    {
+        invalidateIndexRanges(static_cast<size_t>(offset), static_cast<size_t>(size));
+    }
 
     // Notify when data changes.
     onContentsChange();
@@ -271,8 +291,7 @@ angle::Result Buffer::copyBufferSubData(const Context *context,
     ANGLE_TRY(
         mImpl->copySubData(context, source->getImplementation(), sourceOffset, destOffset, size));
 
-    mIndexRangeCache.invalidateRange(static_cast<unsigned int>(destOffset),
-                                     static_cast<unsigned int>(size));
+    invalidateIndexRanges(static_cast<size_t>(destOffset), static_cast<size_t>(size));
 
     // Notify when data changes.
     onContentsChange();
@@ -294,7 +313,7 @@ angle::Result Buffer::map(const Context *context, GLenum access)
     mState.mMapLength   = mState.mSize;
     mState.mAccess      = access;
     mState.mAccessFlags = GL_MAP_WRITE_BIT;
-    mIndexRangeCache.clear();
+    clearIndexRanges();
 
     // Notify when state changes.
     onStateChange(angle::SubjectMessage::SubjectMapped);
@@ -326,8 +345,7 @@ angle::Result Buffer::mapRange(const Context *context,
 
     if ((access & GL_MAP_WRITE_BIT) > 0)
     {
-        mIndexRangeCache.invalidateRange(static_cast<unsigned int>(offset),
-                                         static_cast<unsigned int>(length));
+        invalidateIndexRanges(static_cast<size_t>(offset), static_cast<size_t>(length));
     }
 
     // Notify when state changes.
@@ -358,7 +376,7 @@ angle::Result Buffer::unmap(const Context *context, GLboolean *result)
 
 void Buffer::onDataChanged()
 {
-    mIndexRangeCache.clear();
+    clearIndexRanges();
 
     // Notify when data changes.
     onContentsChange();
@@ -373,19 +391,133 @@ angle::Result Buffer::getIndexRange(const gl::Context *context,
                                     bool primitiveRestartEnabled,
                                     IndexRange *outRange) const
 {
+    IndexRangeCacheStats &contextStats = context->getState().getIndexRangeCacheStats();
     if (mIndexRangeCache.findRange(type, offset, count, primitiveRestartEnabled, outRange))
     {
+        contextStats.hits++;
         return angle::Result::Continue;
     }
+    contextStats.misses++;
 
-    ANGLE_TRY(
-        mImpl->getIndexRange(context, type, offset, count, primitiveRestartEnabled, outRange));
+    // Large queries are answered from per-block ranges, so that a partial update of the buffer
+    // only requires rescanning the blocks it touched.
+    const size_t endOffset = offset + count * GetDrawElementsTypeSize(type);
+    if (endOffset - offset >= kMinBlockSummaryQuerySize &&
+        endOffset <= static_cast<size_t>(mState.mSize))
+    {
+        ANGLE_TRY(getIndexRangeFromBlockSummary(context, type, offset, count,
+                                                primitiveRestartEnabled, outRange));
+    }
+    else
+    {
+        ANGLE_TRY(
+            mImpl->getIndexRange(context, type, offset, count, primitiveRestartEnabled, outRange));
+    }
 
+    const uint64_t evictions = mIndexRangeCache.getStats().evictions;
     mIndexRangeCache.addRange(type, offset, count, primitiveRestartEnabled, *outRange);
+    contextStats.evictions += mIndexRangeCache.getStats().evictions - evictions;
+
+    return angle::Result::Continue;
+}
+
+angle::Result Buffer::getIndexRangeFromBlockSummary(const gl::Context *context,
+                                                    DrawElementsType type,
+                                                    size_t offset,
+                                                    size_t count,
+                                                    bool primitiveRestartEnabled,
+                                                    IndexRange *outRange) const
+{
+    constexpr size_t kBlockSize = IndexRangeBlockSummary::kBlockSize;
+
+    IndexRangeBlockSummary &summary = mIndexRangeBlockSummaries[type][primitiveRestartEnabled];
+    if (!summary.matches(type, primitiveRestartEnabled))
+    {
+        summary.reset(type, primitiveRestartEnabled, static_cast<size_t>(mState.mSize));
+    }
+
+    const size_t typeBytes       = GetDrawElementsTypeSize(type);
+    const size_t indicesPerBlock = kBlockSize / typeBytes;
+    const size_t endOffset       = offset + count * typeBytes;
+    const size_t firstBlock      = rx::roundUp(offset, kBlockSize) / kBlockSize;
+    const size_t lastBlock       = endOffset / kBlockSize;
+    ASSERT(firstBlock < lastBlock && lastBlock <= summary.getBlockCount());
+
+    IndexRange range;
+
+    // Gather everything that has to be read from the buffer, so that the back-end reads it once:
+    // the leading partial block, the invalid whole blocks and the trailing partial block.
+    angle::FastVector<rx::IndexRangeSpan, kMaxInlineIndexRangeSpans> spans;
+    const size_t headEnd = firstBlock * kBlockSize;
+    if (offset < headEnd)
+    {
+        spans.push_back({offset, (headEnd - offset) / typeBytes});
+    }
+
+    for (size_t block = firstBlock; block < lastBlock; ++block)
+    {
+        if (summary.isBlockValid(block))
+        {
+            range = CombineIndexRanges(range, summary.getBlockRange(block));
+        }
+        else
+        {
+            spans.push_back({block * kBlockSize, indicesPerBlock});
+        }
+    }
+
+    const size_t tailStart = lastBlock * kBlockSize;
+    if (tailStart < endOffset)
+    {
+        spans.push_back({tailStart, (endOffset - tailStart) / typeBytes});
+    }
+
+    if (!spans.empty())
+    {
+        angle::FastVector<IndexRange, kMaxInlineIndexRangeSpans> spanRanges(spans.size());
+        ANGLE_TRY(mImpl->getIndexRanges(context, type, spans.data(), spans.size(),
+                                        primitiveRestartEnabled, spanRanges.data()));
+
+        for (size_t span = 0; span < spans.size(); ++span)
+        {
+            // The partial blocks are never block aligned and full sized, so only whole blocks
+            // refresh the summary.
+            if (spans[span].offset % kBlockSize == 0 && spans[span].count == indicesPerBlock)
+            {
+                summary.setBlockRange(spans[span].offset / kBlockSize, spanRanges[span]);
+            }
+            range = CombineIndexRanges(range, spanRanges[span]);
+        }
+    }
 
+    *outRange = range;
     return angle::Result::Continue;
 }
 
+void Buffer::invalidateIndexRanges(size_t offset, size_t size)
+{
+    mIndexRangeCache.invalidateRange(offset, size);
+    for (std::array<IndexRangeBlockSummary, 2> &summaries : mIndexRangeBlockSummaries)
+    {
+        for (IndexRangeBlockSummary &summary : summaries)
+        {
+            summary.invalidateRange(offset, size);
+        }
+    }
+}
+
+void Buffer::clearIndexRanges()
+{
+    mIndexRangeCache.clear();
+    for (std::array<IndexRangeBlockSummary, 2> &summaries : mIndexRangeBlockSummaries)
+    {
+        for (IndexRangeBlockSummary &summary : summaries)
+        {
+            summary.clear();
+        }
+    }
+}
+
 GLint64 Buffer::getMemorySize() const
 {
     GLint64 implSize = mImpl->getMemorySize();
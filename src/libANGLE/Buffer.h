@@ -221,6 +221,15 @@ class Buffer final : public ThreadSafeRefCountObject<BufferID>,
                                          GLbitfield flags);
 
     void onContentsChange();
+    angle::Result getIndexRangeFromBlockSummary(const gl::Context *context,
+                                                DrawElementsType type,
+                                                size_t offset,
+                                                size_t count,
+                                                bool primitiveRestartEnabled,
+                                                IndexRange *outRange) const;
+    void invalidateIndexRanges(size_t offset, size_t size);
+    void clearIndexRanges();
+
     size_t getContentsObserverIndex(void *observer, uint32_t bufferIndex) const;
     void removeContentsObserverImpl(void *observer, uint32_t bufferIndex);
 
@@ -230,6 +239,10 @@ class Buffer final : public ThreadSafeRefCountObject<BufferID>,
 
     angle::FastVector<ContentsObserver, angle::kMaxFixedObservers> mContentsObservers;
     mutable IndexRangeCache mIndexRangeCache;
+    // One block summary per index type and primitive restart mode, so that draws alternating
+    // between them do not discard each other's summaries.
+    mutable angle::PackedEnumMap<DrawElementsType, std::array<IndexRangeBlockSummary, 2>>
+        mIndexRangeBlockSummaries;
 };
 
 }  // namespace gl
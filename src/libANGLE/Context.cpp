@@ -10080,9 +10080,12 @@ StateCache::StateCache()
       mCachedProgramPipelineError(kInvalidPointer),
       mCachedHasAnyEnabledClientAttrib(false),
       mCachedTransformFeedbackActiveUnpaused(false),
+      mCachedTransformFeedbackBufferSpaceCheckNeeded(false),
       mCachedCanDraw(false)
 {
     mCachedValidDrawModes.fill(false);
+    updateDrawModeValidity();
+    updateDrawElementsTypeValidity();
 }
 
 StateCache::~StateCache() = default;
@@ -10203,6 +10206,10 @@ intptr_t StateCache::getBasicDrawStatesErrorImpl(const Context *context,
     ASSERT((mCachedBasicDrawStatesErrorString == 0) ==
            (mCachedBasicDrawStatesErrorCode == GL_NO_ERROR));
 
+    // The per-mode results may have been computed from an outdated error if the invalidation came
+    // through the PrivateStateCache.
+    updateDrawModeValidity();
+
     privateStateCache->setCachedBasicDrawStatesErrorValid();
     return mCachedBasicDrawStatesErrorString;
 }
@@ -10221,6 +10228,27 @@ intptr_t StateCache::getBasicDrawElementsErrorImpl(const Context *context) const
     return mCachedBasicDrawElementsError;
 }
 
+bool StateCache::canDrawWithModeImpl(const Context *context,
+                                     const PrivateStateCache *privateStateCache,
+                                     PrimitiveMode primitiveMode) const
+{
+    // Note that this may reset the per-mode results, so it must be done before the result for
+    // |primitiveMode| is recorded.
+    bool canDraw = getBasicDrawStatesErrorString(context, privateStateCache) == 0 &&
+                   isValidDrawMode(primitiveMode);
+
+    mCachedDrawModeValidity[primitiveMode] = canDraw ? DrawValidity::Valid : DrawValidity::Invalid;
+    return canDraw;
+}
+
+bool StateCache::canDrawElementsWithTypeImpl(const Context *context, DrawElementsType type) const
+{
+    bool canDraw = isValidDrawElementsType(type) && getBasicDrawElementsError(context) == 0;
+
+    mCachedDrawElementsTypeValidity[type] = canDraw ? DrawValidity::Valid : DrawValidity::Invalid;
+    return canDraw;
+}
+
 void StateCache::onVertexArrayBindingChange(Context *context)
 {
     updateActiveAttribsMask(context);
@@ -10337,6 +10365,8 @@ void StateCache::setValidDrawModes(bool pointsOK,
 
 void StateCache::updateValidDrawModes(Context *context)
 {
+    updateDrawModeValidity();
+
     const State &state = context->getState();
 
     const ProgramExecutable *programExecutable = context->getState().getProgramExecutable();
@@ -10416,6 +10446,8 @@ void StateCache::updateValidBindTextureTypes(Context *context)
 
 void StateCache::updateValidDrawElementsTypes(Context *context)
 {
+    updateDrawElementsTypeValidity();
+
     bool supportsUint =
         (context->getClientMajorVersion() >= 3 || context->getExtensions().elementIndexUintOES);
 
@@ -10430,6 +10462,8 @@ void StateCache::updateTransformFeedbackActiveUnpaused(Context *context)
 {
     TransformFeedback *xfb                 = context->getState().getCurrentTransformFeedback();
     mCachedTransformFeedbackActiveUnpaused = xfb && xfb->isActive() && !xfb->isPaused();
+    mCachedTransformFeedbackBufferSpaceCheckNeeded =
+        mCachedTransformFeedbackActiveUnpaused && !context->supportsGeometryOrTesselation();
 }
 
 void StateCache::updateVertexAttribTypesValidation(Context *context)
@@ -315,6 +315,44 @@ class StateCache final : angle::NonCopyable
         return mCachedValidDrawModes[primitiveMode];
     }
 
+    // Places that can trigger updateDrawModeValidity:
+    // 1. Everything that triggers updateBasicDrawStatesError, including the PrivateStateCache
+    //    changes listed above.
+    // 2. Everything that triggers updateValidDrawModes.
+    //
+    // Folds getBasicDrawStatesErrorString and isValidDrawMode into a single table lookup.  Returns
+    // false if either check fails, in which case the caller generates the error through them.
+    bool canDrawWithMode(const Context *context,
+                         const PrivateStateCache *privateStateCache,
+                         PrimitiveMode primitiveMode) const
+    {
+        // This is only ever called with the context that owns this state cache
+        ASSERT(isCurrentContext(context, privateStateCache));
+        DrawValidity validity = mCachedDrawModeValidity[primitiveMode];
+        if (ANGLE_LIKELY(privateStateCache->isCachedBasicDrawStatesErrorValid() &&
+                         validity != DrawValidity::Unknown))
+        {
+            return validity == DrawValidity::Valid;
+        }
+
+        return canDrawWithModeImpl(context, privateStateCache, primitiveMode);
+    }
+
+    // Places that can trigger updateDrawElementsTypeValidity:
+    // 1. Everything that triggers updateBasicDrawElementsError.
+    //
+    // Folds isValidDrawElementsType and getBasicDrawElementsError into a single table lookup.
+    bool canDrawElementsWithType(const Context *context, DrawElementsType type) const
+    {
+        DrawValidity validity = mCachedDrawElementsTypeValidity[type];
+        if (ANGLE_LIKELY(validity != DrawValidity::Unknown))
+        {
+            return validity == DrawValidity::Valid;
+        }
+
+        return canDrawElementsWithTypeImpl(context, type);
+    }
+
     // Cannot change except on Context/Extension init.
     bool isValidBindTextureType(TextureType type) const
     {
@@ -334,6 +372,16 @@ class StateCache final : angle::NonCopyable
         return mCachedTransformFeedbackActiveUnpaused;
     }
 
+    // Places that can trigger updateTransformFeedbackActiveUnpaused:
+    // 1. onActiveTransformFeedbackChange.
+    //
+    // Without geometry or tessellation shaders, the number of vertices written by a draw call is
+    // known up front and the transform feedback buffers must have room for them.
+    bool isTransformFeedbackBufferSpaceCheckNeeded() const
+    {
+        return mCachedTransformFeedbackBufferSpaceCheckNeeded;
+    }
+
     // Cannot change except on Context/Extension init.
     VertexAttribTypeCase getVertexAttribTypeValidation(VertexAttribType type) const
     {
@@ -392,9 +440,19 @@ class StateCache final : angle::NonCopyable
     {
         mCachedBasicDrawStatesErrorString = kInvalidPointer;
         mCachedBasicDrawStatesErrorCode   = GL_NO_ERROR;
+        updateDrawModeValidity();
     }
     void updateProgramPipelineError() { mCachedProgramPipelineError = kInvalidPointer; }
-    void updateBasicDrawElementsError() { mCachedBasicDrawElementsError = kInvalidPointer; }
+    void updateBasicDrawElementsError()
+    {
+        mCachedBasicDrawElementsError = kInvalidPointer;
+        updateDrawElementsTypeValidity();
+    }
+    void updateDrawModeValidity() const { mCachedDrawModeValidity.fill(DrawValidity::Unknown); }
+    void updateDrawElementsTypeValidity() const
+    {
+        mCachedDrawElementsTypeValidity.fill(DrawValidity::Unknown);
+    }
     void updateTransformFeedbackActiveUnpaused(Context *context);
     void updateVertexAttribTypesValidation(Context *context);
     void updateActiveShaderStorageBufferIndices(Context *context);
@@ -412,6 +470,10 @@ class StateCache final : angle::NonCopyable
                                          const PrivateStateCache *privateStateCache) const;
     intptr_t getProgramPipelineErrorImpl(const Context *context) const;
     intptr_t getBasicDrawElementsErrorImpl(const Context *context) const;
+    bool canDrawWithModeImpl(const Context *context,
+                             const PrivateStateCache *privateStateCache,
+                             PrimitiveMode primitiveMode) const;
+    bool canDrawElementsWithTypeImpl(const Context *context, DrawElementsType type) const;
 
     static constexpr intptr_t kInvalidPointer = 1;
 
@@ -479,6 +541,7 @@ class StateCache final : angle::NonCopyable
     mutable intptr_t mCachedProgramPipelineError;
     bool mCachedHasAnyEnabledClientAttrib;
     bool mCachedTransformFeedbackActiveUnpaused;
+    bool mCachedTransformFeedbackBufferSpaceCheckNeeded;
     StorageBuffersMask mCachedActiveShaderStorageBufferIndices;
     ImageUnitMask mCachedActiveImageUnitIndices;
 
@@ -498,6 +561,19 @@ class StateCache final : angle::NonCopyable
                          angle::EnumSize<VertexAttribType>() + 1>
         mCachedIntegerVertexAttribTypesValidation;
 
+    // Lazily computed results of the checks folded together by canDrawWithMode and
+    // canDrawElementsWithType.  Invalidated along with the caches they are derived from.
+    enum class DrawValidity : uint8_t
+    {
+        Unknown,
+        Valid,
+        Invalid,
+    };
+    template <typename EnumT>
+    using DrawValidityMap = angle::PackedEnumMap<EnumT, DrawValidity, angle::EnumSize<EnumT>() + 1>;
+    mutable DrawValidityMap<PrimitiveMode> mCachedDrawModeValidity;
+    mutable DrawValidityMap<DrawElementsType> mCachedDrawElementsTypeValidity;
+
     bool mCachedCanDraw;
 };
 
@@ -13,7 +13,7 @@ namespace angle
 {
 namespace
 {
-class DecompressTest : public ::testing::Test
+class DecompressTest : public ::testing::TestWithParam<BlobCodec>
 {
   protected:
     void SetUp() override
@@ -26,7 +26,8 @@ class DecompressTest : public ::testing::Test
             mTestData[i] = static_cast<uint8_t>(i);
         }
 
-        ASSERT_TRUE(CompressBlob(mTestData.size(), mTestData.data(), &mCompressedData));
+        ASSERT_TRUE(
+            CompressBlob(mTestData.size(), mTestData.data(), GetParam(), &mCompressedData));
     }
 
     void setCompressedDataLastDWord(uint32_t value)
@@ -55,20 +56,20 @@ class DecompressTest : public ::testing::Test
 };
 
 // Tests that decompressing full data has no errors.
-TEST_F(DecompressTest, FullData)
+TEST_P(DecompressTest, FullData)
 {
     EXPECT_TRUE(decompress(mCompressedData.size(), mTestData.size()));
     EXPECT_TRUE(checkUncompressedData());
 }
 
 // Tests expected failure if |maxUncompressedDataSize| is less than actual uncompressed size.
-TEST_F(DecompressTest, InsufficientMaxUncompressedDataSize)
+TEST_P(DecompressTest, InsufficientMaxUncompressedDataSize)
 {
     EXPECT_FALSE(decompress(mCompressedData.size(), mTestData.size() - 1));
 }
 
 // Tests expected failure if try to decompress partial compressed data.
-TEST_F(DecompressTest, UnexpectedPartialData)
+TEST_P(DecompressTest, UnexpectedPartialData)
 {
     // Use this to avoid |maxUncompressedDataSize| affecting the test.
     constexpr size_t kMaxUncompressedDataSize = std::numeric_limits<size_t>::max();
@@ -77,7 +78,7 @@ TEST_F(DecompressTest, UnexpectedPartialData)
 }
 
 // Tests expected failure if try to decompress corrupted data.
-TEST_F(DecompressTest, CorruptedData)
+TEST_P(DecompressTest, CorruptedData)
 {
     // Corrupt the compressed data.
     const size_t corruptIndex = mCompressedData.size() / 2;
@@ -87,10 +88,15 @@ TEST_F(DecompressTest, CorruptedData)
 }
 
 // Tests expected failures if try to decompress data with the corrupted last dword.
-TEST_F(DecompressTest, CorruptedLastDWord)
+TEST_P(DecompressTest, CorruptedLastDWord)
 {
     // Last dword stores decompressed data size and not the actual compressed data. This dword must
     // match the decompressed size. Decompress should fail if it is not the case.
+    // Only the gzip format of deflate blobs has this dword.
+    if (GetParam() != BlobCodec::Deflate)
+    {
+        GTEST_SKIP();
+    }
 
     // Use this to avoid |maxUncompressedDataSize| affecting the test.
     constexpr size_t kMaxUncompressedDataSize = std::numeric_limits<size_t>::max();
@@ -113,5 +119,30 @@ TEST_F(DecompressTest, CorruptedLastDWord)
     EXPECT_TRUE(checkUncompressedData());
 }
 
+// Tests that blobs compressed with one codec are correctly decompressed after switching to another,
+// as is the case for blobs stored by previous versions.
+TEST_P(DecompressTest, OtherCodec)
+{
+    const BlobCodec otherCodec =
+        GetParam() == BlobCodec::Deflate ? BlobCodec::LZ : BlobCodec::Deflate;
+
+    MemoryBuffer otherCompressedData;
+    ASSERT_TRUE(
+        CompressBlob(mTestData.size(), mTestData.data(), otherCodec, &otherCompressedData));
+    EXPECT_TRUE(DecompressBlob(otherCompressedData.data(), otherCompressedData.size(),
+                               mTestData.size(), &mUncompressedData));
+    EXPECT_TRUE(checkUncompressedData());
+}
+
+std::string CodecName(const ::testing::TestParamInfo<BlobCodec> &info)
+{
+    return info.param == BlobCodec::Deflate ? "Deflate" : "LZ";
+}
+
+INSTANTIATE_TEST_SUITE_P(,
+                         DecompressTest,
+                         ::testing::Values(BlobCodec::Deflate, BlobCodec::LZ),
+                         CodecName);
+
 }  // anonymous namespace
 }  // namespace angle
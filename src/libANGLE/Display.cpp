@@ -142,6 +142,12 @@ TLSData *GetDisplayTLS()
 
 constexpr angle::SubjectIndex kGPUSwitchedSubjectIndex = 0;
 
+// Directory in which to persist the blob cache, if the application doesn't provide caching
+// callbacks.
+constexpr char kBlobCacheDirEnvVar[]            = "ANGLE_BLOB_CACHE_DIR";
+constexpr char kBlobCacheFileName[]             = "angle_blob_cache.bin";
+constexpr size_t kDefaultBlobCacheFileSizeBytes = 256 * 1024 * 1024;
+
 static constexpr size_t kWindowSurfaceMapSize = 32;
 typedef angle::FlatUnorderedMap<EGLNativeWindowType, Surface *, kWindowSurfaceMapSize>
     WindowSurfaceMap;
@@ -1061,6 +1067,16 @@ Error Display::initialize()
         mBlobCache.resize(1024 * 1024);
     }
 
+    // Keep the cache across process restarts where there is no application cache to rely on, such
+    // as in headless server processes.
+    const std::string blobCacheDir = angle::GetEnvironmentVar(kBlobCacheDirEnvVar);
+    if (!blobCacheDir.empty() && !mBlobCache.hasFileStore() &&
+        angle::CreateDirectories(blobCacheDir))
+    {
+        mBlobCache.openFileStore(angle::ConcatenatePath(blobCacheDir, kBlobCacheFileName),
+                                 kDefaultBlobCacheFileSizeBytes);
+    }
+
     setGlobalDebugAnnotator();
 
     gl::InitializeDebugMutexIfNeeded();
@@ -2376,6 +2392,8 @@ void Display::initializeFrontendFeatures()
     // Reject shaders with undefined behavior.  In the compiler, this only applies to WebGL.
     ANGLE_FEATURE_CONDITION(&mFrontendFeatures, rejectWebglShadersWithUndefinedBehavior, true);
 
+    ANGLE_FEATURE_CONDITION(&mFrontendFeatures, memoizeCompileResults, true);
+
     mImplementation->initializeFrontendFeatures(&mFrontendFeatures);
 }
 
@@ -10,12 +10,19 @@
 #include "libANGLE/IndexRangeCache.h"
 
 #include "common/debug.h"
+#include "common/utilities.h"
 #include "libANGLE/formatutils.h"
 
 namespace gl
 {
 
-IndexRangeCache::IndexRangeCache() {}
+IndexRangeCache::IndexRangeCache() : IndexRangeCache(kDefaultMaxEntries) {}
+
+IndexRangeCache::IndexRangeCache(size_t maxEntries)
+    : mRoot(kNoNode), mMaxEntries(maxEntries), mPrioritySeed(0x9E3779B9u)
+{
+    ASSERT(mMaxEntries > 0);
+}
 
 IndexRangeCache::~IndexRangeCache() {}
 
@@ -25,26 +32,44 @@ void IndexRangeCache::addRange(DrawElementsType type,
                                bool primitiveRestartEnabled,
                                const IndexRange &range)
 {
-    mIndexRangeCache[IndexRangeKey(type, offset, count, primitiveRestartEnabled)] = range;
+    IndexRangeKey key(type, offset, count, primitiveRestartEnabled);
+
+    NodeIndex existing = findNode(key);
+    if (existing != kNoNode)
+    {
+        mNodes[existing].range = range;
+        mLRUList.splice(mLRUList.begin(), mLRUList, mNodes[existing].lruPosition);
+        return;
+    }
+
+    evictToSize(mMaxEntries - 1);
+
+    NodeIndex node = allocateNode(key, range);
+    NodeIndex less, greater;
+    split(mRoot, key, &less, &greater);
+    mRoot = merge(merge(less, node), greater);
 }
 
 bool IndexRangeCache::findRange(DrawElementsType type,
                                 size_t offset,
                                 size_t count,
                                 bool primitiveRestartEnabled,
-                                IndexRange *outRange) const
+                                IndexRange *outRange)
 {
-    auto i = mIndexRangeCache.find(IndexRangeKey(type, offset, count, primitiveRestartEnabled));
-    if (i != mIndexRangeCache.end())
+    NodeIndex node = findNode(IndexRangeKey(type, offset, count, primitiveRestartEnabled));
+    if (node != kNoNode)
     {
+        mStats.hits++;
+        mLRUList.splice(mLRUList.begin(), mLRUList, mNodes[node].lruPosition);
         if (outRange)
         {
-            *outRange = i->second;
+            *outRange = mNodes[node].range;
         }
         return true;
     }
     else
     {
+        mStats.misses++;
         if (outRange)
         {
             *outRange = IndexRange();
@@ -55,51 +80,306 @@ bool IndexRangeCache::findRange(DrawElementsType type,
 
 void IndexRangeCache::invalidateRange(size_t offset, size_t size)
 {
-    size_t invalidateStart = offset;
-    size_t invalidateEnd   = offset + size;
+    if (mRoot == kNoNode || size == 0)
+    {
+        return;
+    }
 
-    auto i = mIndexRangeCache.begin();
-    while (i != mIndexRangeCache.end())
+    ASSERT(mOverlappingNodes.empty());
+    collectOverlapping(mRoot, offset, offset + size);
+
+    for (NodeIndex node : mOverlappingNodes)
     {
-        size_t rangeStart = i->first.offset;
-        size_t rangeEnd =
-            i->first.offset + (GetDrawElementsTypeSize(i->first.type) * i->first.count);
+        mStats.invalidations++;
+        eraseNode(node);
+    }
+    mOverlappingNodes.clear();
+}
 
-        if (invalidateEnd < rangeStart || invalidateStart > rangeEnd)
+void IndexRangeCache::clear()
+{
+    mNodes.clear();
+    mFreeNodes.clear();
+    mRoot = kNoNode;
+    mLRUList.clear();
+}
+
+void IndexRangeCache::setMaxEntries(size_t maxEntries)
+{
+    ASSERT(maxEntries > 0);
+    mMaxEntries = maxEntries;
+    evictToSize(mMaxEntries);
+}
+
+IndexRangeCache::NodeIndex IndexRangeCache::findNode(const IndexRangeKey &key) const
+{
+    NodeIndex node = mRoot;
+    while (node != kNoNode)
+    {
+        const Node &current = mNodes[node];
+        if (key < current.key)
+        {
+            node = current.left;
+        }
+        else if (current.key < key)
         {
-            ++i;
+            node = current.right;
         }
         else
         {
-            mIndexRangeCache.erase(i++);
+            return node;
         }
     }
+    return kNoNode;
 }
 
-void IndexRangeCache::clear()
+IndexRangeCache::NodeIndex IndexRangeCache::allocateNode(const IndexRangeKey &key,
+                                                         const IndexRange &range)
+{
+    NodeIndex node;
+    if (!mFreeNodes.empty())
+    {
+        node = mFreeNodes.back();
+        mFreeNodes.pop_back();
+    }
+    else
+    {
+        node = static_cast<NodeIndex>(mNodes.size());
+        mNodes.emplace_back();
+    }
+
+    // xorshift32, so that the tree shape does not depend on the order of the offsets.
+    mPrioritySeed ^= mPrioritySeed << 13;
+    mPrioritySeed ^= mPrioritySeed >> 17;
+    mPrioritySeed ^= mPrioritySeed << 5;
+
+    mLRUList.push_front(node);
+
+    Node &newNode        = mNodes[node];
+    newNode.key          = key;
+    newNode.range        = range;
+    newNode.endOffset    = key.endOffset();
+    newNode.maxEndOffset = newNode.endOffset;
+    newNode.priority     = mPrioritySeed;
+    newNode.left         = kNoNode;
+    newNode.right        = kNoNode;
+    newNode.lruPosition  = mLRUList.begin();
+    return node;
+}
+
+void IndexRangeCache::updateMaxEndOffset(NodeIndex node)
+{
+    Node &current        = mNodes[node];
+    current.maxEndOffset = current.endOffset;
+    if (current.left != kNoNode)
+    {
+        current.maxEndOffset = std::max(current.maxEndOffset, mNodes[current.left].maxEndOffset);
+    }
+    if (current.right != kNoNode)
+    {
+        current.maxEndOffset = std::max(current.maxEndOffset, mNodes[current.right].maxEndOffset);
+    }
+}
+
+IndexRangeCache::NodeIndex IndexRangeCache::merge(NodeIndex left, NodeIndex right)
+{
+    // Every key in |left| is less than every key in |right|.
+    if (left == kNoNode)
+    {
+        return right;
+    }
+    if (right == kNoNode)
+    {
+        return left;
+    }
+
+    if (mNodes[left].priority > mNodes[right].priority)
+    {
+        mNodes[left].right = merge(mNodes[left].right, right);
+        updateMaxEndOffset(left);
+        return left;
+    }
+    else
+    {
+        mNodes[right].left = merge(left, mNodes[right].left);
+        updateMaxEndOffset(right);
+        return right;
+    }
+}
+
+void IndexRangeCache::split(NodeIndex node,
+                            const IndexRangeKey &key,
+                            NodeIndex *outLess,
+                            NodeIndex *outGreater)
+{
+    if (node == kNoNode)
+    {
+        *outLess    = kNoNode;
+        *outGreater = kNoNode;
+        return;
+    }
+
+    if (mNodes[node].key < key)
+    {
+        split(mNodes[node].right, key, &mNodes[node].right, outGreater);
+        *outLess = node;
+    }
+    else
+    {
+        split(mNodes[node].left, key, outLess, &mNodes[node].left);
+        *outGreater = node;
+    }
+    updateMaxEndOffset(node);
+}
+
+IndexRangeCache::NodeIndex IndexRangeCache::eraseFromTree(NodeIndex node, const IndexRangeKey &key)
+{
+    ASSERT(node != kNoNode);
+    Node &current = mNodes[node];
+    if (key < current.key)
+    {
+        current.left = eraseFromTree(current.left, key);
+    }
+    else if (current.key < key)
+    {
+        current.right = eraseFromTree(current.right, key);
+    }
+    else
+    {
+        return merge(current.left, current.right);
+    }
+    updateMaxEndOffset(node);
+    return node;
+}
+
+void IndexRangeCache::collectOverlapping(NodeIndex node, size_t start, size_t end)
+{
+    // Subtrees ending at or before |start| cannot overlap [start, end).
+    if (node == kNoNode || mNodes[node].maxEndOffset <= start)
+    {
+        return;
+    }
+
+    const Node &current = mNodes[node];
+    mStats.invalidationVisits++;
+    collectOverlapping(current.left, start, end);
+
+    // This node and its right subtree start at or after |end|.
+    if (current.key.offset >= end)
+    {
+        return;
+    }
+
+    if (current.endOffset > start)
+    {
+        mOverlappingNodes.push_back(node);
+    }
+    collectOverlapping(current.right, start, end);
+}
+
+void IndexRangeCache::eraseNode(NodeIndex node)
+{
+    mRoot = eraseFromTree(mRoot, mNodes[node].key);
+    mLRUList.erase(mNodes[node].lruPosition);
+    mFreeNodes.push_back(node);
+}
+
+void IndexRangeCache::evictToSize(size_t maxEntries)
+{
+    while (size() > maxEntries)
+    {
+        mStats.evictions++;
+        eraseNode(mLRUList.back());
+    }
+}
+
+IndexRangeBlockSummary::IndexRangeBlockSummary()
+    : mType(DrawElementsType::InvalidEnum), mPrimitiveRestartEnabled(false)
+{}
+
+IndexRangeBlockSummary::~IndexRangeBlockSummary() {}
+
+void IndexRangeBlockSummary::reset(DrawElementsType type,
+                                   bool primitiveRestartEnabled,
+                                   size_t bufferSize)
+{
+    // Only whole blocks are summarized; a trailing partial block is always scanned directly.
+    const size_t blockCount = bufferSize / kBlockSize;
+
+    mType                    = type;
+    mPrimitiveRestartEnabled = primitiveRestartEnabled;
+    mBlockRanges.assign(blockCount, IndexRange());
+    mBlockValid.assign(blockCount, false);
+}
+
+void IndexRangeBlockSummary::clear()
 {
-    mIndexRangeCache.clear();
+    mType = DrawElementsType::InvalidEnum;
+    mBlockRanges.clear();
+    mBlockValid.clear();
 }
 
-bool IndexRangeKey::operator<(const IndexRangeKey &rhs) const
+void IndexRangeBlockSummary::invalidateRange(size_t offset, size_t size)
 {
-    if (type != rhs.type)
+    if (mBlockRanges.empty() || size == 0)
     {
-        return type < rhs.type;
+        return;
     }
-    if (offset != rhs.offset)
+
+    const size_t firstBlock = offset / kBlockSize;
+    const size_t lastBlock  = std::min((offset + size - 1) / kBlockSize + 1, mBlockValid.size());
+    for (size_t block = firstBlock; block < lastBlock; ++block)
     {
-        return offset < rhs.offset;
+        mBlockValid[block] = false;
     }
-    if (count != rhs.count)
+}
+
+void IndexRangeBlockSummary::updateRange(size_t offset, size_t size, const uint8_t *data)
+{
+    if (mBlockRanges.empty() || size == 0)
     {
-        return count < rhs.count;
+        return;
     }
-    if (primitiveRestartEnabled != rhs.primitiveRestartEnabled)
+
+    const size_t end             = offset + size;
+    const size_t firstBlock      = rx::roundUp(offset, kBlockSize) / kBlockSize;
+    const size_t lastBlock       = std::min(end / kBlockSize, mBlockRanges.size());
+    const size_t indicesPerBlock = kBlockSize / GetDrawElementsTypeSize(mType);
+
+    for (size_t block = firstBlock; block < lastBlock; ++block)
     {
-        return primitiveRestartEnabled;
+        const uint8_t *blockData = data + (block * kBlockSize - offset);
+        setBlockRange(block, ComputeIndexRange(mType, blockData, indicesPerBlock,
+                                               mPrimitiveRestartEnabled));
     }
-    return false;
+
+    // The edges of the update only partially overwrite their blocks.
+    if (firstBlock * kBlockSize > offset)
+    {
+        invalidateRange(offset, 1);
+    }
+    if (end % kBlockSize != 0)
+    {
+        invalidateRange(end - 1, 1);
+    }
+}
+
+IndexRange CombineIndexRanges(const IndexRange &a, const IndexRange &b)
+{
+    if (a.isEmpty())
+    {
+        return b;
+    }
+    if (b.isEmpty())
+    {
+        return a;
+    }
+    return IndexRange(std::min(a.start(), b.start()), std::max(a.end(), b.end()));
+}
+
+size_t IndexRangeKey::endOffset() const
+{
+    return offset + GetDrawElementsTypeSize(type) * count;
 }
 
 }  // namespace gl
@@ -15,7 +15,10 @@
 #include "common/angleutils.h"
 #include "common/mathutil.h"
 
-#include <map>
+#include <limits>
+#include <list>
+#include <tuple>
+#include <vector>
 
 namespace gl
 {
@@ -27,16 +30,36 @@ struct IndexRangeKey
     bool operator<(const IndexRangeKey &rhs) const;
     bool operator==(const IndexRangeKey &rhs) const;
 
+    // One past the last byte of the buffer read by this range.
+    size_t endOffset() const;
+
     DrawElementsType type{DrawElementsType::InvalidEnum};
     size_t offset{0};
     size_t count{0};
     bool primitiveRestartEnabled{false};
 };
 
+struct IndexRangeCacheStats
+{
+    uint64_t hits{0};
+    uint64_t misses{0};
+    uint64_t evictions{0};
+    uint64_t invalidations{0};
+    // Entries examined by invalidateRange(), whether or not they overlapped the updated bytes.
+    uint64_t invalidationVisits{0};
+};
+
+// Caches index ranges computed over a buffer.  Entries are kept in an interval tree ordered by
+// buffer offset, where every node also records the largest end offset in its subtree, so that a
+// partial buffer update only descends into subtrees that can overlap it.  The number of entries is
+// bounded with least-recently-used eviction.
 class IndexRangeCache
 {
   public:
+    static constexpr size_t kDefaultMaxEntries = 256;
+
     IndexRangeCache();
+    explicit IndexRangeCache(size_t maxEntries);
     ~IndexRangeCache();
 
     void addRange(DrawElementsType type,
@@ -48,15 +71,108 @@ class IndexRangeCache
                    size_t offset,
                    size_t count,
                    bool primitiveRestartEnabled,
-                   IndexRange *outRange) const;
+                   IndexRange *outRange);
 
     void invalidateRange(size_t offset, size_t size);
     void clear();
 
+    void setMaxEntries(size_t maxEntries);
+    size_t size() const { return mNodes.size() - mFreeNodes.size(); }
+    const IndexRangeCacheStats &getStats() const { return mStats; }
+
+  private:
+    using NodeIndex                    = uint32_t;
+    static constexpr NodeIndex kNoNode = std::numeric_limits<NodeIndex>::max();
+
+    // Indices of the nodes, most recently used at the front.
+    using LRUList = std::list<NodeIndex>;
+
+    // A treap node: a binary search tree by key and a heap by priority.
+    struct Node
+    {
+        IndexRangeKey key;
+        IndexRange range;
+        size_t endOffset;
+        // Largest endOffset of this node and its descendants.
+        size_t maxEndOffset;
+        uint32_t priority;
+        NodeIndex left;
+        NodeIndex right;
+        LRUList::iterator lruPosition;
+    };
+
+    NodeIndex findNode(const IndexRangeKey &key) const;
+    NodeIndex allocateNode(const IndexRangeKey &key, const IndexRange &range);
+    void updateMaxEndOffset(NodeIndex node);
+    NodeIndex merge(NodeIndex left, NodeIndex right);
+    // Splits |node| into the keys less than |key| and the keys greater than or equal to it.
+    void split(NodeIndex node, const IndexRangeKey &key, NodeIndex *outLess, NodeIndex *outGreater);
+    NodeIndex eraseFromTree(NodeIndex node, const IndexRangeKey &key);
+    void collectOverlapping(NodeIndex node, size_t start, size_t end);
+    void eraseNode(NodeIndex node);
+    void evictToSize(size_t maxEntries);
+
+    std::vector<Node> mNodes;
+    std::vector<NodeIndex> mFreeNodes;
+    NodeIndex mRoot;
+    LRUList mLRUList;
+    size_t mMaxEntries;
+    uint32_t mPrioritySeed;
+    // Scratch list of the nodes found by collectOverlapping().
+    std::vector<NodeIndex> mOverlappingNodes;
+    IndexRangeCacheStats mStats;
+};
+
+// Index ranges of each fixed-size block of a buffer, for one index type and primitive restart
+// mode.  A query spanning many blocks combines the block ranges and only scans the partial blocks
+// at either end.  Blocks are refreshed from CPU data on upload when possible, and otherwise
+// rescanned lazily the next time they are queried.
+class IndexRangeBlockSummary
+{
+  public:
+    static constexpr size_t kBlockSize = 4096;
+
+    IndexRangeBlockSummary();
+    ~IndexRangeBlockSummary();
+
+    bool matches(DrawElementsType type, bool primitiveRestartEnabled) const
+    {
+        return mType == type && mPrimitiveRestartEnabled == primitiveRestartEnabled;
+    }
+    void reset(DrawElementsType type, bool primitiveRestartEnabled, size_t bufferSize);
+    void clear();
+
+    // Marks the blocks overlapping [offset, offset + size) for rescanning.
+    void invalidateRange(size_t offset, size_t size);
+    // Recomputes the blocks fully covered by |data| written at |offset|, and invalidates the
+    // partially covered ones.
+    void updateRange(size_t offset, size_t size, const uint8_t *data);
+
+    DrawElementsType getType() const { return mType; }
+    bool isPrimitiveRestartEnabled() const { return mPrimitiveRestartEnabled; }
+    size_t getBlockCount() const { return mBlockRanges.size(); }
+    bool isBlockValid(size_t block) const { return mBlockValid[block]; }
+    const IndexRange &getBlockRange(size_t block) const
+    {
+        ASSERT(mBlockValid[block]);
+        return mBlockRanges[block];
+    }
+    void setBlockRange(size_t block, const IndexRange &range)
+    {
+        mBlockRanges[block] = range;
+        mBlockValid[block]  = true;
+    }
+
   private:
-    std::map<IndexRangeKey, IndexRange> mIndexRangeCache;
+    DrawElementsType mType;
+    bool mPrimitiveRestartEnabled;
+    std::vector<IndexRange> mBlockRanges;
+    std::vector<bool> mBlockValid;
 };
 
+// Returns the smallest range containing both |a| and |b|.
+IndexRange CombineIndexRanges(const IndexRange &a, const IndexRange &b);
+
 // First level cache stored inline at the query site.
 class IndexRangeInlineCache
 {
@@ -102,6 +218,13 @@ inline bool IndexRangeKey::operator==(const IndexRangeKey &rhs) const
            primitiveRestartEnabled == rhs.primitiveRestartEnabled;
 }
 
+inline bool IndexRangeKey::operator<(const IndexRangeKey &rhs) const
+{
+    // Offset is the primary key so that the cache can be scanned in buffer order.
+    return std::tie(offset, type, count, primitiveRestartEnabled) <
+           std::tie(rhs.offset, rhs.type, rhs.count, rhs.primitiveRestartEnabled);
+}
+
 }  // namespace gl
 
 #endif  // LIBANGLE_INDEXRANGECACHE_H_
@@ -0,0 +1,203 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// IndexRangeCache_unittest.cpp: Unit tests for the index range cache.
+
+#include <gtest/gtest.h>
+
+#include "libANGLE/IndexRangeCache.h"
+
+namespace gl
+{
+namespace
+{
+constexpr DrawElementsType kUShort = DrawElementsType::UnsignedShort;
+
+// Test basic add and lookup, including that the key includes all parameters.
+TEST(IndexRangeCacheTest, AddAndFind)
+{
+    IndexRangeCache cache;
+    IndexRange range;
+
+    EXPECT_FALSE(cache.findRange(kUShort, 0, 6, false, &range));
+    cache.addRange(kUShort, 0, 6, false, IndexRange(1, 5));
+
+    EXPECT_TRUE(cache.findRange(kUShort, 0, 6, false, &range));
+    EXPECT_EQ(IndexRange(1, 5), range);
+    EXPECT_FALSE(cache.findRange(kUShort, 0, 6, true, &range));
+    EXPECT_FALSE(cache.findRange(kUShort, 0, 3, false, &range));
+    EXPECT_FALSE(cache.findRange(DrawElementsType::UnsignedInt, 0, 6, false, &range));
+
+    EXPECT_EQ(1u, cache.getStats().hits);
+    EXPECT_EQ(4u, cache.getStats().misses);
+}
+
+// Test that invalidation only removes entries overlapping the updated bytes.
+TEST(IndexRangeCacheTest, PartialInvalidation)
+{
+    IndexRangeCache cache;
+
+    // Three ranges of 8 ushorts each at bytes [0, 16), [16, 32) and [32, 48).
+    cache.addRange(kUShort, 0, 8, false, IndexRange(0, 7));
+    cache.addRange(kUShort, 16, 8, false, IndexRange(8, 15));
+    cache.addRange(kUShort, 32, 8, false, IndexRange(16, 23));
+    // A long range covering everything.
+    cache.addRange(kUShort, 0, 24, false, IndexRange(0, 23));
+
+    cache.invalidateRange(20, 4);
+    EXPECT_EQ(2u, cache.size());
+    EXPECT_TRUE(cache.findRange(kUShort, 0, 8, false, nullptr));
+    EXPECT_FALSE(cache.findRange(kUShort, 16, 8, false, nullptr));
+    EXPECT_TRUE(cache.findRange(kUShort, 32, 8, false, nullptr));
+    EXPECT_FALSE(cache.findRange(kUShort, 0, 24, false, nullptr));
+    EXPECT_EQ(2u, cache.getStats().invalidations);
+
+    // Updates touching but not overlapping an entry keep it.
+    cache.invalidateRange(16, 16);
+    EXPECT_EQ(2u, cache.size());
+
+    cache.invalidateRange(47, 1);
+    EXPECT_EQ(1u, cache.size());
+    EXPECT_TRUE(cache.findRange(kUShort, 0, 8, false, nullptr));
+}
+
+// Test that the cache is bounded and evicts the least recently used entry.
+TEST(IndexRangeCacheTest, LRUEviction)
+{
+    IndexRangeCache cache(2);
+
+    cache.addRange(kUShort, 0, 3, false, IndexRange(0, 2));
+    cache.addRange(kUShort, 6, 3, false, IndexRange(3, 5));
+
+    // Touch the first entry so that the second one becomes the least recently used.
+    EXPECT_TRUE(cache.findRange(kUShort, 0, 3, false, nullptr));
+
+    cache.addRange(kUShort, 12, 3, false, IndexRange(6, 8));
+    EXPECT_EQ(2u, cache.size());
+    EXPECT_EQ(1u, cache.getStats().evictions);
+    EXPECT_TRUE(cache.findRange(kUShort, 0, 3, false, nullptr));
+    EXPECT_FALSE(cache.findRange(kUShort, 6, 3, false, nullptr));
+    EXPECT_TRUE(cache.findRange(kUShort, 12, 3, false, nullptr));
+
+    cache.setMaxEntries(1);
+    EXPECT_EQ(1u, cache.size());
+    EXPECT_TRUE(cache.findRange(kUShort, 12, 3, false, nullptr));
+}
+
+// Test that a long entry does not make invalidation visit every short entry.
+TEST(IndexRangeCacheTest, InvalidationVisitsOnlyOverlappingSubtrees)
+{
+    constexpr size_t kShortEntryCount = 512;
+    IndexRangeCache cache(kShortEntryCount + 1);
+
+    // One draw over the whole buffer plus many short draws of 4 ushorts every 16 bytes.
+    cache.addRange(kUShort, 0, kShortEntryCount * 8, false, IndexRange(0, 2));
+    for (size_t entry = 0; entry < kShortEntryCount; ++entry)
+    {
+        cache.addRange(kUShort, entry * 16, 4, false, IndexRange(0, 2));
+    }
+    ASSERT_EQ(kShortEntryCount + 1, cache.size());
+
+    // Updating a few bytes in the middle only removes the long entry and one short entry.
+    cache.invalidateRange(kShortEntryCount * 8 + 2, 4);
+    EXPECT_EQ(kShortEntryCount - 1, cache.size());
+    EXPECT_EQ(2u, cache.getStats().invalidations);
+    EXPECT_FALSE(cache.findRange(kUShort, 0, kShortEntryCount * 8, false, nullptr));
+    EXPECT_FALSE(cache.findRange(kUShort, kShortEntryCount * 8, 4, false, nullptr));
+    EXPECT_TRUE(cache.findRange(kUShort, kShortEntryCount * 8 - 16, 4, false, nullptr));
+    EXPECT_TRUE(cache.findRange(kUShort, kShortEntryCount * 8 + 16, 4, false, nullptr));
+
+    // The visited nodes are the paths to the overlapping entries, not the entries before them.
+    const uint64_t firstVisits = cache.getStats().invalidationVisits;
+    EXPECT_LT(firstVisits, 64u);
+
+    // Without the long entry, an update between entries only walks down the tree.
+    cache.invalidateRange(kShortEntryCount * 4 + 8, 8);
+    EXPECT_EQ(kShortEntryCount - 1, cache.size());
+    EXPECT_LT(cache.getStats().invalidationVisits - firstVisits, 64u);
+
+    // Invalidating everything removes every entry.
+    cache.invalidateRange(0, kShortEntryCount * 16);
+    EXPECT_EQ(0u, cache.size());
+    EXPECT_EQ(kShortEntryCount + 1, cache.getStats().invalidations);
+}
+
+// Test that clear() resets the contents but keeps the statistics.
+TEST(IndexRangeCacheTest, Clear)
+{
+    IndexRangeCache cache;
+    cache.addRange(kUShort, 0, 3, false, IndexRange(0, 2));
+    cache.addRange(kUShort, 1000, 3, false, IndexRange(0, 2));
+    cache.clear();
+    EXPECT_EQ(0u, cache.size());
+    EXPECT_FALSE(cache.findRange(kUShort, 0, 3, false, nullptr));
+    EXPECT_EQ(1u, cache.getStats().misses);
+
+    // Invalidating an empty cache is a no-op.
+    cache.invalidateRange(0, 4096);
+    EXPECT_EQ(0u, cache.getStats().invalidations);
+}
+
+// Test that uploads refresh the fully covered summary blocks and invalidate the partial ones.
+TEST(IndexRangeBlockSummaryTest, UpdateAndInvalidate)
+{
+    constexpr size_t kBlockSize   = IndexRangeBlockSummary::kBlockSize;
+    constexpr size_t kBlockCount  = 4;
+    constexpr size_t kBufferSize  = kBlockCount * kBlockSize + 100;
+    constexpr size_t kIndexCount  = kBufferSize / sizeof(GLushort);
+    constexpr size_t kBlockValues = kBlockSize / sizeof(GLushort);
+
+    IndexRangeBlockSummary summary;
+    EXPECT_FALSE(summary.matches(kUShort, false));
+    summary.reset(kUShort, false, kBufferSize);
+    EXPECT_TRUE(summary.matches(kUShort, false));
+    EXPECT_FALSE(summary.matches(kUShort, true));
+    ASSERT_EQ(kBlockCount, summary.getBlockCount());
+
+    std::vector<GLushort> indices(kIndexCount);
+    for (size_t i = 0; i < kIndexCount; ++i)
+    {
+        indices[i] = static_cast<GLushort>(i / kBlockValues * 10 + i % 7);
+    }
+    const uint8_t *data = reinterpret_cast<const uint8_t *>(indices.data());
+
+    // An upload of the whole buffer fills every block.
+    summary.updateRange(0, kBufferSize, data);
+    for (size_t block = 0; block < kBlockCount; ++block)
+    {
+        ASSERT_TRUE(summary.isBlockValid(block));
+        GLuint base = static_cast<GLuint>(block * 10);
+        EXPECT_EQ(IndexRange(base, base + 6), summary.getBlockRange(block));
+    }
+
+    // An upload straddling blocks 1 and 3 refreshes block 2 and invalidates blocks 1 and 3.
+    summary.updateRange(kBlockSize + 2, 2 * kBlockSize, data + kBlockSize + 2);
+    EXPECT_TRUE(summary.isBlockValid(0));
+    EXPECT_FALSE(summary.isBlockValid(1));
+    EXPECT_TRUE(summary.isBlockValid(2));
+    EXPECT_FALSE(summary.isBlockValid(3));
+
+    summary.invalidateRange(0, 1);
+    EXPECT_FALSE(summary.isBlockValid(0));
+
+    // Updates beyond the last whole block are ignored.
+    summary.invalidateRange(kBlockCount * kBlockSize, 100);
+    EXPECT_TRUE(summary.isBlockValid(2));
+
+    summary.clear();
+    EXPECT_FALSE(summary.matches(kUShort, false));
+    EXPECT_EQ(0u, summary.getBlockCount());
+}
+
+// Test combining index ranges.
+TEST(IndexRangeBlockSummaryTest, CombineIndexRanges)
+{
+    EXPECT_EQ(IndexRange(), CombineIndexRanges(IndexRange(), IndexRange()));
+    EXPECT_EQ(IndexRange(3, 4), CombineIndexRanges(IndexRange(), IndexRange(3, 4)));
+    EXPECT_EQ(IndexRange(3, 4), CombineIndexRanges(IndexRange(3, 4), IndexRange()));
+    EXPECT_EQ(IndexRange(1, 9), CombineIndexRanges(IndexRange(5, 9), IndexRange(1, 2)));
+}
+}  // anonymous namespace
+}  // namespace gl
@@ -186,7 +186,10 @@ angle::Result MemoryProgramCache::putProgram(const egl::BlobCache::Key &programH
     const angle::MemoryBuffer &serializedProgram = program->getSerializedBinary();
 
     angle::MemoryBuffer compressedData;
-    if (!angle::CompressBlob(serializedProgram.size(), serializedProgram.data(), &compressedData))
+    // Programs are loaded from the cache far more often than they are stored, so favor
+    // decompression speed over size.
+    if (!angle::CompressBlob(serializedProgram.size(), serializedProgram.data(),
+                             angle::BlobCodec::LZ, &compressedData))
     {
         ANGLE_PERF_WARNING(context->getState().getDebug(), GL_DEBUG_SEVERITY_LOW,
                            "Error compressing binary data.");
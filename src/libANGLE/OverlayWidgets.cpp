@@ -425,6 +425,21 @@ void AppendWidgetDataHelper::AppendVulkanWriteDescriptorSetCount(const overlay::
     AppendRunningGraphCommon(widget, imageExtent, textWidget, graphWidget, widgetCounts, format);
 }
 
+void AppendWidgetDataHelper::AppendVulkanCoalescedDrawCount(const overlay::Widget *widget,
+                                                            const gl::Extents &imageExtent,
+                                                            TextWidgetData *textWidget,
+                                                            GraphWidgetData *graphWidget,
+                                                            OverlayWidgetCounts *widgetCounts)
+{
+    auto format = [](uint64_t curValue, uint64_t maxValue) {
+        std::ostringstream text;
+        text << "Coalesced Draw Count: " << maxValue;
+        return text.str();
+    };
+
+    AppendRunningGraphCommon(widget, imageExtent, textWidget, graphWidget, widgetCounts, format);
+}
+
 void AppendWidgetDataHelper::AppendVulkanDescriptorSetAllocations(const overlay::Widget *widget,
                                                                   const gl::Extents &imageExtent,
                                                                   TextWidgetData *textWidget,
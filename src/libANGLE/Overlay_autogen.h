@@ -24,6 +24,8 @@ enum class WidgetId
     VulkanSecondaryCommandBufferPoolWaste,
     // Number of Descriptor Set writes in a frame (Count).
     VulkanWriteDescriptorSetCount,
+    // Number of draw calls merged into the previous draw call in a frame (Count).
+    VulkanCoalescedDrawCount,
     // Descriptor Set Allocations.
     VulkanDescriptorSetAllocations,
     // Shader Resource Descriptor Set Cache Hit Rate.
@@ -63,6 +65,7 @@ enum class WidgetId
     PROC(VulkanRenderPassCount)                 \
     PROC(VulkanSecondaryCommandBufferPoolWaste) \
     PROC(VulkanWriteDescriptorSetCount)         \
+    PROC(VulkanCoalescedDrawCount)              \
     PROC(VulkanDescriptorSetAllocations)        \
     PROC(VulkanShaderResourceDSHitRate)         \
     PROC(VulkanDynamicBufferAllocations)        \
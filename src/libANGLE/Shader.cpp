@@ -665,6 +665,11 @@ void Shader::compile(const Context *context, angle::JobResultExpectancy resultEx
     options.objectCode       = true;
     options.emulateGLDrawID  = true;
 
+    if (context->getFrontendFeatures().memoizeCompileResults.enabled)
+    {
+        options.memoizeCompileResults = true;
+    }
+
     // Add default options to WebGL shaders to prevent unexpected behavior during
     // compilation.
     if (context->isWebGL())
@@ -18,6 +18,7 @@
 #include "libANGLE/ContextMutex.h"
 #include "libANGLE/Debug.h"
 #include "libANGLE/GLES1State.h"
+#include "libANGLE/IndexRangeCache.h"
 #include "libANGLE/Overlay.h"
 #include "libANGLE/Program.h"
 #include "libANGLE/ProgramExecutable.h"
@@ -1446,6 +1447,8 @@ class State : angle::NonCopyable
         mDirtyUniformBlocks.reset();
         return dirtyBits;
     }
+    // Accumulated over the index range caches of the buffers queried by this context.
+    IndexRangeCacheStats &getIndexRangeCacheStats() const { return mIndexRangeCacheStats; }
     const PrivateState &privateState() const { return mPrivateState; }
     const GLES1State &gles1() const { return mPrivateState.gles1(); }
 
@@ -1635,6 +1638,9 @@ class State : angle::NonCopyable
     // context needs to react to such changes.
     mutable ProgramUniformBlockMask mDirtyUniformBlocks;
 
+    // Reported through GL_AMD_performance_monitor.
+    mutable IndexRangeCacheStats mIndexRangeCacheStats;
+
     PrivateState mPrivateState;
 };
 
@@ -7,6 +7,7 @@
 // angletypes.h : Defines a variety of structures and enum types that are used throughout libGLESv2
 
 #include "libANGLE/angletypes.h"
+#include "common/lz_utils.h"
 #include "libANGLE/Program.h"
 #include "libANGLE/State.h"
 #include "libANGLE/VertexArray.h"
@@ -1055,7 +1056,29 @@ GLsizeiptr GetBoundBufferAvailableSize(const OffsetBindingPointer<Buffer> &bindi
    //
 namespace angle
 {
-bool CompressBlob(const size_t cacheSize, const uint8_t *cacheData, MemoryBuffer *compressedData)
+namespace
+{
+// Blobs compressed with codecs other than deflate start with this header.  Deflate blobs are kept
+// in the gzip format, which starts with a different magic number, so that blobs written by previous
+// versions can still be read.
+constexpr uint8_t kCompressedBlobMagic[3] = {'A', 'N', 'Z'};
+
+struct CompressedBlobHeader
+{
+    uint8_t magic[3];
+    BlobCodec codec;
+    uint32_t uncompressedSize;
+    // CRC32 of the compressed data that follows.
+    uint32_t checksum;
+};
+
+bool IsCompressedBlobHeader(const uint8_t *compressedData, const size_t compressedSize)
+{
+    return compressedSize >= sizeof(CompressedBlobHeader) &&
+           memcmp(compressedData, kCompressedBlobMagic, sizeof(kCompressedBlobMagic)) == 0;
+}
+
+bool DeflateBlob(const size_t cacheSize, const uint8_t *cacheData, MemoryBuffer *compressedData)
 {
     uLong uncompressedSize       = static_cast<uLong>(cacheSize);
     uLong expectedCompressedSize = zlib_internal::GzipExpectedCompressedSize(uncompressedSize);
@@ -1084,10 +1107,41 @@ bool CompressBlob(const size_t cacheSize, const uint8_t *cacheData, MemoryBuffer
     return true;
 }
 
-bool DecompressBlob(const uint8_t *compressedData,
-                    const size_t compressedSize,
-                    size_t maxUncompressedDataSize,
-                    MemoryBuffer *uncompressedData)
+bool LZCompressBlob(const size_t cacheSize, const uint8_t *cacheData, MemoryBuffer *compressedData)
+{
+    if (cacheSize > std::numeric_limits<uint32_t>::max())
+    {
+        ERR() << "Cache data is too large to compress";
+        return false;
+    }
+
+    const size_t maxCompressedSize = sizeof(CompressedBlobHeader) + LZCompressBound(cacheSize);
+    if (!compressedData->clearAndReserve(maxCompressedSize))
+    {
+        ERR() << "Failed to allocate memory for compression";
+        return false;
+    }
+
+    uint8_t *payload         = compressedData->data() + sizeof(CompressedBlobHeader);
+    const size_t payloadSize = LZCompress(cacheData, cacheSize, payload,
+                                          maxCompressedSize - sizeof(CompressedBlobHeader));
+    ASSERT(payloadSize > 0);
+
+    CompressedBlobHeader header;
+    memcpy(header.magic, kCompressedBlobMagic, sizeof(kCompressedBlobMagic));
+    header.codec            = BlobCodec::LZ;
+    header.uncompressedSize = static_cast<uint32_t>(cacheSize);
+    header.checksum         = GenerateCRC32(payload, payloadSize);
+    memcpy(compressedData->data(), &header, sizeof(header));
+
+    compressedData->setSize(sizeof(CompressedBlobHeader) + payloadSize);
+    return true;
+}
+
+bool InflateBlob(const uint8_t *compressedData,
+                 const size_t compressedSize,
+                 size_t maxUncompressedDataSize,
+                 MemoryBuffer *uncompressedData)
 {
     // Call zlib function to decompress.
     uint32_t uncompressedSize =
@@ -1131,6 +1185,85 @@ bool DecompressBlob(const uint8_t *compressedData,
     return true;
 }
 
+bool LZDecompressBlob(const uint8_t *compressedData,
+                      const size_t compressedSize,
+                      size_t maxUncompressedDataSize,
+                      MemoryBuffer *uncompressedData)
+{
+    CompressedBlobHeader header;
+    memcpy(&header, compressedData, sizeof(header));
+
+    const uint8_t *payload   = compressedData + sizeof(CompressedBlobHeader);
+    const size_t payloadSize = compressedSize - sizeof(CompressedBlobHeader);
+    if (GenerateCRC32(payload, payloadSize) != header.checksum)
+    {
+        WARN() << "Failed to decompress data: checksum mismatch";
+        return false;
+    }
+
+    if (header.uncompressedSize > maxUncompressedDataSize)
+    {
+        ERR() << "Decompressed data size is larger than the maximum supported ("
+              << header.uncompressedSize << " vs " << maxUncompressedDataSize << ")";
+        return false;
+    }
+
+    if (!uncompressedData->clearAndReserve(header.uncompressedSize))
+    {
+        ERR() << "Failed to allocate memory for decompression";
+        return false;
+    }
+
+    if (!LZDecompress(payload, payloadSize, uncompressedData->data(), header.uncompressedSize))
+    {
+        WARN() << "Failed to decompress data: malformed data";
+        return false;
+    }
+
+    uncompressedData->setSize(header.uncompressedSize);
+    return true;
+}
+}  // anonymous namespace
+
+bool CompressBlob(const size_t cacheSize,
+                  const uint8_t *cacheData,
+                  BlobCodec codec,
+                  MemoryBuffer *compressedData)
+{
+    switch (codec)
+    {
+        case BlobCodec::Deflate:
+            return DeflateBlob(cacheSize, cacheData, compressedData);
+        case BlobCodec::LZ:
+            return LZCompressBlob(cacheSize, cacheData, compressedData);
+        default:
+            UNREACHABLE();
+            return false;
+    }
+}
+
+bool DecompressBlob(const uint8_t *compressedData,
+                    const size_t compressedSize,
+                    size_t maxUncompressedDataSize,
+                    MemoryBuffer *uncompressedData)
+{
+    if (!IsCompressedBlobHeader(compressedData, compressedSize))
+    {
+        return InflateBlob(compressedData, compressedSize, maxUncompressedDataSize,
+                           uncompressedData);
+    }
+
+    switch (compressedData[sizeof(kCompressedBlobMagic)])
+    {
+        case static_cast<uint8_t>(BlobCodec::LZ):
+            return LZDecompressBlob(compressedData, compressedSize, maxUncompressedDataSize,
+                                    uncompressedData);
+        default:
+            WARN() << "Failed to decompress data: unknown codec";
+            return false;
+    }
+}
+
 uint32_t GenerateCRC32(const uint8_t *data, size_t size)
 {
     return UpdateCRC32(InitCRC32(), data, size);
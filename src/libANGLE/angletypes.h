@@ -1313,7 +1313,18 @@ class BlobCacheValue  // To be replaced with std::span when C++20 is required
     size_t mSize;
 };
 
-bool CompressBlob(const size_t cacheSize, const uint8_t *cacheData, MemoryBuffer *compressedData);
+// Codecs to compress blobs with.  Deflate produces the smallest blobs, while LZ is several times
+// faster to decompress.  DecompressBlob detects the codec of the blob.
+enum class BlobCodec : uint8_t
+{
+    Deflate,
+    LZ,
+};
+
+bool CompressBlob(const size_t cacheSize,
+                  const uint8_t *cacheData,
+                  BlobCodec codec,
+                  MemoryBuffer *compressedData);
 bool DecompressBlob(const uint8_t *compressedData,
                     const size_t compressedSize,
                     size_t maxUncompressedDataSize,
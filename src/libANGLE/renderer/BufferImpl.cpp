@@ -8,9 +8,28 @@
 
 #include "libANGLE/renderer/BufferImpl.h"
 
+#include "libANGLE/formatutils.h"
+
 namespace rx
 {
 
+size_t GetAdjacentIndexRangeSpanCount(gl::DrawElementsType type,
+                                      const IndexRangeSpan *spans,
+                                      size_t spanCount)
+{
+    ASSERT(spanCount > 0);
+    const size_t typeBytes = gl::GetDrawElementsTypeSize(type);
+
+    size_t adjacentCount = 1;
+    while (adjacentCount < spanCount &&
+           spans[adjacentCount - 1].offset + spans[adjacentCount - 1].count * typeBytes ==
+               spans[adjacentCount].offset)
+    {
+        ++adjacentCount;
+    }
+    return adjacentCount;
+}
+
 angle::Result BufferImpl::getSubData(const gl::Context *context,
                                      GLintptr offset,
                                      GLsizeiptr size,
@@ -32,6 +51,21 @@ angle::Result BufferImpl::setDataWithUsageFlags(const gl::Context *context,
     return setData(context, target, data, size, usage);
 }
 
+angle::Result BufferImpl::getIndexRanges(const gl::Context *context,
+                                         gl::DrawElementsType type,
+                                         const IndexRangeSpan *spans,
+                                         size_t spanCount,
+                                         bool primitiveRestartEnabled,
+                                         gl::IndexRange *outRanges)
+{
+    for (size_t span = 0; span < spanCount; ++span)
+    {
+        ANGLE_TRY(getIndexRange(context, type, spans[span].offset, spans[span].count,
+                                primitiveRestartEnabled, &outRanges[span]));
+    }
+    return angle::Result::Continue;
+}
+
 angle::Result BufferImpl::onLabelUpdate(const gl::Context *context)
 {
     return angle::Result::Continue;
@@ -26,6 +26,19 @@ class Context;
 
 namespace rx
 {
+// |count| indices starting at byte |offset| of a buffer.
+struct IndexRangeSpan
+{
+    size_t offset;
+    size_t count;
+};
+
+// Returns how many of the spans starting with |spans[0]| follow each other without a gap, so that
+// they can be read from the buffer together.
+size_t GetAdjacentIndexRangeSpanCount(gl::DrawElementsType type,
+                                      const IndexRangeSpan *spans,
+                                      size_t spanCount);
+
 // We use two set of Subject messages. The CONTENTS_CHANGED message is signaled whenever data
 // changes, to trigger re-translation or other events. Some buffers only need to be updated when the
 // underlying driver object changes - this is notified via the STORAGE_CHANGED message.
@@ -74,6 +87,15 @@ class BufferImpl : public angle::Subject
                                         bool primitiveRestartEnabled,
                                         gl::IndexRange *outRange) = 0;
 
+    // Computes the index ranges of |spanCount| spans, sorted by offset.  Override to read the
+    // buffer once for all spans instead of once per span.
+    virtual angle::Result getIndexRanges(const gl::Context *context,
+                                         gl::DrawElementsType type,
+                                         const IndexRangeSpan *spans,
+                                         size_t spanCount,
+                                         bool primitiveRestartEnabled,
+                                         gl::IndexRange *outRanges);
+
     virtual angle::Result getSubData(const gl::Context *context,
                                      GLintptr offset,
                                      GLsizeiptr size,
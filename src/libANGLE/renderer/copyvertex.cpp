@@ -0,0 +1,561 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// copyvertex.cpp: SIMD kernels for the vertex buffer conversion functions in copyvertex.inc.h
+
+#include "libANGLE/renderer/copyvertex.h"
+
+#include "common/platform.h"
+#include "common/platform_helpers.h"
+
+#if defined(ANGLE_USE_SSE2)
+#    include <immintrin.h>
+#elif defined(ANGLE_USE_NEON)
+#    include <arm_neon.h>
+#endif
+
+namespace rx
+{
+
+namespace
+{
+template <VertexConversionInputType kType>
+struct VertexInputTraits;
+
+template <>
+struct VertexInputTraits<VertexConversionInputType::Byte>
+{
+    using Type = GLbyte;
+};
+
+template <>
+struct VertexInputTraits<VertexConversionInputType::UnsignedByte>
+{
+    using Type = GLubyte;
+};
+
+template <>
+struct VertexInputTraits<VertexConversionInputType::Short>
+{
+    using Type = GLshort;
+};
+
+template <>
+struct VertexInputTraits<VertexConversionInputType::UnsignedShort>
+{
+    using Type = GLushort;
+};
+
+template <>
+struct VertexInputTraits<VertexConversionInputType::Fixed>
+{
+    using Type = GLfixed;
+};
+
+#if defined(ANGLE_USE_SSE2) || defined(ANGLE_USE_NEON)
+// Each ISA below provides the same small set of helpers working on four components at a time:
+//
+// - LoadComponents<kType>: reads four components at |input| and converts them to float, without
+//   normalization.
+// - Splat, Multiply, Divide, Max: the float arithmetic needed to normalize the components.
+// - SetAlphaOne: replaces the fourth component, which is known to be zero, with 1.0.
+// - StoreFloats / StoreHalfs: writes the four components as 32-bit or 16-bit floats.  The 16-bit
+//   conversion is only exact for the integer values 8-bit input can produce, which is all it is
+//   used for.
+#    if defined(ANGLE_USE_SSE2)
+using FloatVector = __m128;
+
+template <VertexConversionInputType kType>
+FloatVector LoadComponents(const uint8_t *input);
+
+template <>
+FloatVector LoadComponents<VertexConversionInputType::Byte>(const uint8_t *input)
+{
+    int32_t bytes;
+    memcpy(&bytes, input, sizeof(bytes));
+    __m128i v = _mm_cvtsi32_si128(bytes);
+    v         = _mm_unpacklo_epi8(v, v);
+    v         = _mm_unpacklo_epi16(v, v);
+    return _mm_cvtepi32_ps(_mm_srai_epi32(v, 24));
+}
+
+template <>
+FloatVector LoadComponents<VertexConversionInputType::UnsignedByte>(const uint8_t *input)
+{
+    int32_t bytes;
+    memcpy(&bytes, input, sizeof(bytes));
+    const __m128i zero = _mm_setzero_si128();
+    __m128i v          = _mm_cvtsi32_si128(bytes);
+    v                  = _mm_unpacklo_epi8(v, zero);
+    v                  = _mm_unpacklo_epi16(v, zero);
+    return _mm_cvtepi32_ps(v);
+}
+
+template <>
+FloatVector LoadComponents<VertexConversionInputType::Short>(const uint8_t *input)
+{
+    __m128i v = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(input));
+    v         = _mm_unpacklo_epi16(v, v);
+    return _mm_cvtepi32_ps(_mm_srai_epi32(v, 16));
+}
+
+template <>
+FloatVector LoadComponents<VertexConversionInputType::UnsignedShort>(const uint8_t *input)
+{
+    __m128i v = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(input));
+    v         = _mm_unpacklo_epi16(v, _mm_setzero_si128());
+    return _mm_cvtepi32_ps(v);
+}
+
+template <>
+FloatVector LoadComponents<VertexConversionInputType::Fixed>(const uint8_t *input)
+{
+    return _mm_cvtepi32_ps(_mm_loadu_si128(reinterpret_cast<const __m128i *>(input)));
+}
+
+FloatVector Splat(float value)
+{
+    return _mm_set1_ps(value);
+}
+
+FloatVector Multiply(FloatVector a, FloatVector b)
+{
+    return _mm_mul_ps(a, b);
+}
+
+FloatVector Divide(FloatVector a, FloatVector b)
+{
+    return _mm_div_ps(a, b);
+}
+
+FloatVector Max(FloatVector a, FloatVector b)
+{
+    return _mm_max_ps(a, b);
+}
+
+FloatVector SetAlphaOne(FloatVector v)
+{
+    return _mm_or_ps(v, _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f));
+}
+
+void StoreFloats(FloatVector v, uint8_t *output)
+{
+    _mm_storeu_ps(reinterpret_cast<float *>(output), v);
+}
+
+void StoreHalfs(FloatVector v, uint8_t *output)
+{
+    // For normal values with no mantissa bits below the half precision, rebiasing the exponent is
+    // the whole conversion.  Zero is the only other value to handle.
+    const __m128i signMask  = _mm_set1_epi32(std::numeric_limits<int32_t>::min());
+    const __m128i bits      = _mm_castps_si128(v);
+    const __m128i sign      = _mm_srli_epi32(_mm_and_si128(bits, signMask), 16);
+    const __m128i magnitude = _mm_and_si128(bits, _mm_set1_epi32(0x7FFFFFFF));
+    const __m128i isZero    = _mm_cmpeq_epi32(magnitude, _mm_setzero_si128());
+
+    __m128i half = _mm_srli_epi32(_mm_sub_epi32(magnitude, _mm_set1_epi32(0x38000000)), 13);
+    half         = _mm_or_si128(_mm_andnot_si128(isZero, half), sign);
+
+    // Gather the low 16 bits of each lane into the low 64 bits.
+    half = _mm_shufflelo_epi16(half, _MM_SHUFFLE(3, 3, 2, 0));
+    half = _mm_shufflehi_epi16(half, _MM_SHUFFLE(3, 3, 2, 0));
+    half = _mm_shuffle_epi32(half, _MM_SHUFFLE(3, 3, 2, 0));
+    _mm_storel_epi64(reinterpret_cast<__m128i *>(output), half);
+}
+#    elif defined(ANGLE_USE_NEON)
+using FloatVector = float32x4_t;
+
+template <VertexConversionInputType kType>
+FloatVector LoadComponents(const uint8_t *input);
+
+template <>
+FloatVector LoadComponents<VertexConversionInputType::Byte>(const uint8_t *input)
+{
+    uint32_t bytes;
+    memcpy(&bytes, input, sizeof(bytes));
+    const int8x8_t v = vreinterpret_s8_u32(vdup_n_u32(bytes));
+    return vcvtq_f32_s32(vmovl_s16(vget_low_s16(vmovl_s8(v))));
+}
+
+template <>
+FloatVector LoadComponents<VertexConversionInputType::UnsignedByte>(const uint8_t *input)
+{
+    uint32_t bytes;
+    memcpy(&bytes, input, sizeof(bytes));
+    const uint8x8_t v = vreinterpret_u8_u32(vdup_n_u32(bytes));
+    return vcvtq_f32_u32(vmovl_u16(vget_low_u16(vmovl_u8(v))));
+}
+
+template <>
+FloatVector LoadComponents<VertexConversionInputType::Short>(const uint8_t *input)
+{
+    return vcvtq_f32_s32(vmovl_s16(vreinterpret_s16_u8(vld1_u8(input))));
+}
+
+template <>
+FloatVector LoadComponents<VertexConversionInputType::UnsignedShort>(const uint8_t *input)
+{
+    return vcvtq_f32_u32(vmovl_u16(vreinterpret_u16_u8(vld1_u8(input))));
+}
+
+template <>
+FloatVector LoadComponents<VertexConversionInputType::Fixed>(const uint8_t *input)
+{
+    return vcvtq_f32_s32(vreinterpretq_s32_u8(vld1q_u8(input)));
+}
+
+FloatVector Splat(float value)
+{
+    return vdupq_n_f32(value);
+}
+
+FloatVector Multiply(FloatVector a, FloatVector b)
+{
+    return vmulq_f32(a, b);
+}
+
+FloatVector Divide(FloatVector a, FloatVector b)
+{
+    return vdivq_f32(a, b);
+}
+
+FloatVector Max(FloatVector a, FloatVector b)
+{
+    return vmaxq_f32(a, b);
+}
+
+FloatVector SetAlphaOne(FloatVector v)
+{
+    return vsetq_lane_f32(1.0f, v, 3);
+}
+
+void StoreFloats(FloatVector v, uint8_t *output)
+{
+    vst1q_u8(output, vreinterpretq_u8_f32(v));
+}
+
+void StoreHalfs(FloatVector v, uint8_t *output)
+{
+    vst1_u8(output, vreinterpret_u8_f16(vcvt_f16_f32(v)));
+}
+#    endif  // defined(ANGLE_USE_SSE2)
+
+template <VertexConversionInputType kType, bool kNormalized>
+FloatVector LoadAndConvert(const uint8_t *input)
+{
+    using T = typename VertexInputTraits<kType>::Type;
+
+    FloatVector v = LoadComponents<kType>(input);
+    if (kType == VertexConversionInputType::Fixed)
+    {
+        v = Multiply(v, Splat(1.0f / (1 << 16)));
+    }
+    else if (kNormalized)
+    {
+        v = Divide(v, Splat(static_cast<float>(std::numeric_limits<T>::max())));
+        if (std::numeric_limits<T>::is_signed)
+        {
+            v = Max(v, Splat(-1.0f));
+        }
+    }
+    return v;
+}
+
+template <bool kToHalf>
+void Store(FloatVector v, uint8_t *output)
+{
+    if (kToHalf)
+    {
+        StoreHalfs(v, output);
+    }
+    else
+    {
+        StoreFloats(v, output);
+    }
+}
+
+// Converts the components of tightly packed vertices as one flat stream, starting at component
+// |first|.  Returns the number of components converted, which is a multiple of four.
+template <VertexConversionInputType kType, bool kNormalized, bool kToHalf>
+size_t CopyComponents(const uint8_t *input, size_t first, size_t componentCount, uint8_t *output)
+{
+    using T                      = typename VertexInputTraits<kType>::Type;
+    constexpr size_t kOutputSize = kToHalf ? sizeof(GLhalf) : sizeof(float);
+
+    size_t component = first;
+    for (; component + 4 <= componentCount; component += 4)
+    {
+        FloatVector v = LoadAndConvert<kType, kNormalized>(input + component * sizeof(T));
+        Store<kToHalf>(v, output + component * kOutputSize);
+    }
+    return component;
+}
+
+#    if defined(ANGLE_USE_SSE2)
+template <VertexConversionInputType kType>
+ANGLE_AVX2_TARGET __m256i LoadComponentsAVX2(const uint8_t *input);
+
+template <>
+ANGLE_AVX2_TARGET __m256i LoadComponentsAVX2<VertexConversionInputType::Byte>(const uint8_t *input)
+{
+    return _mm256_cvtepi8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(input)));
+}
+
+template <>
+ANGLE_AVX2_TARGET __m256i
+LoadComponentsAVX2<VertexConversionInputType::UnsignedByte>(const uint8_t *input)
+{
+    return _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(input)));
+}
+
+template <>
+ANGLE_AVX2_TARGET __m256i LoadComponentsAVX2<VertexConversionInputType::Short>(const uint8_t *input)
+{
+    return _mm256_cvtepi16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(input)));
+}
+
+template <>
+ANGLE_AVX2_TARGET __m256i
+LoadComponentsAVX2<VertexConversionInputType::UnsignedShort>(const uint8_t *input)
+{
+    return _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(input)));
+}
+
+template <>
+ANGLE_AVX2_TARGET __m256i LoadComponentsAVX2<VertexConversionInputType::Fixed>(const uint8_t *input)
+{
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(input));
+}
+
+// The AVX2 version of CopyComponents, eight components at a time.
+template <VertexConversionInputType kType, bool kNormalized, bool kToHalf>
+ANGLE_AVX2_TARGET size_t CopyComponentsAVX2(const uint8_t *input,
+                                            size_t componentCount,
+                                            uint8_t *output)
+{
+    using T                      = typename VertexInputTraits<kType>::Type;
+    constexpr size_t kOutputSize = kToHalf ? sizeof(GLhalf) : sizeof(float);
+
+    const __m256 fixedScale = _mm256_set1_ps(1.0f / (1 << 16));
+    const __m256 maxValue   = _mm256_set1_ps(static_cast<float>(std::numeric_limits<T>::max()));
+    const __m256 minusOne   = _mm256_set1_ps(-1.0f);
+    const __m256i signMask  = _mm256_set1_epi32(std::numeric_limits<int32_t>::min());
+
+    size_t component = 0;
+    for (; component + 8 <= componentCount; component += 8)
+    {
+        __m256 v = _mm256_cvtepi32_ps(LoadComponentsAVX2<kType>(input + component * sizeof(T)));
+        if (kType == VertexConversionInputType::Fixed)
+        {
+            v = _mm256_mul_ps(v, fixedScale);
+        }
+        else if (kNormalized)
+        {
+            v = _mm256_div_ps(v, maxValue);
+            if (std::numeric_limits<T>::is_signed)
+            {
+                v = _mm256_max_ps(v, minusOne);
+            }
+        }
+
+        uint8_t *dst = output + component * kOutputSize;
+        if (kToHalf)
+        {
+            // Same as StoreHalfs.  The half values fit in 16 bits, so the unsigned saturation of
+            // packus leaves them untouched.
+            const __m256i bits      = _mm256_castps_si256(v);
+            const __m256i signBit   = _mm256_and_si256(bits, signMask);
+            const __m256i magnitude = _mm256_and_si256(bits, _mm256_set1_epi32(0x7FFFFFFF));
+            const __m256i isZero    = _mm256_cmpeq_epi32(magnitude, _mm256_setzero_si256());
+
+            __m256i half = _mm256_sub_epi32(magnitude, _mm256_set1_epi32(0x38000000));
+            half         = _mm256_andnot_si256(isZero, _mm256_srli_epi32(half, 13));
+            half         = _mm256_or_si256(half, _mm256_srli_epi32(signBit, 16));
+            half         = _mm256_packus_epi32(half, _mm256_setzero_si256());
+            half         = _mm256_permute4x64_epi64(half, _MM_SHUFFLE(3, 1, 2, 0));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), _mm256_castsi256_si128(half));
+        }
+        else
+        {
+            _mm256_storeu_ps(reinterpret_cast<float *>(dst), v);
+        }
+    }
+    return component;
+}
+#    endif  // defined(ANGLE_USE_SSE2)
+
+template <VertexConversionInputType kType,
+          size_t kInputComponentCount,
+          bool kNormalized,
+          bool kToHalf>
+size_t CopyVertices(const uint8_t *input,
+                    size_t stride,
+                    size_t count,
+                    size_t outputComponentCount,
+                    uint8_t *output)
+{
+    using T                      = typename VertexInputTraits<kType>::Type;
+    constexpr size_t kInputSize  = kInputComponentCount * sizeof(T);
+    constexpr size_t kOutputSize = kToHalf ? sizeof(GLhalf) : sizeof(float);
+
+    if (stride == kInputSize && outputComponentCount == kInputComponentCount)
+    {
+        // Tightly packed vertices without padding are converted as one stream of components.  The
+        // components of the last, partially converted vertex are converted again by the caller.
+        const size_t componentCount = count * kInputComponentCount;
+        size_t converted            = 0;
+#    if defined(ANGLE_USE_SSE2)
+        if (angle::SupportsAVX2())
+        {
+            converted = CopyComponentsAVX2<kType, kNormalized, kToHalf>(input, componentCount,
+                                                                        output);
+        }
+#    endif
+        converted =
+            CopyComponents<kType, kNormalized, kToHalf>(input, converted, componentCount, output);
+        return converted / kInputComponentCount;
+    }
+
+    // Otherwise convert one vertex per vector.  The vertex is copied out first so that the loads
+    // never read past its last component, which leaves the padding components zero.
+    const bool setAlpha = kInputComponentCount < 4 && outputComponentCount == 4;
+    for (size_t i = 0; i < count; ++i)
+    {
+        T components[4] = {};
+        memcpy(components, input + i * stride, kInputSize);
+
+        FloatVector v =
+            LoadAndConvert<kType, kNormalized>(reinterpret_cast<const uint8_t *>(components));
+        if (setAlpha)
+        {
+            v = SetAlphaOne(v);
+        }
+
+        uint8_t *dst = output + i * outputComponentCount * kOutputSize;
+        if (outputComponentCount == 4)
+        {
+            Store<kToHalf>(v, dst);
+        }
+        else
+        {
+            uint8_t converted[4 * kOutputSize];
+            Store<kToHalf>(v, converted);
+            memcpy(dst, converted, outputComponentCount * kOutputSize);
+        }
+    }
+    return count;
+}
+
+template <VertexConversionInputType kType, bool kNormalized, bool kToHalf>
+size_t CopyVerticesWithComponentCount(size_t inputComponentCount,
+                                      size_t outputComponentCount,
+                                      const uint8_t *input,
+                                      size_t stride,
+                                      size_t count,
+                                      uint8_t *output)
+{
+    switch (inputComponentCount)
+    {
+        case 1:
+            return CopyVertices<kType, 1, kNormalized, kToHalf>(input, stride, count,
+                                                                outputComponentCount, output);
+        case 2:
+            return CopyVertices<kType, 2, kNormalized, kToHalf>(input, stride, count,
+                                                                outputComponentCount, output);
+        case 3:
+            return CopyVertices<kType, 3, kNormalized, kToHalf>(input, stride, count,
+                                                                outputComponentCount, output);
+        case 4:
+            return CopyVertices<kType, 4, kNormalized, kToHalf>(input, stride, count,
+                                                                outputComponentCount, output);
+        default:
+            return 0;
+    }
+}
+
+template <VertexConversionInputType kType>
+size_t CopyVerticesWithInputType(bool normalized,
+                                 bool toHalf,
+                                 size_t inputComponentCount,
+                                 size_t outputComponentCount,
+                                 const uint8_t *input,
+                                 size_t stride,
+                                 size_t count,
+                                 uint8_t *output)
+{
+    using T = typename VertexInputTraits<kType>::Type;
+
+    // Half float output is only exact for unnormalized 8-bit input.  Fixed point input is never
+    // normalized.  The template arguments below avoid instantiating the unsupported kernels.
+    constexpr bool kSupportsHalf       = sizeof(T) == 1;
+    constexpr bool kSupportsNormalized = kType != VertexConversionInputType::Fixed;
+    if (toHalf)
+    {
+        return kSupportsHalf && !normalized
+                   ? CopyVerticesWithComponentCount<kType, false, kSupportsHalf>(
+                         inputComponentCount, outputComponentCount, input, stride, count, output)
+                   : 0;
+    }
+    if (normalized)
+    {
+        return kSupportsNormalized
+                   ? CopyVerticesWithComponentCount<kType, kSupportsNormalized, false>(
+                         inputComponentCount, outputComponentCount, input, stride, count, output)
+                   : 0;
+    }
+    return CopyVerticesWithComponentCount<kType, false, false>(
+        inputComponentCount, outputComponentCount, input, stride, count, output);
+}
+#endif  // defined(ANGLE_USE_SSE2) || defined(ANGLE_USE_NEON)
+}  // anonymous namespace
+
+size_t CopyToFloatVertexDataSIMD(VertexConversionInputType inputType,
+                                 bool normalized,
+                                 bool toHalf,
+                                 size_t inputComponentCount,
+                                 size_t outputComponentCount,
+                                 const uint8_t *input,
+                                 size_t stride,
+                                 size_t count,
+                                 uint8_t *output)
+{
+#if defined(ANGLE_USE_SSE2) || defined(ANGLE_USE_NEON)
+    if (outputComponentCount < inputComponentCount || outputComponentCount > 4)
+    {
+        return 0;
+    }
+
+    switch (inputType)
+    {
+        case VertexConversionInputType::Byte:
+            return CopyVerticesWithInputType<VertexConversionInputType::Byte>(
+                normalized, toHalf, inputComponentCount, outputComponentCount, input, stride,
+                count, output);
+        case VertexConversionInputType::UnsignedByte:
+            return CopyVerticesWithInputType<VertexConversionInputType::UnsignedByte>(
+                normalized, toHalf, inputComponentCount, outputComponentCount, input, stride,
+                count, output);
+        case VertexConversionInputType::Short:
+            return CopyVerticesWithInputType<VertexConversionInputType::Short>(
+                normalized, toHalf, inputComponentCount, outputComponentCount, input, stride,
+                count, output);
+        case VertexConversionInputType::UnsignedShort:
+            return CopyVerticesWithInputType<VertexConversionInputType::UnsignedShort>(
+                normalized, toHalf, inputComponentCount, outputComponentCount, input, stride,
+                count, output);
+        case VertexConversionInputType::Fixed:
+            return CopyVerticesWithInputType<VertexConversionInputType::Fixed>(
+                normalized, toHalf, inputComponentCount, outputComponentCount, input, stride,
+                count, output);
+        default:
+            return 0;
+    }
+#else
+    return 0;
+#endif  // defined(ANGLE_USE_SSE2) || defined(ANGLE_USE_NEON)
+}
+
+}  // namespace rx
@@ -9,6 +9,7 @@
 #ifndef LIBANGLE_RENDERER_COPYVERTEX_H_
 #define LIBANGLE_RENDERER_COPYVERTEX_H_
 
+#include "angle_gl.h"
 #include "common/mathutil.h"
 
 namespace rx
@@ -19,6 +20,62 @@ using VertexCopyFunction = void (*)(const uint8_t *input,
                                     size_t count,
                                     uint8_t *output);
 
+// Input component types that have SIMD conversion kernels.
+enum class VertexConversionInputType
+{
+    Byte,
+    UnsignedByte,
+    Short,
+    UnsignedShort,
+    Fixed,
+
+    InvalidEnum,
+};
+
+template <typename T>
+struct VertexConversionInputTypeOf
+{
+    static constexpr VertexConversionInputType value = VertexConversionInputType::InvalidEnum;
+};
+
+template <>
+struct VertexConversionInputTypeOf<GLbyte>
+{
+    static constexpr VertexConversionInputType value = VertexConversionInputType::Byte;
+};
+
+template <>
+struct VertexConversionInputTypeOf<GLubyte>
+{
+    static constexpr VertexConversionInputType value = VertexConversionInputType::UnsignedByte;
+};
+
+template <>
+struct VertexConversionInputTypeOf<GLshort>
+{
+    static constexpr VertexConversionInputType value = VertexConversionInputType::Short;
+};
+
+template <>
+struct VertexConversionInputTypeOf<GLushort>
+{
+    static constexpr VertexConversionInputType value = VertexConversionInputType::UnsignedShort;
+};
+
+// Converts the leading vertices of |input| to 32-bit float (or 16-bit float for 8-bit integer
+// input) with the CPU's SIMD units, padding the missing components like CopyToFloatVertexData.
+// Returns the number of vertices converted, which is 0 if the conversion has no SIMD kernel.  The
+// callers convert the remaining vertices with their scalar loops.
+size_t CopyToFloatVertexDataSIMD(VertexConversionInputType inputType,
+                                 bool normalized,
+                                 bool toHalf,
+                                 size_t inputComponentCount,
+                                 size_t outputComponentCount,
+                                 const uint8_t *input,
+                                 size_t stride,
+                                 size_t count,
+                                 uint8_t *output);
+
 // 'alphaDefaultValueBits' gives the default value for the alpha channel (4th component)
 template <typename T,
           size_t inputComponentCount,
@@ -193,6 +193,13 @@ inline void Copy32FixedTo32FVertexData(const uint8_t *input,
 {
     static const float divisor = 1.0f / (1 << 16);
 
+    const size_t converted = CopyToFloatVertexDataSIMD(
+        VertexConversionInputType::Fixed, false, false, inputComponentCount, outputComponentCount,
+        input, stride, count, output);
+    input += converted * stride;
+    output += converted * outputComponentCount * sizeof(float);
+    count -= converted;
+
     for (size_t i = 0; i < count; i++)
     {
         const uint8_t *offsetInput = input + i * stride;
@@ -242,6 +249,17 @@ inline void CopyToFloatVertexData(const uint8_t *input,
     typedef std::numeric_limits<T> NL;
     typedef typename std::conditional<toHalf, GLhalf, float>::type outputType;
 
+    constexpr VertexConversionInputType kSIMDInputType = VertexConversionInputTypeOf<T>::value;
+    if (kSIMDInputType != VertexConversionInputType::InvalidEnum)
+    {
+        const size_t converted =
+            CopyToFloatVertexDataSIMD(kSIMDInputType, normalized, toHalf, inputComponentCount,
+                                      outputComponentCount, input, stride, count, output);
+        input += converted * stride;
+        output += converted * outputComponentCount * sizeof(outputType);
+        count -= converted;
+    }
+
     for (size_t i = 0; i < count; i++)
     {
         const T *offsetInput = reinterpret_cast<const T *>(input + (stride * i));
@@ -0,0 +1,174 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// copyvertex_unittest:
+//   Unit tests for the vertex conversion functions, checking that the SIMD kernels produce the
+//   same results as the scalar conversion.
+//
+
+#include <gtest/gtest.h>
+
+#include "libANGLE/renderer/copyvertex.h"
+
+#include <vector>
+
+namespace rx
+{
+namespace
+{
+template <typename T>
+T GetTestValue(size_t index)
+{
+    // Cover the full range of the type, including the extremes.
+    constexpr int64_t kMin   = std::numeric_limits<T>::min();
+    constexpr int64_t kRange = static_cast<int64_t>(std::numeric_limits<T>::max()) - kMin + 1;
+    return static_cast<T>(kMin + static_cast<int64_t>(index * 7919) % kRange);
+}
+
+// Reference conversion of a single component, matching the scalar CopyToFloatVertexData loop.
+template <typename T, bool normalized>
+float ConvertReference(T value)
+{
+    float result = static_cast<float>(value);
+    if (normalized)
+    {
+        result /= static_cast<float>(std::numeric_limits<T>::max());
+        result = result >= -1.0f ? result : -1.0f;
+    }
+    return result;
+}
+
+template <typename T, size_t inputComponentCount, size_t outputComponentCount, bool normalized>
+void TestCopyToFloat(size_t stride, size_t count)
+{
+    // Offset the input by one byte to exercise unaligned loads.
+    std::vector<uint8_t> input(stride * count + 1);
+    for (size_t i = 0; i < count; ++i)
+    {
+        for (size_t j = 0; j < inputComponentCount; ++j)
+        {
+            T value = GetTestValue<T>(i * inputComponentCount + j);
+            memcpy(input.data() + 1 + i * stride + j * sizeof(T), &value, sizeof(T));
+        }
+    }
+
+    std::vector<float> output(count * outputComponentCount);
+    CopyToFloatVertexData<T, inputComponentCount, outputComponentCount, normalized, false>(
+        input.data() + 1, stride, count, reinterpret_cast<uint8_t *>(output.data()));
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        for (size_t j = 0; j < outputComponentCount; ++j)
+        {
+            float expected = j == 3 ? 1.0f : 0.0f;
+            if (j < inputComponentCount)
+            {
+                T value  = GetTestValue<T>(i * inputComponentCount + j);
+                expected = ConvertReference<T, normalized>(value);
+            }
+            ASSERT_EQ(expected, output[i * outputComponentCount + j])
+                << "vertex " << i << " component " << j;
+        }
+    }
+}
+
+template <typename T, size_t inputComponentCount, size_t outputComponentCount>
+void TestCopyToHalf(size_t stride, size_t count)
+{
+    std::vector<uint8_t> input(stride * count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        for (size_t j = 0; j < inputComponentCount; ++j)
+        {
+            T value = GetTestValue<T>(i * inputComponentCount + j);
+            memcpy(input.data() + i * stride + j * sizeof(T), &value, sizeof(T));
+        }
+    }
+
+    std::vector<GLhalf> output(count * outputComponentCount);
+    CopyToFloatVertexData<T, inputComponentCount, outputComponentCount, false, true>(
+        input.data(), stride, count, reinterpret_cast<uint8_t *>(output.data()));
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        for (size_t j = 0; j < outputComponentCount; ++j)
+        {
+            float expected = j == 3 ? 1.0f : 0.0f;
+            if (j < inputComponentCount)
+            {
+                expected = static_cast<float>(GetTestValue<T>(i * inputComponentCount + j));
+            }
+            ASSERT_EQ(gl::float32ToFloat16(expected), output[i * outputComponentCount + j])
+                << "vertex " << i << " component " << j;
+        }
+    }
+}
+
+// Counts that cover the SIMD loops and their tails.
+constexpr size_t kCounts[] = {1, 3, 8, 37};
+
+// Test normalized and unnormalized conversion of tightly packed vertices.
+TEST(CopyVertexTest, PackedToFloat)
+{
+    for (size_t count : kCounts)
+    {
+        TestCopyToFloat<GLbyte, 1, 1, true>(1, count);
+        TestCopyToFloat<GLubyte, 2, 2, true>(2, count);
+        TestCopyToFloat<GLshort, 3, 3, true>(6, count);
+        TestCopyToFloat<GLushort, 4, 4, true>(8, count);
+        TestCopyToFloat<GLshort, 2, 2, false>(4, count);
+        TestCopyToFloat<GLushort, 3, 3, false>(6, count);
+    }
+}
+
+// Test conversion of interleaved vertices, and padding of three component vertices to four.
+TEST(CopyVertexTest, StridedToFloat)
+{
+    for (size_t count : kCounts)
+    {
+        TestCopyToFloat<GLbyte, 3, 4, true>(7, count);
+        TestCopyToFloat<GLubyte, 2, 2, true>(16, count);
+        TestCopyToFloat<GLshort, 3, 4, true>(12, count);
+        TestCopyToFloat<GLushort, 1, 1, false>(6, count);
+        TestCopyToFloat<GLshort, 4, 4, false>(20, count);
+    }
+}
+
+// Test conversion of 8-bit integers to half floats.
+TEST(CopyVertexTest, ToHalf)
+{
+    for (size_t count : kCounts)
+    {
+        TestCopyToHalf<GLbyte, 1, 1>(1, count);
+        TestCopyToHalf<GLubyte, 2, 2>(2, count);
+        TestCopyToHalf<GLbyte, 3, 3>(3, count);
+        TestCopyToHalf<GLubyte, 3, 4>(3, count);
+        TestCopyToHalf<GLbyte, 4, 4>(12, count);
+    }
+}
+
+// Test conversion of fixed point values.
+TEST(CopyVertexTest, FixedToFloat)
+{
+    for (size_t count : kCounts)
+    {
+        std::vector<GLfixed> input(count * 3);
+        for (size_t i = 0; i < input.size(); ++i)
+        {
+            input[i] = GetTestValue<GLfixed>(i);
+        }
+
+        std::vector<float> output(count * 3);
+        Copy32FixedTo32FVertexData<3, 3>(reinterpret_cast<const uint8_t *>(input.data()),
+                                         3 * sizeof(GLfixed), count,
+                                         reinterpret_cast<uint8_t *>(output.data()));
+        for (size_t i = 0; i < input.size(); ++i)
+        {
+            ASSERT_EQ(static_cast<float>(input[i]) * (1.0f / (1 << 16)), output[i]);
+        }
+    }
+}
+}  // anonymous namespace
+}  // namespace rx
@@ -329,6 +329,74 @@ angle::Result BufferGL::getIndexRange(const gl::Context *context,
     return angle::Result::Continue;
 }
 
+angle::Result BufferGL::getIndexRanges(const gl::Context *context,
+                                       gl::DrawElementsType type,
+                                       const IndexRangeSpan *spans,
+                                       size_t spanCount,
+                                       bool primitiveRestartEnabled,
+                                       gl::IndexRange *outRanges)
+{
+    ContextGL *contextGL         = GetImplAs<ContextGL>(context);
+    const FunctionsGL *functions = GetFunctionsGL(context);
+    StateManagerGL *stateManager = GetStateManagerGL(context);
+
+    ASSERT(!mIsMapped);
+    ASSERT(spanCount > 0);
+
+    if (mShadowCopy.has_value())
+    {
+        for (size_t span = 0; span < spanCount; ++span)
+        {
+            outRanges[span] =
+                gl::ComputeIndexRange(type, mShadowCopy->data() + spans[span].offset,
+                                      spans[span].count, primitiveRestartEnabled);
+        }
+    }
+    else
+    {
+        stateManager->bindBuffer(DestBufferOperationTarget, mBufferID);
+
+        // Map once for every run of adjacent spans, so that the bytes between the spans are not
+        // read.
+        const GLuint typeBytes = gl::GetDrawElementsTypeSize(type);
+        for (size_t firstSpan = 0; firstSpan < spanCount;)
+        {
+            const size_t runCount =
+                GetAdjacentIndexRangeSpanCount(type, spans + firstSpan, spanCount - firstSpan);
+            const IndexRangeSpan &lastSpan = spans[firstSpan + runCount - 1];
+            const size_t mapOffset         = spans[firstSpan].offset;
+            const size_t mapSize = lastSpan.offset + lastSpan.count * typeBytes - mapOffset;
+
+            const uint8_t *bufferData =
+                MapBufferRangeWithFallback(functions, gl::ToGLenum(DestBufferOperationTarget),
+                                           mapOffset, mapSize, GL_MAP_READ_BIT);
+            if (bufferData)
+            {
+                for (size_t span = firstSpan; span < firstSpan + runCount; ++span)
+                {
+                    outRanges[span] =
+                        gl::ComputeIndexRange(type, bufferData + (spans[span].offset - mapOffset),
+                                              spans[span].count, primitiveRestartEnabled);
+                }
+                ANGLE_GL_TRY(context,
+                             functions->unmapBuffer(gl::ToGLenum(DestBufferOperationTarget)));
+            }
+            else
+            {
+                // Workaround the null driver not having map support.
+                std::fill(outRanges + firstSpan, outRanges + firstSpan + runCount,
+                          gl::IndexRange(0, 0));
+            }
+
+            firstSpan += runCount;
+        }
+    }
+
+    contextGL->markWorkSubmitted();
+
+    return angle::Result::Continue;
+}
+
 size_t BufferGL::getBufferSize() const
 {
     return mBufferSize;
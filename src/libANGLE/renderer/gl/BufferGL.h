@@ -57,6 +57,12 @@ class BufferGL : public BufferImpl
                                 size_t count,
                                 bool primitiveRestartEnabled,
                                 gl::IndexRange *outRange) override;
+    angle::Result getIndexRanges(const gl::Context *context,
+                                 gl::DrawElementsType type,
+                                 const IndexRangeSpan *spans,
+                                 size_t spanCount,
+                                 bool primitiveRestartEnabled,
+                                 gl::IndexRange *outRanges) override;
 
     size_t getBufferSize() const;
     GLuint getBufferID() const;
@@ -960,6 +960,52 @@ angle::Result BufferVk::getIndexRange(const gl::Context *context,
     return angle::Result::Continue;
 }
 
+angle::Result BufferVk::getIndexRanges(const gl::Context *context,
+                                       gl::DrawElementsType type,
+                                       const IndexRangeSpan *spans,
+                                       size_t spanCount,
+                                       bool primitiveRestartEnabled,
+                                       gl::IndexRange *outRanges)
+{
+    ContextVk *contextVk   = vk::GetImpl(context);
+    vk::Renderer *renderer = contextVk->getRenderer();
+
+    if (renderer->isMockICDEnabled())
+    {
+        std::fill(outRanges, outRanges + spanCount, gl::IndexRange());
+        return angle::Result::Continue;
+    }
+
+    ANGLE_TRACE_EVENT0("gpu.angle", "BufferVk::getIndexRanges");
+
+    // Map once for every run of adjacent spans.  The bytes between the spans are not read, which
+    // matters for device-local buffers as each map stages the mapped range.
+    const size_t typeBytes = gl::GetDrawElementsTypeSize(type);
+    for (size_t firstSpan = 0; firstSpan < spanCount;)
+    {
+        const size_t runCount =
+            GetAdjacentIndexRangeSpanCount(type, spans + firstSpan, spanCount - firstSpan);
+        const IndexRangeSpan &lastSpan = spans[firstSpan + runCount - 1];
+        const size_t mapOffset         = spans[firstSpan].offset;
+        const size_t mapSize = lastSpan.offset + lastSpan.count * typeBytes - mapOffset;
+
+        void *mapPtr;
+        ANGLE_TRY(mapRangeImpl(contextVk, mapOffset, mapSize, GL_MAP_READ_BIT, &mapPtr));
+        const uint8_t *mapData = static_cast<const uint8_t *>(mapPtr);
+        for (size_t span = firstSpan; span < firstSpan + runCount; ++span)
+        {
+            outRanges[span] =
+                gl::ComputeIndexRange(type, mapData + (spans[span].offset - mapOffset),
+                                      spans[span].count, primitiveRestartEnabled);
+        }
+        ANGLE_TRY(unmapImpl(contextVk));
+
+        firstSpan += runCount;
+    }
+
+    return angle::Result::Continue;
+}
+
 angle::Result BufferVk::updateBuffer(ContextVk *contextVk,
                                      size_t bufferSize,
                                      const BufferDataSource &dataSource,
@@ -196,6 +196,12 @@ class BufferVk : public BufferImpl
                                 size_t count,
                                 bool primitiveRestartEnabled,
                                 gl::IndexRange *outRange) override;
+    angle::Result getIndexRanges(const gl::Context *context,
+                                 gl::DrawElementsType type,
+                                 const IndexRangeSpan *spans,
+                                 size_t spanCount,
+                                 bool primitiveRestartEnabled,
+                                 gl::IndexRange *outRanges) override;
 
     GLint64 getSize() const { return mState.getSize(); }
 
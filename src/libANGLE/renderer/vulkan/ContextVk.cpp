@@ -784,6 +784,35 @@ void GenerateTextureUnitSamplerIndexMap(
             {samplerBoundTextureUnits[samplerIndex], static_cast<uint32_t>(samplerIndex)});
     }
 }
+
+// Returns the number of indices that make up each primitive of a list topology, or 0 for the other
+// topologies.
+uint32_t GetListPrimitiveIndexCount(gl::PrimitiveMode mode)
+{
+    switch (mode)
+    {
+        case gl::PrimitiveMode::Points:
+            return 1;
+        case gl::PrimitiveMode::Lines:
+            return 2;
+        case gl::PrimitiveMode::Triangles:
+            return 3;
+        default:
+            return 0;
+    }
+}
+
+bool ReadsPrimitiveID(const std::vector<sh::ShaderVariable> &inputVaryings)
+{
+    for (const sh::ShaderVariable &varying : inputVaryings)
+    {
+        if (varying.isBuiltIn() && varying.name == "gl_PrimitiveID")
+        {
+            return true;
+        }
+    }
+    return false;
+}
 }  // anonymous namespace
 
 void ContextVk::flushDescriptorSetUpdates()
@@ -834,6 +863,7 @@ ContextVk::ContextVk(const gl::State &state, gl::ErrorSet *errorSet, vk::Rendere
       mCurrentIndexBuffer(nullptr),
       mCurrentIndexBufferOffset(0),
       mCurrentDrawElementsType(gl::DrawElementsType::InvalidEnum),
+      mCanCoalesceDrawsWithProgram(false),
       mXfbBaseVertex(0),
       mXfbVertexCountPerInstance(0),
       mClearColorValue{},
@@ -1637,15 +1667,65 @@ angle::Result ContextVk::setupDraw(const gl::Context *context,
     return angle::Result::Continue;
 }
 
+bool ContextVk::canOffsetIntoBoundIndexBuffer(const VertexArrayVk *vertexArrayVk,
+                                              gl::DrawElementsType indexType,
+                                              const void *indices,
+                                              uint32_t *firstIndexOut) const
+{
+    // The bound index buffer can only be reused if it is the element array buffer itself (and not
+    // a converted or line loop copy of it), and it's not about to be rebound anyway.
+    if (!getFeatures().coalesceConsecutiveIndexedDraws.enabled ||
+        mGraphicsDirtyBits[DIRTY_BIT_INDEX_BUFFER] ||
+        mLastIndexBufferOffset == reinterpret_cast<const void *>(angle::DirtyPointer) ||
+        mCurrentIndexBuffer != vertexArrayVk->getCurrentElementArrayBuffer() ||
+        shouldConvertUint8VkIndexType(indexType))
+    {
+        return false;
+    }
+
+    const VkDeviceSize offset = reinterpret_cast<VkDeviceSize>(indices);
+    if (offset < mCurrentIndexBufferOffset)
+    {
+        return false;
+    }
+
+    const VkDeviceSize offsetFromBinding = offset - mCurrentIndexBufferOffset;
+    const VkDeviceSize firstIndex = offsetFromBinding >> gl::GetDrawElementsTypeShift(indexType);
+    if ((firstIndex << gl::GetDrawElementsTypeShift(indexType)) != offsetFromBinding ||
+        firstIndex > std::numeric_limits<uint32_t>::max())
+    {
+        return false;
+    }
+
+    *firstIndexOut = static_cast<uint32_t>(firstIndex);
+    return true;
+}
+
+bool ContextVk::canCoalesceIndexedDraw(gl::PrimitiveMode mode) const
+{
+    // Only list topologies can be merged, and only if the previous draw consists of whole
+    // primitives (which SecondaryCommandBuffer::extendLastDrawIndexed verifies).  Primitive
+    // restart could end a primitive in the middle of the merged range.  Transform feedback is left
+    // alone.
+    return mCanCoalesceDrawsWithProgram && GetListPrimitiveIndexCount(mode) != 0 &&
+           !mState.isPrimitiveRestartEnabled() && !mState.isTransformFeedbackActiveUnpaused();
+}
+
 angle::Result ContextVk::setupIndexedDraw(const gl::Context *context,
                                           gl::PrimitiveMode mode,
                                           GLsizei indexCount,
                                           GLsizei instanceCount,
                                           gl::DrawElementsType indexType,
-                                          const void *indices)
+                                          const void *indices,
+                                          uint32_t *firstIndexOut)
 {
     ASSERT(mode != gl::PrimitiveMode::LineLoop);
 
+    if (firstIndexOut != nullptr)
+    {
+        *firstIndexOut = 0;
+    }
+
     if (indexType != mCurrentDrawElementsType)
     {
         mCurrentDrawElementsType = indexType;
@@ -1667,6 +1747,14 @@ angle::Result ContextVk::setupIndexedDraw(const gl::Context *context,
             mGraphicsDirtyBits.set(DIRTY_BIT_INDEX_BUFFER);
         }
     }
+    else if (indices != mLastIndexBufferOffset && firstIndexOut != nullptr &&
+             canOffsetIntoBoundIndexBuffer(vertexArrayVk, indexType, indices, firstIndexOut))
+    {
+        // The element array buffer is already bound at a lower offset.  Instead of binding it
+        // again, the draw call selects its indices with firstIndex.  This avoids a command between
+        // the draw calls, which lets consecutive draws be coalesced.
+        ASSERT(!mGraphicsDirtyBits[DIRTY_BIT_INDEX_BUFFER]);
+    }
     else
     {
         mCurrentIndexBufferOffset = reinterpret_cast<VkDeviceSize>(indices);
@@ -3517,6 +3605,12 @@ void ContextVk::syncObjectPerfCounters(const angle::VulkanPerfCounters &commandQ
         }
     }
 
+    // Index range caches of the front-end buffers.
+    const gl::IndexRangeCacheStats &indexRangeCacheStats = mState.getIndexRangeCacheStats();
+    mPerfCounters.indexRangeCacheHits                    = indexRangeCacheStats.hits;
+    mPerfCounters.indexRangeCacheMisses                  = indexRangeCacheStats.misses;
+    mPerfCounters.indexRangeCacheEvictions               = indexRangeCacheStats.evictions;
+
     // Update perf counters from the renderer as well
     mPerfCounters.commandQueueSubmitCallsTotal =
         commandQueuePerfCounters.commandQueueSubmitCallsTotal;
@@ -3557,6 +3651,13 @@ void ContextVk::updateOverlayOnPresent()
         writeDescriptorSetCount->next();
     }
 
+    {
+        gl::RunningGraphWidget *coalescedDrawCount =
+            overlay->getRunningGraphWidget(gl::WidgetId::VulkanCoalescedDrawCount);
+        coalescedDrawCount->add(mPerfCounters.coalescedDraws);
+        coalescedDrawCount->next();
+    }
+
     {
         gl::RunningGraphWidget *descriptorSetAllocationCount =
             overlay->getRunningGraphWidget(gl::WidgetId::VulkanDescriptorSetAllocations);
@@ -4173,8 +4274,23 @@ angle::Result ContextVk::drawElements(const gl::Context *context,
     }
     else
     {
-        ANGLE_TRY(setupIndexedDraw(context, mode, count, 1, type, indices));
-        mRenderPassCommandBuffer->drawIndexed(count);
+        uint32_t firstIndex = 0;
+        ANGLE_TRY(setupIndexedDraw(context, mode, count, 1, type, indices, &firstIndex));
+        if (firstIndex == 0)
+        {
+            mRenderPassCommandBuffer->drawIndexed(count);
+        }
+        else if (canCoalesceIndexedDraw(mode) &&
+                 mRenderPassCommandBuffer->extendLastDrawIndexed(
+                     firstIndex, count, GetListPrimitiveIndexCount(mode)))
+        {
+            mPerfCounters.coalescedDraws++;
+        }
+        else
+        {
+            mRenderPassCommandBuffer->drawIndexedInstancedBaseVertexBaseInstance(count, 1,
+                                                                                 firstIndex, 0, 0);
+        }
     }
 
     return angle::Result::Continue;
@@ -4195,7 +4311,7 @@ angle::Result ContextVk::drawElementsBaseVertex(const gl::Context *context,
     }
     else
     {
-        ANGLE_TRY(setupIndexedDraw(context, mode, count, 1, type, indices));
+        ANGLE_TRY(setupIndexedDraw(context, mode, count, 1, type, indices, nullptr));
         mRenderPassCommandBuffer->drawIndexedBaseVertex(count, baseVertex);
     }
 
@@ -4217,7 +4333,7 @@ angle::Result ContextVk::drawElementsInstanced(const gl::Context *context,
     }
     else
     {
-        ANGLE_TRY(setupIndexedDraw(context, mode, count, instances, type, indices));
+        ANGLE_TRY(setupIndexedDraw(context, mode, count, instances, type, indices, nullptr));
     }
 
     mRenderPassCommandBuffer->drawIndexedInstanced(count, instances);
@@ -4240,7 +4356,7 @@ angle::Result ContextVk::drawElementsInstancedBaseVertex(const gl::Context *cont
     }
     else
     {
-        ANGLE_TRY(setupIndexedDraw(context, mode, count, instances, type, indices));
+        ANGLE_TRY(setupIndexedDraw(context, mode, count, instances, type, indices, nullptr));
     }
 
     mRenderPassCommandBuffer->drawIndexedInstancedBaseVertex(count, instances, baseVertex);
@@ -4264,7 +4380,7 @@ angle::Result ContextVk::drawElementsInstancedBaseVertexBaseInstance(const gl::C
     }
     else
     {
-        ANGLE_TRY(setupIndexedDraw(context, mode, count, instances, type, indices));
+        ANGLE_TRY(setupIndexedDraw(context, mode, count, instances, type, indices, nullptr));
     }
 
     mRenderPassCommandBuffer->drawIndexedInstancedBaseVertexBaseInstance(count, instances, 0,
@@ -5411,6 +5527,10 @@ angle::Result ContextVk::invalidateProgramExecutableHelper(const gl::Context *co
         // later.
         invalidateDefaultAttributes(context->getStateCache().getActiveDefaultAttribsMask());
         invalidateVertexAndIndexBuffers();
+        mCanCoalesceDrawsWithProgram =
+            !executable->hasLinkedShaderStage(gl::ShaderType::Geometry) &&
+            !executable->hasLinkedTessellationShader() &&
+            !ReadsPrimitiveID(executable->getLinkedInputVaryings(gl::ShaderType::Fragment));
         // If VK_EXT_vertex_input_dynamic_state is enabled then vkCmdSetVertexInputEXT must be
         // called in the current command buffer prior to the draw command, even if there are no
         // active vertex attributes.
@@ -9222,6 +9342,7 @@ void ContextVk::resetPerFramePerfCounters()
     mPerfCounters.flushedOutsideRenderPassCommandBuffers = 0;
     mPerfCounters.resolveImageCommands                   = 0;
     mPerfCounters.descriptorSetAllocations               = 0;
+    mPerfCounters.coalescedDraws                         = 0;
 
     mRenderer->resetCommandQueuePerFrameCounters();
 
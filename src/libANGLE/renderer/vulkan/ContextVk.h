@@ -1116,12 +1116,20 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
                             const void *indices,
                             DirtyBits dirtyBitMask);
 
+    // If |firstIndexOut| is not null, the index buffer may be left bound at a lower offset than
+    // |indices|, in which case the draw call must start at the returned firstIndex.
     angle::Result setupIndexedDraw(const gl::Context *context,
                                    gl::PrimitiveMode mode,
                                    GLsizei indexCount,
                                    GLsizei instanceCount,
                                    gl::DrawElementsType indexType,
-                                   const void *indices);
+                                   const void *indices,
+                                   uint32_t *firstIndexOut);
+    bool canOffsetIntoBoundIndexBuffer(const VertexArrayVk *vertexArrayVk,
+                                       gl::DrawElementsType indexType,
+                                       const void *indices,
+                                       uint32_t *firstIndexOut) const;
+    bool canCoalesceIndexedDraw(gl::PrimitiveMode mode) const;
     angle::Result setupIndirectDraw(const gl::Context *context,
                                     gl::PrimitiveMode mode,
                                     DirtyBits dirtyBitMask,
@@ -1541,6 +1549,10 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
     gl::DrawElementsType mCurrentDrawElementsType;
     angle::PackedEnumMap<gl::DrawElementsType, VkIndexType> mIndexTypeMap;
 
+    // Whether merging consecutive draw calls is invisible to the current program, i.e. it cannot
+    // observe gl_PrimitiveID, which restarts at zero with every draw call.
+    bool mCanCoalesceDrawsWithProgram;
+
     // Cache the current draw call's firstVertex to be passed to
     // TransformFeedbackVk::getBufferOffsets.  Unfortunately, gl_BaseVertex support in Vulkan is
     // not yet ubiquitous, which would have otherwise removed the need for this value to be passed
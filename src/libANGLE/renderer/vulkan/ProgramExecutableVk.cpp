@@ -207,7 +207,8 @@ void GetPipelineCacheData(ContextVk *contextVk,
         }
 
         // Compress it.
-        if (!angle::CompressBlob(pipelineCacheData.size(), pipelineCacheData.data(), cacheDataOut))
+        if (!angle::CompressBlob(pipelineCacheData.size(), pipelineCacheData.data(),
+                                 angle::BlobCodec::LZ, cacheDataOut))
         {
             cacheDataOut->clear();
         }
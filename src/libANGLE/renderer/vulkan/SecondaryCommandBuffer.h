@@ -969,6 +969,14 @@ class SecondaryCommandBuffer final : angle::NonCopyable
                                                     int32_t vertexOffset,
                                                     uint32_t firstInstance);
 
+    // If the last recorded command is a non-instanced indexed draw whose indices end at
+    // |firstIndex|, grows it by |indexCount| indices and returns true.  |primitiveIndexCount| is
+    // the number of indices per primitive, which the previous draw must be a multiple of so that
+    // the merged draw assembles the same primitives.
+    bool extendLastDrawIndexed(uint32_t firstIndex,
+                               uint32_t indexCount,
+                               uint32_t primitiveIndexCount);
+
     void drawIndirect(const Buffer &buffer,
                       VkDeviceSize offset,
                       uint32_t drawCount,
@@ -1151,6 +1159,7 @@ class SecondaryCommandBuffer final : angle::NonCopyable
     {
         mCommands.clear();
         mCommandAllocator.reset(&mCommandTracker);
+        mLastCommand = nullptr;
     }
 
     // The SecondaryCommandBuffer is valid if it's been initialized
@@ -1187,6 +1196,7 @@ class SecondaryCommandBuffer final : angle::NonCopyable
         StructType *command  = reinterpret_cast<StructType *>(commandMemory);
         command->header.id   = cmdID;
         command->header.size = static_cast<uint16_t>(allocationSize);
+        mLastCommand         = &command->header;
 
         return command;
     }
@@ -1272,9 +1282,13 @@ class SecondaryCommandBuffer final : angle::NonCopyable
     SecondaryCommandBlockPool mCommandAllocator;
 
     CommandBufferCommandTracker mCommandTracker;
+
+    // The most recently recorded command, used to merge consecutive draw calls.
+    CommandHeader *mLastCommand;
 };
 
-ANGLE_INLINE SecondaryCommandBuffer::SecondaryCommandBuffer() : mIsOpen(true)
+ANGLE_INLINE SecondaryCommandBuffer::SecondaryCommandBuffer()
+    : mIsOpen(true), mLastCommand(nullptr)
 {
     mCommandAllocator.setCommandBuffer(this);
 }
@@ -1713,6 +1727,56 @@ ANGLE_INLINE void SecondaryCommandBuffer::drawIndexedInstancedBaseVertexBaseInst
     mCommandTracker.onDraw();
 }
 
+ANGLE_INLINE bool SecondaryCommandBuffer::extendLastDrawIndexed(uint32_t firstIndex,
+                                                                uint32_t indexCount,
+                                                                uint32_t primitiveIndexCount)
+{
+    ASSERT(primitiveIndexCount > 0);
+
+    if (mLastCommand == nullptr)
+    {
+        return false;
+    }
+
+    uint32_t *lastIndexCount = nullptr;
+    uint32_t lastFirstIndex  = 0;
+    switch (mLastCommand->id)
+    {
+        case CommandID::DrawIndexed:
+            lastIndexCount = &reinterpret_cast<DrawIndexedParams *>(mLastCommand)->indexCount;
+            break;
+        case CommandID::DrawIndexedInstancedBaseVertexBaseInstance:
+        {
+            DrawIndexedInstancedBaseVertexBaseInstanceParams *params =
+                reinterpret_cast<DrawIndexedInstancedBaseVertexBaseInstanceParams *>(
+                    mLastCommand);
+            if (params->instanceCount != 1 || params->vertexOffset != 0 ||
+                params->firstInstance != 0)
+            {
+                return false;
+            }
+            lastIndexCount = &params->indexCount;
+            lastFirstIndex = params->firstIndex;
+            break;
+        }
+        default:
+            return false;
+    }
+
+    if (static_cast<uint64_t>(lastFirstIndex) + *lastIndexCount != firstIndex ||
+        *lastIndexCount % primitiveIndexCount != 0 ||
+        static_cast<uint64_t>(*lastIndexCount) + indexCount >
+            std::numeric_limits<uint32_t>::max())
+    {
+        return false;
+    }
+
+    *lastIndexCount += indexCount;
+
+    mCommandTracker.onDraw();
+    return true;
+}
+
 ANGLE_INLINE void SecondaryCommandBuffer::drawIndirect(const Buffer &buffer,
                                                        VkDeviceSize offset,
                                                        uint32_t drawCount,
@@ -9,6 +9,7 @@
 
 #include "libANGLE/renderer/vulkan/VertexArrayVk.h"
 
+#include "common/WorkerThread.h"
 #include "common/debug.h"
 #include "common/utilities.h"
 #include "libANGLE/Context.h"
@@ -19,6 +20,8 @@
 #include "libANGLE/renderer/vulkan/vk_renderer.h"
 #include "libANGLE/renderer/vulkan/vk_resource.h"
 
+#include <thread>
+
 namespace rx
 {
 namespace
@@ -27,6 +30,13 @@ constexpr int kStreamIndexBufferCachedIndexCount = 6;
 constexpr int kMaxCachedStreamIndexBuffers       = 4;
 constexpr size_t kDefaultValueSize               = sizeof(gl::VertexAttribCurrentValueData::Values);
 
+// Client arrays with at least this many bytes to copy are split into chunks of at least
+// kParallelStreamingMinChunkBytes, which run on the worker thread pool.  Smaller copies are done
+// inline, where the cost of waking up the workers would outweigh the gain.
+constexpr size_t kParallelStreamingMinBytes      = 256 * 1024;
+constexpr size_t kParallelStreamingMinChunkBytes = 64 * 1024;
+constexpr size_t kParallelStreamingMaxChunks     = 16;
+
 ANGLE_INLINE bool BindingIsAligned(const angle::Format &angleFormat,
                                    VkDeviceSize offset,
                                    GLuint stride)
@@ -85,6 +95,47 @@ void WarnOnVertexFormatConversion(ContextVk *contextVk,
         vertexFormat.getActualBufferFormat(compressed).glInternalFormat);
 }
 
+void CopyVertexData(const uint8_t *srcData,
+                    size_t bytesToCopy,
+                    size_t vertexCount,
+                    size_t srcStride,
+                    VertexCopyFunction vertexLoadFunction,
+                    uint8_t *dst)
+{
+    if (vertexLoadFunction != nullptr)
+    {
+        vertexLoadFunction(srcData, srcStride, vertexCount, dst);
+    }
+    else
+    {
+        memcpy(dst, srcData, bytesToCopy);
+    }
+}
+
+// Waits for the client attribute copies posted to the worker thread pool by
+// StreamVertexDataInChunks.  The copies are also waited for on destruction, so that they never
+// outlive the draw call that uses the client memory, even if it fails.
+class PendingStreamedCopies final : angle::NonCopyable
+{
+  public:
+    ~PendingStreamedCopies() { wait(); }
+
+    void add(std::shared_ptr<angle::WaitableEvent> &&event)
+    {
+        ASSERT(event != nullptr);
+        mEvents.push_back(std::move(event));
+    }
+
+    void wait()
+    {
+        angle::WaitableEvent::WaitMany(&mEvents);
+        mEvents.clear();
+    }
+
+  private:
+    std::vector<std::shared_ptr<angle::WaitableEvent>> mEvents;
+};
+
 angle::Result StreamVertexData(ContextVk *contextVk,
                                vk::BufferHelper *dstBufferHelper,
                                const uint8_t *srcData,
@@ -103,19 +154,108 @@ angle::Result StreamVertexData(ContextVk *contextVk,
     }
 
     uint8_t *dst = dstBufferHelper->getMappedMemory() + dstOffset;
+    CopyVertexData(srcData, bytesToCopy, vertexCount, srcStride, vertexLoadFunction, dst);
 
-    if (vertexLoadFunction != nullptr)
+    ANGLE_TRY(dstBufferHelper->flush(renderer));
+
+    return angle::Result::Continue;
+}
+
+size_t GetParallelStreamingChunkCount(size_t bytesToCopy)
+{
+    static const size_t kMaxChunkCount = std::min<size_t>(
+        kParallelStreamingMaxChunks, std::max(1u, std::thread::hardware_concurrency()));
+    return std::min(bytesToCopy / kParallelStreamingMinChunkBytes, kMaxChunkCount);
+}
+
+class CopyVertexDataTask final : public angle::Closure
+{
+  public:
+    CopyVertexDataTask(const uint8_t *srcData,
+                       size_t bytesToCopy,
+                       size_t vertexCount,
+                       size_t srcStride,
+                       VertexCopyFunction vertexLoadFunction,
+                       uint8_t *dst)
+        : mSrcData(srcData),
+          mBytesToCopy(bytesToCopy),
+          mVertexCount(vertexCount),
+          mSrcStride(srcStride),
+          mVertexLoadFunction(vertexLoadFunction),
+          mDst(dst)
+    {}
+
+    void operator()() override
     {
-        vertexLoadFunction(srcData, srcStride, vertexCount, dst);
+        ANGLE_TRACE_EVENT0("gpu.angle", "CopyVertexDataTask");
+        CopyVertexData(mSrcData, mBytesToCopy, mVertexCount, mSrcStride, mVertexLoadFunction,
+                       mDst);
     }
-    else
+
+  private:
+    const uint8_t *mSrcData;
+    size_t mBytesToCopy;
+    size_t mVertexCount;
+    size_t mSrcStride;
+    VertexCopyFunction mVertexLoadFunction;
+    uint8_t *mDst;
+};
+
+// Same as StreamVertexData, but splits the copy in |chunkCount| chunks.  All but the last chunk
+// are posted to |workerPool|, and the last one is copied on the calling thread.  The caller must
+// wait for |pendingCopies| before flushing |dstBufferHelper|.
+void StreamVertexDataInChunks(angle::WorkerThreadPool *workerPool,
+                              size_t chunkCount,
+                              vk::BufferHelper *dstBufferHelper,
+                              const uint8_t *srcData,
+                              size_t bytesToCopy,
+                              size_t dstOffset,
+                              size_t vertexCount,
+                              size_t srcStride,
+                              size_t dstStride,
+                              VertexCopyFunction vertexLoadFunction,
+                              PendingStreamedCopies *pendingCopies)
+{
+    ASSERT(chunkCount > 1);
+    uint8_t *dst = dstBufferHelper->getMappedMemory() + dstOffset;
+
+    // Converted vertices are split on vertex boundaries, and plain copies on 16-byte boundaries.
+    const size_t unitCount   = vertexLoadFunction != nullptr ? vertexCount : bytesToCopy / 16;
+    const size_t chunkUnits  = UnsignedCeilDivide(unitCount, chunkCount);
+    const size_t srcUnitSize = vertexLoadFunction != nullptr ? srcStride : 16;
+    const size_t dstUnitSize = vertexLoadFunction != nullptr ? dstStride : 16;
+
+    for (size_t firstUnit = 0; firstUnit < unitCount; firstUnit += chunkUnits)
     {
-        memcpy(dst, srcData, bytesToCopy);
-    }
+        const bool lastChunk = firstUnit + chunkUnits >= unitCount;
+        const size_t units   = lastChunk ? unitCount - firstUnit : chunkUnits;
 
-    ANGLE_TRY(dstBufferHelper->flush(renderer));
+        // The last chunk also takes the bytes of a plain copy that don't make up a whole unit.
+        const size_t chunkBytes =
+            lastChunk ? bytesToCopy - firstUnit * dstUnitSize : units * dstUnitSize;
+        const uint8_t *chunkSrc = srcData + firstUnit * srcUnitSize;
+        uint8_t *chunkDst       = dst + firstUnit * dstUnitSize;
 
-    return angle::Result::Continue;
+        if (lastChunk)
+        {
+            CopyVertexData(chunkSrc, chunkBytes, units, srcStride, vertexLoadFunction, chunkDst);
+        }
+        else
+        {
+            std::shared_ptr<CopyVertexDataTask> task = std::make_shared<CopyVertexDataTask>(
+                chunkSrc, chunkBytes, units, srcStride, vertexLoadFunction, chunkDst);
+            std::shared_ptr<angle::WaitableEvent> event = workerPool->postWorkerTask(task);
+            if (event != nullptr)
+            {
+                pendingCopies->add(std::move(event));
+            }
+            else
+            {
+                // The pool failed to create the task, so do the copy here instead.
+                (*task)();
+            }
+        }
+    }
 }
 
 angle::Result StreamVertexDataWithDivisor(ContextVk *contextVk,
@@ -1256,6 +1396,14 @@ angle::Result VertexArrayVk::updateStreamedAttribs(const gl::Context *context,
         mergeClientAttribsRange(renderer, activeStreamedAttribs, startVertex,
                                 startVertex + vertexCount, mergeRanges, mergedIndexes);
 
+    // Large client arrays are copied in chunks on the worker thread pool.  Their buffers are
+    // flushed once all the copies of the draw call are done.
+    const bool parallelStreaming =
+        renderer->getFeatures().enableParallelClientAttribStreaming.enabled;
+    std::shared_ptr<angle::WorkerThreadPool> streamingPool;
+    PendingStreamedCopies pendingCopies;
+    angle::FixedVector<vk::BufferHelper *, gl::MAX_VERTEX_ATTRIBS> buffersPendingFlush;
+
     for (size_t attribIndex : activeStreamedAttribs)
     {
         const gl::VertexAttribute &attrib = attribs[attribIndex];
@@ -1355,11 +1503,42 @@ angle::Result VertexArrayVk::updateStreamedAttribs(const gl::Context *context,
                 size_t bytesToAllocate = range.endAddr - range.startAddr;
                 ANGLE_TRY(contextVk->allocateStreamedVertexBuffer(
                     mergedAttribIdx, bytesToAllocate, &attribBufferHelper[mergedAttribIdx]));
-                ANGLE_TRY(StreamVertexData(
-                    contextVk, attribBufferHelper[mergedAttribIdx],
-                    (const uint8_t *)range.copyStartAddr, bytesToAllocate - destOffset, destOffset,
-                    vertexCount, binding.getStride(),
-                    combined ? nullptr : vertexFormat.getVertexLoadFunction(compressed)));
+
+                const uint8_t *srcData   = reinterpret_cast<const uint8_t *>(range.copyStartAddr);
+                const size_t bytesToCopy = bytesToAllocate - destOffset;
+                const VertexCopyFunction vertexLoadFunction =
+                    combined ? nullptr : vertexFormat.getVertexLoadFunction(compressed);
+
+                size_t chunkCount = 1;
+                if (parallelStreaming && srcData != nullptr &&
+                    bytesToCopy >= kParallelStreamingMinBytes)
+                {
+                    if (streamingPool == nullptr)
+                    {
+                        streamingPool = context->getWorkerThreadPool();
+                    }
+                    // A single-threaded pool would run the chunks inline anyway.
+                    if (streamingPool->isAsync())
+                    {
+                        chunkCount = GetParallelStreamingChunkCount(bytesToCopy);
+                    }
+                }
+
+                if (chunkCount > 1)
+                {
+                    StreamVertexDataInChunks(streamingPool.get(), chunkCount,
+                                             attribBufferHelper[mergedAttribIdx], srcData,
+                                             bytesToCopy, destOffset, vertexCount,
+                                             binding.getStride(), stride, vertexLoadFunction,
+                                             &pendingCopies);
+                    buffersPendingFlush.push_back(attribBufferHelper[mergedAttribIdx]);
+                }
+                else
+                {
+                    ANGLE_TRY(StreamVertexData(contextVk, attribBufferHelper[mergedAttribIdx],
+                                               srcData, bytesToCopy, destOffset, vertexCount,
+                                               binding.getStride(), vertexLoadFunction));
+                }
             }
             vertexDataBuffer = attribBufferHelper[mergedAttribIdx];
             startOffset      = combined ? (uintptr_t)attrib.pointer - range.startAddr : 0;
@@ -1379,6 +1558,12 @@ angle::Result VertexArrayVk::updateStreamedAttribs(const gl::Context *context,
                                 mCurrentArrayBufferStrides[attribIndex]));
     }
 
+    pendingCopies.wait();
+    for (vk::BufferHelper *buffer : buffersPendingFlush)
+    {
+        ANGLE_TRY(buffer->flush(renderer));
+    }
+
     return angle::Result::Continue;
 }
 
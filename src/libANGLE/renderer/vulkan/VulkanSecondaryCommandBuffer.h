@@ -148,6 +148,13 @@ class VulkanSecondaryCommandBuffer : public priv::CommandBuffer
                                                     uint32_t firstIndex,
                                                     int32_t vertexOffset,
                                                     uint32_t firstInstance);
+    // Recorded Vulkan commands cannot be modified, so draws are never merged.
+    bool extendLastDrawIndexed(uint32_t firstIndex,
+                               uint32_t indexCount,
+                               uint32_t primitiveIndexCount)
+    {
+        return false;
+    }
     void drawIndexedIndirect(const Buffer &buffer,
                              VkDeviceSize offset,
                              uint32_t drawCount,
@@ -3632,7 +3632,8 @@ VkResult GraphicsPipelineDesc::initializePipeline(ErrorContext *context,
                                     &createFlags2, &createInfo);
     }
 
-    VkResult result = pipelineCache->createGraphicsPipeline(context, createInfo, pipelineOut);
+    VkResult result =
+        pipelineCache->createGraphicsPipeline(context, createInfo, hash(subset), pipelineOut);
 
     if (supportsFeedback)
     {
@@ -7200,40 +7201,90 @@ void SharedCacheKeyManager<SharedDescriptorSetCacheKey>::addKey(
     addKeyImpl(key);
 }
 
+// ShardedPipelineCache implementation.
+ShardedPipelineCache::ShardedPipelineCache() : mShardCount(1) {}
+
+ShardedPipelineCache::~ShardedPipelineCache() = default;
+
+void ShardedPipelineCache::destroy(VkDevice device)
+{
+    for (Shard &shard : mShards)
+    {
+        shard.cache.destroy(device);
+        shard.sizeAtLastSync     = 0;
+        shard.chunkCount         = 0;
+        shard.blobCacheSlotIndex = 0;
+    }
+}
+
+void ShardedPipelineCache::setShardCount(size_t shardCount)
+{
+    ASSERT(shardCount > 0 && shardCount <= kMaxShardCount);
+    ASSERT(!mShards[0].cache.valid());
+    mShardCount = shardCount;
+}
+
 // PipelineCacheAccess implementation.
-std::unique_lock<angle::SimpleMutex> PipelineCacheAccess::getLock()
+const vk::PipelineCache &PipelineCacheAccess::getCache(size_t hash,
+                                                       std::shared_mutex **mutexOut) const
 {
-    if (mMutex == nullptr)
+    if (mShardedCache == nullptr)
     {
-        return std::unique_lock<angle::SimpleMutex>();
+        *mutexOut = mMutex;
+        return *mPipelineCache;
     }
 
-    return std::unique_lock<angle::SimpleMutex>(*mMutex);
+    ShardedPipelineCache::Shard &shard = mShardedCache->getShardForHash(hash);
+    *mutexOut                          = mIsThreadSafe ? &shard.mutex : nullptr;
+    return shard.cache;
 }
 
 VkResult PipelineCacheAccess::createGraphicsPipeline(vk::ErrorContext *context,
                                                      const VkGraphicsPipelineCreateInfo &createInfo,
+                                                     size_t descHash,
                                                      vk::Pipeline *pipelineOut)
 {
-    std::unique_lock<angle::SimpleMutex> lock = getLock();
+    std::shared_mutex *mutex       = nullptr;
+    const vk::PipelineCache &cache = getCache(descHash, &mutex);
 
-    return pipelineOut->initGraphics(context->getDevice(), createInfo, *mPipelineCache);
+    std::shared_lock<std::shared_mutex> lock;
+    if (mutex != nullptr)
+    {
+        lock = std::shared_lock<std::shared_mutex>(*mutex);
+    }
+
+    return pipelineOut->initGraphics(context->getDevice(), createInfo, cache);
 }
 
 VkResult PipelineCacheAccess::createComputePipeline(vk::ErrorContext *context,
                                                     const VkComputePipelineCreateInfo &createInfo,
                                                     vk::Pipeline *pipelineOut)
 {
-    std::unique_lock<angle::SimpleMutex> lock = getLock();
+    // Compute pipelines are few, and all live in the first shard.
+    std::shared_mutex *mutex       = nullptr;
+    const vk::PipelineCache &cache = getCache(0, &mutex);
+
+    std::shared_lock<std::shared_mutex> lock;
+    if (mutex != nullptr)
+    {
+        lock = std::shared_lock<std::shared_mutex>(*mutex);
+    }
 
-    return pipelineOut->initCompute(context->getDevice(), createInfo, *mPipelineCache);
+    return pipelineOut->initCompute(context->getDevice(), createInfo, cache);
 }
 
 VkResult PipelineCacheAccess::getCacheData(vk::ErrorContext *context,
                                            size_t *cacheSize,
                                            void *cacheData)
 {
-    std::unique_lock<angle::SimpleMutex> lock = getLock();
+    ASSERT(mShardedCache == nullptr);
+
+    std::unique_lock<std::shared_mutex> lock;
+    if (mMutex != nullptr)
+    {
+        lock = std::unique_lock<std::shared_mutex>(*mMutex);
+    }
+
     return mPipelineCache->getCacheData(context->getDevice(), cacheSize, cacheData);
 }
 
@@ -7241,9 +7292,15 @@ void PipelineCacheAccess::merge(Renderer *renderer, const vk::PipelineCache &pip
 {
     ASSERT(isThreadSafe());
 
-    std::unique_lock<angle::SimpleMutex> lock = getLock();
+    // A program's cache holds pipelines of many descriptions, so it cannot be split by their
+    // hashes.  Program caches are all merged into the first shard, where the driver can deduplicate
+    // repeated merges of the same pipelines, and which shard holds them is the same on every run.
+    std::shared_mutex *mutex       = nullptr;
+    const vk::PipelineCache &cache = getCache(0, &mutex);
+    ASSERT(mutex != nullptr);
+    std::unique_lock<std::shared_mutex> lock(*mutex);
 
-    mPipelineCache->merge(renderer->getDevice(), 1, pipelineCache.ptr());
+    cache.merge(renderer->getDevice(), 1, pipelineCache.ptr());
 }
 }  // namespace vk
 
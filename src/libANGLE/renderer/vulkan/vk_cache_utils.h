@@ -12,6 +12,7 @@
 #define LIBANGLE_RENDERER_VULKAN_VK_CACHE_UTILS_H_
 
 #include <deque>
+#include <shared_mutex>
 
 #include "common/Color.h"
 #include "common/FixedVector.h"
@@ -1493,22 +1494,91 @@ ANGLE_INLINE bool GraphicsPipelineTransitionMatch(GraphicsPipelineTransitionBits
     return true;
 }
 
+// The renderer's global pipeline cache, split into a number of VkPipelineCache objects (shards).
+// Pipelines created through this cache go to the shard selected by the hash of their description,
+// so a pipeline is looked up in the same shard by the next run of the application.  Each shard is
+// stored separately in the blob cache, so that syncing the cache only rewrites the shards that
+// gained pipelines, and merging a program's cache only blocks pipeline creation in one shard.
+class ShardedPipelineCache final : angle::NonCopyable
+{
+  public:
+    static constexpr size_t kMaxShardCount = 8;
+
+    struct Shard
+    {
+        PipelineCache cache;
+        // Pipeline creation takes the lock shared, as VkPipelineCache is internally synchronized.
+        // It's taken exclusively to merge into the cache, which requires external synchronization,
+        // and to query the cache data, so that the data does not grow between the size and data
+        // queries.
+        std::shared_mutex mutex;
+
+        // Like angle::SimpleMutex::assertLocked(), this relies on |mutex| not being recursive.
+        void assertLocked()
+        {
+#if defined(ANGLE_ENABLE_ASSERTS)
+            const bool acquiredLock = mutex.try_lock();
+            if (acquiredLock)
+            {
+                mutex.unlock();
+            }
+            ASSERT(!acquiredLock);
+#endif  // ANGLE_ENABLE_ASSERTS
+        }
+
+        // Blob cache bookkeeping, only accessed by the renderer's pipeline cache sync.
+        size_t sizeAtLastSync     = 0;
+        size_t chunkCount         = 0;
+        size_t blobCacheSlotIndex = 0;
+    };
+
+    ShardedPipelineCache();
+    ~ShardedPipelineCache();
+
+    void destroy(VkDevice device);
+
+    void setShardCount(size_t shardCount);
+    size_t getShardCount() const { return mShardCount; }
+
+    Shard &getShard(size_t shardIndex)
+    {
+        ASSERT(shardIndex < mShardCount);
+        return mShards[shardIndex];
+    }
+    Shard &getShardForHash(size_t hash) { return mShards[hash % mShardCount]; }
+
+  private:
+    std::array<Shard, kMaxShardCount> mShards;
+    size_t mShardCount;
+};
+
 // A class that encapsulates the vk::PipelineCache and associated mutex.  The mutex may be nullptr
-// if synchronization is not necessary.
+// if synchronization is not necessary.  Alternatively, it gives access to the shards of the global
+// pipeline cache.
 class PipelineCacheAccess
 {
   public:
     PipelineCacheAccess()  = default;
     ~PipelineCacheAccess() = default;
 
-    void init(const vk::PipelineCache *pipelineCache, angle::SimpleMutex *mutex)
+    void init(const vk::PipelineCache *pipelineCache, std::shared_mutex *mutex)
     {
         mPipelineCache = pipelineCache;
         mMutex         = mutex;
+        mShardedCache  = nullptr;
+    }
+    void init(ShardedPipelineCache *shardedCache, bool isThreadSafe)
+    {
+        mPipelineCache = nullptr;
+        mMutex         = nullptr;
+        mShardedCache  = shardedCache;
+        mIsThreadSafe  = isThreadSafe;
     }
 
+    // |descHash| selects the shard of a sharded cache the pipeline is created in.
     VkResult createGraphicsPipeline(vk::ErrorContext *context,
                                     const VkGraphicsPipelineCreateInfo &createInfo,
+                                    size_t descHash,
                                     vk::Pipeline *pipelineOut);
     VkResult createComputePipeline(vk::ErrorContext *context,
                                    const VkComputePipelineCreateInfo &createInfo,
@@ -1518,13 +1588,20 @@ class PipelineCacheAccess
 
     void merge(Renderer *renderer, const vk::PipelineCache &pipelineCache);
 
-    bool isThreadSafe() const { return mMutex != nullptr; }
+    bool isThreadSafe() const
+    {
+        return mShardedCache != nullptr ? mIsThreadSafe : mMutex != nullptr;
+    }
 
   private:
-    std::unique_lock<angle::SimpleMutex> getLock();
+    // Returns the cache (or shard of the cache) to use for a pipeline with the given hash, along
+    // with its mutex if synchronization is necessary.
+    const vk::PipelineCache &getCache(size_t hash, std::shared_mutex **mutexOut) const;
 
     const vk::PipelineCache *mPipelineCache = nullptr;
-    angle::SimpleMutex *mMutex;
+    std::shared_mutex *mMutex               = nullptr;
+    ShardedPipelineCache *mShardedCache     = nullptr;
+    bool mIsThreadSafe                      = false;
 };
 
 // Monolithic pipeline creation tasks are created as soon as a pipeline is created out of libraries.
@@ -1134,6 +1134,7 @@ void UnpackHeaderDataForPipelineCache(CacheDataHeader *data,
 }
 
 void ComputePipelineCacheVkChunkKey(const VkPhysicalDeviceProperties &physicalDeviceProperties,
+                                    const size_t shardIndex,
                                     const size_t slotIndex,
                                     const size_t chunkIndex,
                                     angle::BlobCacheKey *hashOut)
@@ -1156,6 +1157,13 @@ void ComputePipelineCacheVkChunkKey(const VkPhysicalDeviceProperties &physicalDe
     // Add chunkIndex to generate unique key for chunks.
     hashStream << std::hex << static_cast<uint32_t>(chunkIndex);
 
+    // Add shardIndex to generate unique keys for each shard of the pipeline cache.  The first
+    // shard uses the same keys as an unsharded cache, so its data survives toggling sharding.
+    if (shardIndex > 0)
+    {
+        hashStream << "s" << std::hex << static_cast<uint32_t>(shardIndex);
+    }
+
     const std::string &hashString = hashStream.str();
     angle::base::SHA1HashBytes(reinterpret_cast<const unsigned char *>(hashString.c_str()),
                                hashString.length(), hashOut->data());
@@ -1178,6 +1186,7 @@ PipelineCacheVkChunkInfos GetPipelineCacheVkChunkInfos(Renderer *renderer,
                                                        const angle::MemoryBuffer &compressedData,
                                                        const size_t numChunks,
                                                        const size_t chunkSize,
+                                                       const size_t shardIndex,
                                                        const size_t slotIndex);
 
 // Returns the number of stored chunks.  "lastNumStoredChunks" is the number of chunks,
@@ -1194,34 +1203,23 @@ void ErasePipelineCacheVkChunks(vk::GlobalOps *globalOps,
                                 Renderer *renderer,
                                 const size_t startChunk,
                                 const size_t numChunks,
+                                const size_t shardIndex,
                                 const size_t slotIndex,
                                 angle::MemoryBuffer *scratchBuffer);
 
 void CompressAndStorePipelineCacheVk(vk::GlobalOps *globalOps,
                                      Renderer *renderer,
-                                     const std::vector<uint8_t> &cacheData,
-                                     const size_t maxTotalSize)
+                                     const size_t shardIndex,
+                                     const std::vector<uint8_t> &cacheData)
 {
-    // Though the pipeline cache will be compressed and divided into several chunks to store in blob
-    // cache, the largest total size of blob cache is only 2M in android now, so there is no use to
-    // handle big pipeline cache when android will reject it finally.
-    if (cacheData.size() >= maxTotalSize)
-    {
-        static bool warned = false;
-        if (!warned)
-        {
-            // TODO: handle the big pipeline cache. http://anglebug.com/42263322
-            WARN() << "Skip syncing pipeline cache data when it's larger than maxTotalSize. "
-                      "(this message will no longer repeat)";
-            warned = true;
-        }
-        return;
-    }
+    // The total size of the shards is checked against the blob cache limits by the caller.
 
     // To make it possible to store more pipeline cache data, compress the whole pipelineCache.
+    // Deflate is used as the size of the cache is limited, and it's only loaded once at startup.
     angle::MemoryBuffer compressedData;
 
-    if (!angle::CompressBlob(cacheData.size(), cacheData.data(), &compressedData))
+    if (!angle::CompressBlob(cacheData.size(), cacheData.data(), angle::BlobCodec::Deflate,
+                             &compressedData))
     {
         WARN() << "Skip syncing pipeline cache data as it failed compression.";
         return;
@@ -1247,12 +1245,13 @@ void CompressAndStorePipelineCacheVk(vk::GlobalOps *globalOps,
     }
 
     size_t previousSlotIndex = 0;
-    const size_t slotIndex   = renderer->getNextPipelineCacheBlobCacheSlotIndex(&previousSlotIndex);
-    const size_t previousNumChunks = renderer->updatePipelineCacheChunkCount(numChunks);
+    const size_t slotIndex =
+        renderer->getNextPipelineCacheBlobCacheSlotIndex(shardIndex, &previousSlotIndex);
+    const size_t previousNumChunks = renderer->updatePipelineCacheChunkCount(shardIndex, numChunks);
     const bool isSlotChanged       = (slotIndex != previousSlotIndex);
 
-    PipelineCacheVkChunkInfos chunkInfos =
-        GetPipelineCacheVkChunkInfos(renderer, compressedData, numChunks, chunkSize, slotIndex);
+    PipelineCacheVkChunkInfos chunkInfos = GetPipelineCacheVkChunkInfos(
+        renderer, compressedData, numChunks, chunkSize, shardIndex, slotIndex);
 
     // Store all chunks without checking if they already exist (because they can't).
     size_t numStoredChunks = StorePipelineCacheVkChunks(globalOps, renderer, 0, chunkInfos,
@@ -1264,7 +1263,7 @@ void CompressAndStorePipelineCacheVk(vk::GlobalOps *globalOps,
     if (isSlotChanged || previousNumChunks > numChunks)
     {
         const size_t startChunk = isSlotChanged ? 0 : numChunks;
-        ErasePipelineCacheVkChunks(globalOps, renderer, startChunk, previousNumChunks,
+        ErasePipelineCacheVkChunks(globalOps, renderer, startChunk, previousNumChunks, shardIndex,
                                    previousSlotIndex, &scratchBuffer);
     }
 
@@ -1294,6 +1293,7 @@ PipelineCacheVkChunkInfos GetPipelineCacheVkChunkInfos(Renderer *renderer,
                                                        const angle::MemoryBuffer &compressedData,
                                                        const size_t numChunks,
                                                        const size_t chunkSize,
+                                                       const size_t shardIndex,
                                                        const size_t slotIndex)
 {
     const VkPhysicalDeviceProperties &physicalDeviceProperties =
@@ -1310,7 +1310,8 @@ PipelineCacheVkChunkInfos GetPipelineCacheVkChunkInfos(Renderer *renderer,
 
         // Create unique hash key.
         angle::BlobCacheKey cacheHash;
-        ComputePipelineCacheVkChunkKey(physicalDeviceProperties, slotIndex, chunkIndex, &cacheHash);
+        ComputePipelineCacheVkChunkKey(physicalDeviceProperties, shardIndex, slotIndex, chunkIndex,
+                                       &cacheHash);
 
         if (kEnableCRCForPipelineCache)
         {
@@ -1425,6 +1426,7 @@ void ErasePipelineCacheVkChunks(vk::GlobalOps *globalOps,
                                 Renderer *renderer,
                                 const size_t startChunk,
                                 const size_t numChunks,
+                                const size_t shardIndex,
                                 const size_t slotIndex,
                                 angle::MemoryBuffer *scratchBuffer)
 {
@@ -1443,40 +1445,49 @@ void ErasePipelineCacheVkChunks(vk::GlobalOps *globalOps,
     for (size_t chunkIndex = startChunk; chunkIndex < numChunks; ++chunkIndex)
     {
         egl::BlobCache::Key chunkCacheHash;
-        ComputePipelineCacheVkChunkKey(physicalDeviceProperties, slotIndex, chunkIndex,
+        ComputePipelineCacheVkChunkKey(physicalDeviceProperties, shardIndex, slotIndex, chunkIndex,
                                        &chunkCacheHash);
         globalOps->putBlob(chunkCacheHash, keyData);
     }
 }
 
+// The data of the pipeline cache shards that have changed since the last sync.
+struct PipelineCacheShardData
+{
+    size_t shardIndex;
+    std::vector<uint8_t> cacheData;
+};
+using PipelineCacheShardDataList =
+    angle::FixedVector<PipelineCacheShardData, vk::ShardedPipelineCache::kMaxShardCount>;
+
 class CompressAndStorePipelineCacheTask : public angle::Closure
 {
   public:
     CompressAndStorePipelineCacheTask(vk::GlobalOps *globalOps,
                                       Renderer *renderer,
-                                      std::vector<uint8_t> &&cacheData,
-                                      size_t kMaxTotalSize)
-        : mGlobalOps(globalOps),
-          mRenderer(renderer),
-          mCacheData(std::move(cacheData)),
-          mMaxTotalSize(kMaxTotalSize)
+                                      PipelineCacheShardDataList &&shardData)
+        : mGlobalOps(globalOps), mRenderer(renderer), mShardData(std::move(shardData))
     {}
 
     void operator()() override
     {
         ANGLE_TRACE_EVENT0("gpu.angle", "CompressAndStorePipelineCacheVk");
-        CompressAndStorePipelineCacheVk(mGlobalOps, mRenderer, mCacheData, mMaxTotalSize);
+        for (const PipelineCacheShardData &shardData : mShardData)
+        {
+            CompressAndStorePipelineCacheVk(mGlobalOps, mRenderer, shardData.shardIndex,
+                                            shardData.cacheData);
+        }
     }
 
   private:
     vk::GlobalOps *mGlobalOps;
     Renderer *mRenderer;
-    std::vector<uint8_t> mCacheData;
-    size_t mMaxTotalSize;
+    PipelineCacheShardDataList mShardData;
 };
 
 angle::Result GetAndDecompressPipelineCacheVk(vk::ErrorContext *context,
                                               vk::GlobalOps *globalOps,
+                                              const size_t shardIndex,
                                               angle::MemoryBuffer *uncompressedData,
                                               bool *success)
 {
@@ -1488,7 +1499,8 @@ angle::Result GetAndDecompressPipelineCacheVk(vk::ErrorContext *context,
     const VkPhysicalDeviceProperties &physicalDeviceProperties =
         renderer->getPhysicalDeviceProperties();
 
-    const size_t firstSlotIndex = renderer->getNextPipelineCacheBlobCacheSlotIndex(nullptr);
+    const size_t firstSlotIndex =
+        renderer->getNextPipelineCacheBlobCacheSlotIndex(shardIndex, nullptr);
     size_t slotIndex            = firstSlotIndex;
 
     angle::BlobCacheKey chunkCacheHash;
@@ -1498,7 +1510,8 @@ angle::Result GetAndDecompressPipelineCacheVk(vk::ErrorContext *context,
     while (true)
     {
         // Compute the hash key of chunkIndex 0 and find the first cache data in blob cache.
-        ComputePipelineCacheVkChunkKey(physicalDeviceProperties, slotIndex, 0, &chunkCacheHash);
+        ComputePipelineCacheVkChunkKey(physicalDeviceProperties, shardIndex, slotIndex, 0,
+                                       &chunkCacheHash);
 
         if (globalOps->getBlob(chunkCacheHash, &keyData) &&
             keyData.size() >= sizeof(CacheDataHeader))
@@ -1508,7 +1521,7 @@ angle::Result GetAndDecompressPipelineCacheVk(vk::ErrorContext *context,
         }
         // Nothing in the cache for current slotIndex.
 
-        slotIndex = renderer->getNextPipelineCacheBlobCacheSlotIndex(nullptr);
+        slotIndex = renderer->getNextPipelineCacheBlobCacheSlotIndex(shardIndex, nullptr);
         if (slotIndex == firstSlotIndex)
         {
             // Nothing in all slots.
@@ -1549,7 +1562,7 @@ angle::Result GetAndDecompressPipelineCacheVk(vk::ErrorContext *context,
         return angle::Result::Continue;
     }
 
-    renderer->updatePipelineCacheChunkCount(numChunks);
+    renderer->updatePipelineCacheChunkCount(shardIndex, numChunks);
 
     size_t chunkSize      = keyData.size() - sizeof(CacheDataHeader);
     size_t compressedSize = 0;
@@ -1568,8 +1581,8 @@ angle::Result GetAndDecompressPipelineCacheVk(vk::ErrorContext *context,
         if (chunkIndex > 0)
         {
             // Get the unique key by chunkIndex.
-            ComputePipelineCacheVkChunkKey(physicalDeviceProperties, slotIndex, chunkIndex,
-                                           &chunkCacheHash);
+            ComputePipelineCacheVkChunkKey(physicalDeviceProperties, shardIndex, slotIndex,
+                                           chunkIndex, &chunkCacheHash);
 
             if (!globalOps->getBlob(chunkCacheHash, &keyData) ||
                 keyData.size() < sizeof(CacheDataHeader))
@@ -1982,10 +1995,7 @@ Renderer::Renderer()
       mHostVisibleVertexConversionBufferMemoryTypeIndex(kInvalidMemoryTypeIndex),
       mDeviceLocalVertexConversionBufferMemoryTypeIndex(kInvalidMemoryTypeIndex),
       mVertexConversionBufferAlignment(1),
-      mCurrentPipelineCacheBlobCacheSlotIndex(0),
-      mPipelineCacheChunkCount(0),
       mPipelineCacheVkUpdateTimeout(kPipelineCacheVkUpdatePeriod),
-      mPipelineCacheSizeAtLastSync(0),
       mPipelineCacheInitialized(false),
       mValidationMessageCount(0),
       mIsColorFramebufferFetchCoherent(false),
@@ -4379,7 +4389,7 @@ angle::Result Renderer::createDeviceAndQueue(vk::ErrorContext *context, uint32_t
 
     // Vulkan pipeline cache will be initialized lazily in ensurePipelineCacheInitialized() method.
     ASSERT(!mPipelineCacheInitialized);
-    ASSERT(!mPipelineCache.valid());
+    ASSERT(!mPipelineCache.getShard(0).cache.valid());
 
     // Track the set of supported pipeline stages.  This is used when issuing image layout
     // transitions that cover many stages (such as AllGraphicsReadOnly) to mask out unsupported
@@ -5893,6 +5903,22 @@ void Renderer::initFeatures(const vk::ExtensionNameList &deviceExtensionNames,
 
     ANGLE_FEATURE_CONDITION(&mFeatures, enableAsyncPipelineCacheCompression, true);
 
+    // Copy large client attribute arrays on the worker threads.  Small arrays are always copied
+    // inline, so this only kicks in for draw calls with hundreds of thousands of vertices.  The
+    // worker thread pool is shared with shader compilation and program linking, so this is
+    // opt-in to avoid draw calls waiting behind those tasks.
+    ANGLE_FEATURE_CONDITION(&mFeatures, enableParallelClientAttribStreaming, false);
+
+    // Avoid rebinding the index buffer for draws that walk through one index buffer, and merge
+    // such draws when they are recorded back to back.  This is opt-in for now, as it rewrites draw
+    // calls that are already recorded.
+    ANGLE_FEATURE_CONDITION(&mFeatures, coalesceConsecutiveIndexedDraws, false);
+
+    // Let pipelines be created in parallel without contending on a single pipeline cache lock, and
+    // only store the parts of the pipeline cache that changed in the blob cache.  This is opt-in
+    // for now, as it changes the layout of the pipeline cache in the blob cache.
+    ANGLE_FEATURE_CONDITION(&mFeatures, shardGlobalPipelineCache, false);
+
     // Enable using an extra submit fence for the command batches. In case there is an external
     // fence during the main submission, this extra fence will be used for an empty submission right
     // after it.
@@ -6227,13 +6253,15 @@ void Renderer::initFeatures(const vk::ExtensionNameList &deviceExtensionNames,
 void Renderer::appBasedFeatureOverrides(const vk::ExtensionNameList &extensions) {}
 
 angle::Result Renderer::initPipelineCache(vk::ErrorContext *context,
+                                          size_t shardIndex,
                                           vk::PipelineCache *pipelineCache,
                                           bool *success)
 {
     angle::MemoryBuffer initialData;
     if (!mFeatures.disablePipelineCacheLoadForTesting.enabled)
     {
-        ANGLE_TRY(GetAndDecompressPipelineCacheVk(context, mGlobalOps, &initialData, success));
+        ANGLE_TRY(GetAndDecompressPipelineCacheVk(context, mGlobalOps, shardIndex, &initialData,
+                                                  success));
     }
 
     VkPipelineCacheCreateInfo pipelineCacheCreateInfo = {};
@@ -6264,13 +6292,24 @@ angle::Result Renderer::ensurePipelineCacheInitialized(vk::ErrorContext *context
         return angle::Result::Continue;
     }
 
-    // We should now create the pipeline cache with the blob cache pipeline data.
-    bool loadedFromBlobCache = false;
-    ANGLE_TRY(initPipelineCache(context, &mPipelineCache, &loadedFromBlobCache));
-    if (loadedFromBlobCache)
+    mPipelineCache.setShardCount(mFeatures.shardGlobalPipelineCache.enabled
+                                     ? vk::ShardedPipelineCache::kMaxShardCount
+                                     : 1);
+
+    // We should now create the pipeline cache with the blob cache pipeline data.  Every shard is
+    // created directly from its own data, so no merging is necessary.
+    for (size_t shardIndex = 0; shardIndex < mPipelineCache.getShardCount(); ++shardIndex)
     {
-        ANGLE_TRY(getLockedPipelineCacheDataIfNew(context, &mPipelineCacheSizeAtLastSync,
-                                                  mPipelineCacheSizeAtLastSync, nullptr));
+        vk::ShardedPipelineCache::Shard &shard = mPipelineCache.getShard(shardIndex);
+
+        bool loadedFromBlobCache = false;
+        ANGLE_TRY(initPipelineCache(context, shardIndex, &shard.cache, &loadedFromBlobCache));
+        if (loadedFromBlobCache)
+        {
+            std::unique_lock<std::shared_mutex> shardLock(shard.mutex);
+            ANGLE_TRY(getLockedPipelineCacheDataIfNew(context, shardIndex, &shard.sizeAtLastSync,
+                                                      shard.sizeAtLastSync, nullptr));
+        }
     }
 
     mPipelineCacheInitialized = true;
@@ -6278,23 +6317,26 @@ angle::Result Renderer::ensurePipelineCacheInitialized(vk::ErrorContext *context
     return angle::Result::Continue;
 }
 
-size_t Renderer::getNextPipelineCacheBlobCacheSlotIndex(size_t *previousSlotIndexOut)
+size_t Renderer::getNextPipelineCacheBlobCacheSlotIndex(size_t shardIndex,
+                                                        size_t *previousSlotIndexOut)
 {
+    size_t &slotIndex = mPipelineCache.getShard(shardIndex).blobCacheSlotIndex;
     if (previousSlotIndexOut != nullptr)
     {
-        *previousSlotIndexOut = mCurrentPipelineCacheBlobCacheSlotIndex;
+        *previousSlotIndexOut = slotIndex;
     }
     if (getFeatures().useDualPipelineBlobCacheSlots.enabled)
     {
-        mCurrentPipelineCacheBlobCacheSlotIndex = 1 - mCurrentPipelineCacheBlobCacheSlotIndex;
+        slotIndex = 1 - slotIndex;
     }
-    return mCurrentPipelineCacheBlobCacheSlotIndex;
+    return slotIndex;
 }
 
-size_t Renderer::updatePipelineCacheChunkCount(size_t chunkCount)
+size_t Renderer::updatePipelineCacheChunkCount(size_t shardIndex, size_t chunkCount)
 {
-    const size_t previousChunkCount = mPipelineCacheChunkCount;
-    mPipelineCacheChunkCount        = chunkCount;
+    size_t &shardChunkCount         = mPipelineCache.getShard(shardIndex).chunkCount;
+    const size_t previousChunkCount = shardChunkCount;
+    shardChunkCount                 = chunkCount;
     return previousChunkCount;
 }
 
@@ -6303,13 +6345,11 @@ angle::Result Renderer::getPipelineCache(vk::ErrorContext *context,
 {
     ANGLE_TRY(ensurePipelineCacheInitialized(context));
 
-    angle::SimpleMutex *pipelineCacheMutex =
+    const bool isThreadSafe =
         context->getFeatures().mergeProgramPipelineCachesToGlobalCache.enabled ||
-                context->getFeatures().preferMonolithicPipelinesOverLibraries.enabled
-            ? &mPipelineCacheMutex
-            : nullptr;
+        context->getFeatures().preferMonolithicPipelinesOverLibraries.enabled;
 
-    pipelineCacheOut->init(&mPipelineCache, pipelineCacheMutex);
+    pipelineCacheOut->init(&mPipelineCache, isThreadSafe);
     return angle::Result::Continue;
 }
 
@@ -6383,16 +6423,17 @@ void Renderer::initializeFrontendFeatures(angle::FrontendFeatures *features) con
 }
 
 angle::Result Renderer::getLockedPipelineCacheDataIfNew(vk::ErrorContext *context,
+                                                        size_t shardIndex,
                                                         size_t *pipelineCacheSizeOut,
                                                         size_t lastSyncSize,
                                                         std::vector<uint8_t> *pipelineCacheDataOut)
 {
-    // Because this function may call |getCacheData| twice, |mPipelineCacheMutex| is not passed to
+    // Because this function may call |getCacheData| twice, the shard's mutex is not passed to
     // |PipelineAccessCache|, and is expected to be locked once **by the caller**.
-    mPipelineCacheMutex.assertLocked();
+    mPipelineCache.getShard(shardIndex).assertLocked();
 
     vk::PipelineCacheAccess globalCache;
-    globalCache.init(&mPipelineCache, nullptr);
+    globalCache.init(&mPipelineCache.getShard(shardIndex).cache, nullptr);
 
     ANGLE_VK_TRY(context, globalCache.getCacheData(context, pipelineCacheSizeOut, nullptr));
 
@@ -6439,7 +6480,7 @@ angle::Result Renderer::syncPipelineCacheVk(vk::ErrorContext *context,
     {
         return angle::Result::Continue;
     }
-    ASSERT(mPipelineCache.valid());
+    ASSERT(mPipelineCache.getShard(0).cache.valid());
 
     if (!mFeatures.syncMonolithicPipelinesToBlobCache.enabled)
     {
@@ -6464,36 +6505,71 @@ angle::Result Renderer::syncPipelineCacheVk(vk::ErrorContext *context,
         return angle::Result::Continue;
     }
 
-    size_t pipelineCacheSize = 0;
-    std::vector<uint8_t> pipelineCacheData;
+    // zlib compression ratio normally ranges from 2:1 to 5:1.  With async compression, the limit
+    // is 64M to ensure the size can fit into the 32MB blob cache limit on supported platforms.
+    // Without it, to avoid the risk, the limit is 64k.  The limit applies to all shards together,
+    // so that sharding the cache does not multiply the space it takes in the blob cache.
+    const size_t maxTotalSize =
+        mFeatures.enableAsyncPipelineCacheCompression.enabled ? 64 * 1024 * 1024 : 64 * 1024;
+
+    // Only the shards that gained pipelines since the last sync are stored again.
+    PipelineCacheShardDataList shardDataList;
+    size_t totalPipelineCacheSize = 0;
+    for (size_t shardIndex = 0; shardIndex < mPipelineCache.getShardCount(); ++shardIndex)
     {
-        std::unique_lock<angle::SimpleMutex> lock(mPipelineCacheMutex);
-        ANGLE_TRY(getLockedPipelineCacheDataIfNew(
-            context, &pipelineCacheSize, mPipelineCacheSizeAtLastSync, &pipelineCacheData));
+        vk::ShardedPipelineCache::Shard &shard = mPipelineCache.getShard(shardIndex);
+
+        size_t pipelineCacheSize = 0;
+        std::vector<uint8_t> pipelineCacheData;
+        {
+            std::unique_lock<std::shared_mutex> lock(shard.mutex);
+            ANGLE_TRY(getLockedPipelineCacheDataIfNew(context, shardIndex, &pipelineCacheSize,
+                                                      shard.sizeAtLastSync, &pipelineCacheData));
+        }
+        totalPipelineCacheSize += pipelineCacheSize;
+        if (pipelineCacheData.empty())
+        {
+            continue;
+        }
+        shard.sizeAtLastSync = pipelineCacheSize;
+
+        shardDataList.push_back({shardIndex, std::move(pipelineCacheData)});
     }
-    if (pipelineCacheData.empty())
+    if (shardDataList.empty())
     {
         return angle::Result::Continue;
     }
-    mPipelineCacheSizeAtLastSync = pipelineCacheSize;
 
-    if (mFeatures.enableAsyncPipelineCacheCompression.enabled)
+    // Though the pipeline cache will be compressed and divided into several chunks to store in blob
+    // cache, the largest total size of blob cache is only 2M in android now, so there is no use to
+    // handle big pipeline cache when android will reject it finally.
+    if (totalPipelineCacheSize >= maxTotalSize)
     {
-        // zlib compression ratio normally ranges from 2:1 to 5:1. Set kMaxTotalSize to 64M to
-        // ensure the size can fit into the 32MB blob cache limit on supported platforms.
-        constexpr size_t kMaxTotalSize = 64 * 1024 * 1024;
+        static bool warned = false;
+        if (!warned)
+        {
+            // TODO: handle the big pipeline cache. http://anglebug.com/42263322
+            WARN() << "Skip syncing pipeline cache data when it's larger than maxTotalSize. "
+                      "(this message will no longer repeat)";
+            warned = true;
+        }
+        return angle::Result::Continue;
+    }
 
+    if (mFeatures.enableAsyncPipelineCacheCompression.enabled)
+    {
         // Create task to compress.
         mCompressEvent = contextGL->getWorkerThreadPool()->postWorkerTask(
-            std::make_shared<CompressAndStorePipelineCacheTask>(
-                globalOps, this, std::move(pipelineCacheData), kMaxTotalSize));
+            std::make_shared<CompressAndStorePipelineCacheTask>(globalOps, this,
+                                                                std::move(shardDataList)));
     }
     else
     {
-        // If enableAsyncPipelineCacheCompression is disabled, to avoid the risk, set kMaxTotalSize
-        // to 64k.
-        constexpr size_t kMaxTotalSize = 64 * 1024;
-        CompressAndStorePipelineCacheVk(globalOps, this, pipelineCacheData, kMaxTotalSize);
+        for (const PipelineCacheShardData &shardData : shardDataList)
+        {
+            CompressAndStorePipelineCacheVk(globalOps, this, shardData.shardIndex,
+                                            shardData.cacheData);
+        }
     }
 
     return angle::Result::Continue;
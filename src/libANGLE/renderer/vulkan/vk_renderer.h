@@ -240,9 +240,10 @@ class Renderer : angle::NonCopyable
     const vk::Format &getFormat(angle::FormatID formatID) const { return mFormatTable[formatID]; }
 
     // Get the pipeline cache data after retrieving the size, but only if the size is increased
-    // since last query.  This function should be called with the |mPipelineCacheMutex| lock already
-    // held.
+    // since last query.  This function should be called with the shard's mutex already held
+    // exclusively.
     angle::Result getLockedPipelineCacheDataIfNew(vk::ErrorContext *context,
+                                                  size_t shardIndex,
                                                   size_t *pipelineCacheSizeOut,
                                                   size_t lastSyncSize,
                                                   std::vector<uint8_t> *pipelineCacheDataOut);
@@ -362,8 +363,8 @@ class Renderer : angle::NonCopyable
         mSuballocationGarbageList.add(this, std::move(garbage));
     }
 
-    size_t getNextPipelineCacheBlobCacheSlotIndex(size_t *previousSlotIndexOut);
-    size_t updatePipelineCacheChunkCount(size_t chunkCount);
+    size_t getNextPipelineCacheBlobCacheSlotIndex(size_t shardIndex, size_t *previousSlotIndexOut);
+    size_t updatePipelineCacheChunkCount(size_t shardIndex, size_t chunkCount);
     angle::Result getPipelineCache(vk::ErrorContext *context,
                                    vk::PipelineCacheAccess *pipelineCacheOut);
     angle::Result mergeIntoPipelineCache(vk::ErrorContext *context,
@@ -749,6 +750,7 @@ class Renderer : angle::NonCopyable
                       angle::NativeWindowSystem nativeWindowSystem);
     void appBasedFeatureOverrides(const vk::ExtensionNameList &extensions);
     angle::Result initPipelineCache(vk::ErrorContext *context,
+                                    size_t shardIndex,
                                     vk::PipelineCache *pipelineCache,
                                     bool *success);
     angle::Result ensurePipelineCacheInitialized(vk::ErrorContext *context);
@@ -945,18 +947,12 @@ class Renderer : angle::NonCopyable
     uint32_t mDeviceLocalVertexConversionBufferMemoryTypeIndex;
     size_t mVertexConversionBufferAlignment;
 
-    // The mutex protects -
-    // 1. initialization of the cache
-    // 2. Vulkan driver guarantess synchronization for read and write operations but the spec
-    //    requires external synchronization when mPipelineCache is the dstCache of
-    //    vkMergePipelineCaches. Lock the mutex if mergeProgramPipelineCachesToGlobalCache is
-    //    enabled
+    // The mutex protects initialization of the cache.  Vulkan driver guarantees synchronization
+    // for read and write operations but the spec requires external synchronization when a shard
+    // is the dstCache of vkMergePipelineCaches; each shard has its own mutex for that purpose.
     angle::SimpleMutex mPipelineCacheMutex;
-    vk::PipelineCache mPipelineCache;
-    size_t mCurrentPipelineCacheBlobCacheSlotIndex;
-    size_t mPipelineCacheChunkCount;
+    vk::ShardedPipelineCache mPipelineCache;
     uint32_t mPipelineCacheVkUpdateTimeout;
-    size_t mPipelineCacheSizeAtLastSync;
     std::atomic<bool> mPipelineCacheInitialized;
 
     // Latest validation data for debug overlay.
@@ -182,4 +182,43 @@ angle::Result BufferWgpu::getIndexRange(const gl::Context *context,
     return angle::Result::Continue;
 }
 
+angle::Result BufferWgpu::getIndexRanges(const gl::Context *context,
+                                         gl::DrawElementsType type,
+                                         const IndexRangeSpan *spans,
+                                         size_t spanCount,
+                                         bool primitiveRestartEnabled,
+                                         gl::IndexRange *outRanges)
+{
+    ContextWgpu *contextWgpu = webgpu::GetImpl(context);
+
+    ASSERT(spanCount > 0);
+    const GLuint typeBytes = gl::GetDrawElementsTypeSize(type);
+
+    // Read back once for every run of adjacent spans, so that the bytes between the spans are not
+    // read.
+    for (size_t firstSpan = 0; firstSpan < spanCount;)
+    {
+        const size_t runCount =
+            GetAdjacentIndexRangeSpanCount(type, spans + firstSpan, spanCount - firstSpan);
+        const IndexRangeSpan &lastSpan = spans[firstSpan + runCount - 1];
+        const size_t readOffset        = spans[firstSpan].offset;
+        const size_t readSize = lastSpan.offset + lastSpan.count * typeBytes - readOffset;
+
+        webgpu::BufferReadback readback;
+        ANGLE_TRY(mBuffer.readDataImmediate(contextWgpu, readOffset, readSize,
+                                            webgpu::RenderPassClosureReason::IndexRangeReadback,
+                                            &readback));
+        for (size_t span = firstSpan; span < firstSpan + runCount; ++span)
+        {
+            const uint8_t *spanData = readback.data + (spans[span].offset - readOffset);
+            outRanges[span] =
+                gl::ComputeIndexRange(type, spanData, spans[span].count, primitiveRestartEnabled);
+        }
+
+        firstSpan += runCount;
+    }
+
+    return angle::Result::Continue;
+}
+
 }  // namespace rx
@@ -54,6 +54,12 @@ class BufferWgpu : public BufferImpl
                                 size_t count,
                                 bool primitiveRestartEnabled,
                                 gl::IndexRange *outRange) override;
+    angle::Result getIndexRanges(const gl::Context *context,
+                                 gl::DrawElementsType type,
+                                 const IndexRangeSpan *spans,
+                                 size_t spanCount,
+                                 bool primitiveRestartEnabled,
+                                 gl::IndexRange *outRanges) override;
 
     webgpu::BufferHelper &getBuffer() { return mBuffer; }
 
@@ -4474,6 +4474,48 @@ const char *ValidateProgramPipeline(const Context *context)
     return nullptr;
 }
 
+void RecordDrawStatesError(const Context *context,
+                           angle::EntryPoint entryPoint,
+                           PrimitiveMode mode)
+{
+    intptr_t drawStatesError = context->getStateCache().getBasicDrawStatesErrorString(
+        context, &context->getPrivateStateCache());
+    if (drawStatesError)
+    {
+        const char *errorMessage = reinterpret_cast<const char *>(drawStatesError);
+        GLenum errorCode         = context->getStateCache().getBasicDrawElementsErrorCode();
+        ANGLE_VALIDATION_ERROR(errorCode, errorMessage);
+        return;
+    }
+
+    ASSERT(!context->getStateCache().isValidDrawMode(mode));
+    RecordDrawModeError(context, entryPoint, mode);
+}
+
+void RecordDrawElementsStatesError(const Context *context,
+                                   angle::EntryPoint entryPoint,
+                                   DrawElementsType type)
+{
+    if (!context->getStateCache().isValidDrawElementsType(type))
+    {
+        if (type == DrawElementsType::UnsignedInt)
+        {
+            ANGLE_VALIDATION_ERROR(GL_INVALID_ENUM, kTypeNotUnsignedShortByte);
+            return;
+        }
+
+        ASSERT(type == DrawElementsType::InvalidEnum);
+        ANGLE_VALIDATION_ERRORF(GL_INVALID_ENUM, kEnumInvalid);
+        return;
+    }
+
+    // All errors from ValidateDrawElementsStates return INVALID_OPERATION.
+    intptr_t drawElementsError = context->getStateCache().getBasicDrawElementsError(context);
+    ASSERT(drawElementsError);
+    const char *errorMessage = reinterpret_cast<const char *>(drawElementsError);
+    ANGLE_VALIDATION_ERROR(GL_INVALID_OPERATION, errorMessage);
+}
+
 void RecordDrawModeError(const Context *context, angle::EntryPoint entryPoint, PrimitiveMode mode)
 {
     const State &state                      = context->getState();
@@ -491,25 +491,23 @@ bool ValidateCopyTexImageParametersBase(const Context *context,
                                         Format *textureFormatOut);
 
 void RecordDrawModeError(const Context *context, angle::EntryPoint entryPoint, PrimitiveMode mode);
+void RecordDrawStatesError(const Context *context,
+                           angle::EntryPoint entryPoint,
+                           PrimitiveMode mode);
+void RecordDrawElementsStatesError(const Context *context,
+                                   angle::EntryPoint entryPoint,
+                                   DrawElementsType type);
 const char *ValidateDrawElementsStates(const Context *context);
 
 ANGLE_INLINE bool ValidateDrawBase(const Context *context,
                                    angle::EntryPoint entryPoint,
                                    PrimitiveMode mode)
 {
-    intptr_t drawStatesError = context->getStateCache().getBasicDrawStatesErrorString(
-        context, &context->getPrivateStateCache());
-    if (ANGLE_UNLIKELY(drawStatesError))
+    // All state-dependent checks are cached per mode, so only a failing draw takes the slow path.
+    if (ANGLE_UNLIKELY(!context->getStateCache().canDrawWithMode(
+            context, &context->getPrivateStateCache(), mode)))
     {
-        const char *errorMessage = reinterpret_cast<const char *>(drawStatesError);
-        GLenum errorCode         = context->getStateCache().getBasicDrawElementsErrorCode();
-        ANGLE_VALIDATION_ERROR(errorCode, errorMessage);
-        return false;
-    }
-
-    if (ANGLE_UNLIKELY(!context->getStateCache().isValidDrawMode(mode)))
-    {
-        RecordDrawModeError(context, entryPoint, mode);
+        RecordDrawStatesError(context, entryPoint, mode);
         return false;
     }
 
@@ -1158,8 +1156,7 @@ ANGLE_INLINE bool ValidateDrawArraysCommon(const Context *context,
         return false;
     }
 
-    if (ANGLE_UNLIKELY(context->getStateCache().isTransformFeedbackActiveUnpaused()) &&
-        ANGLE_UNLIKELY(!context->supportsGeometryOrTesselation()))
+    if (ANGLE_UNLIKELY(context->getStateCache().isTransformFeedbackBufferSpaceCheckNeeded()))
     {
         const State &state                      = context->getState();
         TransformFeedback *curTransformFeedback = state.getCurrentTransformFeedback();
@@ -1178,25 +1175,9 @@ ANGLE_INLINE bool ValidateDrawElementsBase(const Context *context,
                                            PrimitiveMode mode,
                                            DrawElementsType type)
 {
-    if (ANGLE_UNLIKELY(!context->getStateCache().isValidDrawElementsType(type)))
-    {
-        if (type == DrawElementsType::UnsignedInt)
-        {
-            ANGLE_VALIDATION_ERROR(GL_INVALID_ENUM, err::kTypeNotUnsignedShortByte);
-            return false;
-        }
-
-        ASSERT(type == DrawElementsType::InvalidEnum);
-        ANGLE_VALIDATION_ERRORF(GL_INVALID_ENUM, err::kEnumInvalid);
-        return false;
-    }
-
-    intptr_t drawElementsError = context->getStateCache().getBasicDrawElementsError(context);
-    if (ANGLE_UNLIKELY(drawElementsError))
+    if (ANGLE_UNLIKELY(!context->getStateCache().canDrawElementsWithType(context, type)))
     {
-        // All errors from ValidateDrawElementsStates return INVALID_OPERATION.
-        const char *errorMessage = reinterpret_cast<const char *>(drawElementsError);
-        ANGLE_VALIDATION_ERROR(GL_INVALID_OPERATION, errorMessage);
+        RecordDrawElementsStatesError(context, entryPoint, type);
         return false;
     }
 
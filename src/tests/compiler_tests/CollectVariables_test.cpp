@@ -1663,6 +1663,34 @@ TEST_F(CollectFragmentVariablesTest, StaticallyUsedButNotActiveInTernaryOp)
     checkUniformStaticallyUsedButNotActive("u");
 }
 
+// Test that a uniform used only in a branch that optimizeAST prunes is still reported as used.
+TEST_F(CollectFragmentVariablesTest, StaticallyUsedInPrunedBranch)
+{
+    const std::string &shaderString =
+        R"(#version 300 es
+        precision mediump float;
+        out vec4 out_fragColor;
+        uniform float u;
+        void main()
+        {
+            bool debug = false;
+            out_fragColor = vec4(0.0);
+            if (debug) {
+                out_fragColor = vec4(u);
+            }
+        })";
+
+    ShCompileOptions compileOptions = {};
+    compileOptions.optimizeAST      = true;
+    compile(shaderString, &compileOptions);
+
+    const auto &uniforms = mTranslator->getUniforms();
+    ASSERT_EQ(1u, uniforms.size());
+    EXPECT_EQ("u", uniforms[0].name);
+    EXPECT_TRUE(uniforms[0].staticUse);
+    EXPECT_TRUE(uniforms[0].active);
+}
+
 // Test a variable that is statically used but not active. The variable is a return value in an
 // unused function.
 TEST_F(CollectFragmentVariablesTest, StaticallyUsedButNotActiveAsReturnValue)
@@ -0,0 +1,227 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// CompileResultCache_test.cpp:
+//   Test that compilations with ShCompileOptions::memoizeCompileResults share their results
+//   through the compile result cache.
+//
+
+#include "GLSLANG/ShaderLang.h"
+#include "angle_gl.h"
+#include "gtest/gtest.h"
+
+#include <thread>
+#include <vector>
+
+namespace
+{
+constexpr char kFragmentShader[] = R"(#version 300 es
+precision mediump float;
+uniform vec4 u;
+uniform sampler2D s;
+in vec2 v;
+out vec4 color;
+void main()
+{
+    color = u + texture(s, v);
+})";
+
+constexpr char kInvalidFragmentShader[] = R"(#version 300 es
+precision mediump float;
+out vec4 color;
+void main()
+{
+    color = undeclared;
+})";
+
+class CompileResultCacheTest : public testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        sh::InitBuiltInResources(&mResources);
+        sh::ClearCompileResultCache();
+
+        mCompileOptions.objectCode            = true;
+        mCompileOptions.memoizeCompileResults = true;
+    }
+
+    void TearDown() override
+    {
+        for (ShHandle compiler : mCompilers)
+        {
+            sh::Destruct(compiler);
+        }
+        sh::ClearCompileResultCache();
+    }
+
+    ShHandle constructCompiler()
+    {
+        ShHandle compiler = sh::ConstructCompiler(GL_FRAGMENT_SHADER, SH_GLES3_SPEC,
+                                                  SH_GLSL_COMPATIBILITY_OUTPUT, &mResources);
+        EXPECT_NE(nullptr, compiler);
+        mCompilers.push_back(compiler);
+        return compiler;
+    }
+
+    bool compile(ShHandle compiler, const char *source)
+    {
+        return sh::Compile(compiler, &source, 1, mCompileOptions);
+    }
+
+    ShBuiltInResources mResources;
+    ShCompileOptions mCompileOptions;
+    std::vector<ShHandle> mCompilers;
+};
+
+// Test that a second compiler compiling the same shader gets the same results from the cache.
+TEST_F(CompileResultCacheTest, SharedBetweenCompilers)
+{
+    ShHandle first  = constructCompiler();
+    ShHandle second = constructCompiler();
+
+    ASSERT_TRUE(compile(first, kFragmentShader));
+    ShCompileResultCacheStatistics statistics = sh::GetCompileResultCacheStatistics();
+    EXPECT_EQ(0u, statistics.hits);
+    EXPECT_EQ(1u, statistics.misses);
+    EXPECT_EQ(1u, statistics.entryCount);
+    EXPECT_GT(statistics.totalBytes, 0u);
+
+    ASSERT_TRUE(compile(second, kFragmentShader));
+    statistics = sh::GetCompileResultCacheStatistics();
+    EXPECT_EQ(1u, statistics.hits);
+    EXPECT_EQ(1u, statistics.misses);
+    EXPECT_EQ(1u, statistics.entryCount);
+
+    EXPECT_EQ(sh::GetObjectCode(first), sh::GetObjectCode(second));
+    EXPECT_EQ(sh::GetShaderVersion(first), sh::GetShaderVersion(second));
+
+    const std::vector<sh::ShaderVariable> *firstUniforms  = sh::GetUniforms(first);
+    const std::vector<sh::ShaderVariable> *secondUniforms = sh::GetUniforms(second);
+    ASSERT_EQ(2u, secondUniforms->size());
+    EXPECT_EQ(*firstUniforms, *secondUniforms);
+
+    EXPECT_EQ(*sh::GetInputVaryings(first), *sh::GetInputVaryings(second));
+    EXPECT_EQ(*sh::GetOutputVariables(first), *sh::GetOutputVariables(second));
+}
+
+// Test that the same shader compiled with different options or resources is not shared.
+TEST_F(CompileResultCacheTest, KeyedOnOptionsAndResources)
+{
+    ShHandle compiler = constructCompiler();
+    ASSERT_TRUE(compile(compiler, kFragmentShader));
+
+    mCompileOptions.initOutputVariables = true;
+    ASSERT_TRUE(compile(compiler, kFragmentShader));
+
+    mResources.MaxDrawBuffers = 2;
+    ShHandle otherResources   = constructCompiler();
+    ASSERT_TRUE(compile(otherResources, kFragmentShader));
+
+    ShCompileResultCacheStatistics statistics = sh::GetCompileResultCacheStatistics();
+    EXPECT_EQ(0u, statistics.hits);
+    EXPECT_EQ(3u, statistics.misses);
+    EXPECT_EQ(3u, statistics.entryCount);
+}
+
+// Test that the results of the shader depend on how its source is split in strings.
+TEST_F(CompileResultCacheTest, KeyedOnStringBoundaries)
+{
+    ShHandle compiler = constructCompiler();
+
+    const char *whole[] = {"#version 300 es\nvoid main() {}"};
+    const char *split[] = {"#version 300 es\nvoid ", "main() {}"};
+    ASSERT_TRUE(sh::Compile(compiler, whole, 1, mCompileOptions));
+    ASSERT_TRUE(sh::Compile(compiler, split, 2, mCompileOptions));
+
+    EXPECT_EQ(2u, sh::GetCompileResultCacheStatistics().misses);
+}
+
+// Test that failed compilations are cached along with their info log.
+TEST_F(CompileResultCacheTest, FailedCompilation)
+{
+    ShHandle first  = constructCompiler();
+    ShHandle second = constructCompiler();
+
+    ASSERT_FALSE(compile(first, kInvalidFragmentShader));
+    ASSERT_FALSE(compile(second, kInvalidFragmentShader));
+
+    EXPECT_EQ(1u, sh::GetCompileResultCacheStatistics().hits);
+    EXPECT_NE(std::string::npos, sh::GetInfoLog(second).find("undeclared"));
+    EXPECT_EQ(sh::GetInfoLog(first), sh::GetInfoLog(second));
+}
+
+// Test that a hit replaces the results of the previous compilation of the compiler.
+TEST_F(CompileResultCacheTest, HitReplacesPreviousResults)
+{
+    ShHandle first  = constructCompiler();
+    ShHandle second = constructCompiler();
+
+    ASSERT_TRUE(compile(first, kFragmentShader));
+    ASSERT_FALSE(compile(second, kInvalidFragmentShader));
+    ASSERT_TRUE(compile(second, kFragmentShader));
+
+    EXPECT_EQ(1u, sh::GetCompileResultCacheStatistics().hits);
+    EXPECT_EQ("", sh::GetInfoLog(second));
+    EXPECT_EQ(sh::GetObjectCode(first), sh::GetObjectCode(second));
+}
+
+// Test that compilations without the option don't use the cache.
+TEST_F(CompileResultCacheTest, NotMemoizedByDefault)
+{
+    mCompileOptions.memoizeCompileResults = false;
+
+    ShHandle compiler = constructCompiler();
+    ASSERT_TRUE(compile(compiler, kFragmentShader));
+    ASSERT_TRUE(compile(compiler, kFragmentShader));
+
+    ShCompileResultCacheStatistics statistics = sh::GetCompileResultCacheStatistics();
+    EXPECT_EQ(0u, statistics.hits);
+    EXPECT_EQ(0u, statistics.misses);
+    EXPECT_EQ(0u, statistics.entryCount);
+}
+
+// Test compiling the same shader on several threads at once.
+TEST_F(CompileResultCacheTest, MultipleThreads)
+{
+    constexpr size_t kThreadCount       = 4;
+    constexpr size_t kCompilesPerThread = 8;
+
+    std::vector<ShHandle> compilers;
+    for (size_t index = 0; index < kThreadCount; ++index)
+    {
+        compilers.push_back(constructCompiler());
+    }
+    ASSERT_TRUE(compile(compilers[0], kFragmentShader));
+
+    std::vector<std::thread> threads;
+    std::vector<char> results(kThreadCount, false);
+    for (size_t index = 0; index < kThreadCount; ++index)
+    {
+        threads.emplace_back([&, index]() {
+            bool success = true;
+            for (size_t iteration = 0; iteration < kCompilesPerThread; ++iteration)
+            {
+                success = compile(compilers[index], kFragmentShader) && success;
+            }
+            results[index] = success;
+        });
+    }
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+
+    for (size_t index = 0; index < kThreadCount; ++index)
+    {
+        EXPECT_TRUE(results[index]);
+        EXPECT_EQ(sh::GetObjectCode(compilers[0]), sh::GetObjectCode(compilers[index]));
+    }
+
+    ShCompileResultCacheStatistics statistics = sh::GetCompileResultCacheStatistics();
+    EXPECT_EQ(kThreadCount * kCompilesPerThread, statistics.hits);
+    EXPECT_EQ(1u, statistics.misses);
+}
+}  // anonymous namespace
@@ -11,6 +11,28 @@
 #include "angle_gl.h"
 #include "gtest/gtest.h"
 
+#include <thread>
+#include <vector>
+
+namespace
+{
+// Only compiles if gl_MaxDrawBuffers is 4.
+constexpr char kMaxDrawBuffersShader[] = R"(precision mediump float;
+void main()
+{
+    float values[gl_MaxDrawBuffers == 4 ? 1 : -1];
+    values[0] = 1.0;
+    gl_FragColor = vec4(values[0]);
+})";
+
+bool CompileWithCompiler(ShHandle compiler, const char *source)
+{
+    ShCompileOptions compileOptions = {};
+    compileOptions.objectCode       = true;
+    return sh::Compile(compiler, &source, 1, compileOptions);
+}
+}  // anonymous namespace
+
 // Test default parameters.
 TEST(ConstructCompilerTest, DefaultParameters)
 {
@@ -44,3 +66,83 @@ TEST(ConstructCompilerTest, InvalidMaxDualSourceDrawBuffers)
                                               SH_GLSL_COMPATIBILITY_OUTPUT, &resources);
     ASSERT_EQ(nullptr, compiler);
 }
+
+// Test that compilers with different resources don't see each other's built-ins, while compilers
+// with the same resources come and go.
+TEST(ConstructCompilerTest, BuiltInsDependOnResources)
+{
+    ShBuiltInResources resources4;
+    sh::InitBuiltInResources(&resources4);
+    resources4.MaxDrawBuffers = 4;
+
+    ShBuiltInResources resources8 = resources4;
+    resources8.MaxDrawBuffers     = 8;
+
+    ShHandle compiler4 = sh::ConstructCompiler(GL_FRAGMENT_SHADER, SH_GLES2_SPEC,
+                                               SH_ESSL_OUTPUT, &resources4);
+    ShHandle compiler8 = sh::ConstructCompiler(GL_FRAGMENT_SHADER, SH_GLES2_SPEC,
+                                               SH_ESSL_OUTPUT, &resources8);
+    ASSERT_NE(nullptr, compiler4);
+    ASSERT_NE(nullptr, compiler8);
+
+    EXPECT_TRUE(CompileWithCompiler(compiler4, kMaxDrawBuffersShader));
+    EXPECT_FALSE(CompileWithCompiler(compiler8, kMaxDrawBuffersShader));
+
+    // Recreate the compiler once the built-ins it used are freed.
+    sh::Destruct(compiler4);
+    EXPECT_FALSE(CompileWithCompiler(compiler8, kMaxDrawBuffersShader));
+    compiler4 = sh::ConstructCompiler(GL_FRAGMENT_SHADER, SH_GLES2_SPEC, SH_ESSL_OUTPUT,
+                                      &resources4);
+    ASSERT_NE(nullptr, compiler4);
+    EXPECT_TRUE(CompileWithCompiler(compiler4, kMaxDrawBuffersShader));
+
+    sh::Destruct(compiler4);
+    sh::Destruct(compiler8);
+}
+
+// Test constructing compilers and compiling with them on several threads at once.
+TEST(ConstructCompilerTest, ConcurrentConstruction)
+{
+    constexpr int kThreadCount   = 4;
+    constexpr int kCompilerCount = 8;
+
+    ShBuiltInResources resources;
+    sh::InitBuiltInResources(&resources);
+    resources.MaxDrawBuffers = 4;
+
+    std::vector<int> compiledCounts(kThreadCount, 0);
+    std::vector<std::thread> threads;
+    for (int threadIndex = 0; threadIndex < kThreadCount; ++threadIndex)
+    {
+        threads.emplace_back([&resources, &compiledCounts, threadIndex]() {
+            for (int compilerIndex = 0; compilerIndex < kCompilerCount; ++compilerIndex)
+            {
+                const GLenum shaderType =
+                    compilerIndex % 2 == 0 ? GL_FRAGMENT_SHADER : GL_VERTEX_SHADER;
+                ShHandle compiler =
+                    sh::ConstructCompiler(shaderType, SH_GLES2_SPEC, SH_ESSL_OUTPUT, &resources);
+                if (compiler == nullptr)
+                {
+                    continue;
+                }
+                const char *source = shaderType == GL_FRAGMENT_SHADER
+                                         ? kMaxDrawBuffersShader
+                                         : "void main() { gl_Position = vec4(gl_MaxDrawBuffers); }";
+                if (CompileWithCompiler(compiler, source))
+                {
+                    ++compiledCounts[threadIndex];
+                }
+                sh::Destruct(compiler);
+            }
+        });
+    }
+
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+    for (int compiledCount : compiledCounts)
+    {
+        EXPECT_EQ(kCompilerCount, compiledCount);
+    }
+}
@@ -0,0 +1,212 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// PropagateLocalValues_test.cpp:
+//   Tests that ShCompileOptions::optimizeAST replaces local variables that are never written with
+//   their initial value, and prunes the branches that become constant.
+//
+
+#include "GLSLANG/ShaderLang.h"
+#include "angle_gl.h"
+#include "gtest/gtest.h"
+#include "tests/test_utils/compiler_test.h"
+
+using namespace sh;
+
+namespace
+{
+
+class PropagateLocalValuesTest : public MatchOutputCodeTest
+{
+  public:
+    PropagateLocalValuesTest() : MatchOutputCodeTest(GL_FRAGMENT_SHADER, SH_ESSL_OUTPUT)
+    {
+        ShCompileOptions defaultCompileOptions = {};
+        defaultCompileOptions.validateAST      = true;
+        defaultCompileOptions.optimizeAST      = true;
+        setDefaultCompileOptions(defaultCompileOptions);
+    }
+};
+
+// Test that a local initialized with a constant is replaced with the constant.
+TEST_F(PropagateLocalValuesTest, Constant)
+{
+    const char kShader[] = R"(#version 300 es
+precision highp float;
+uniform vec4 u;
+out vec4 o;
+void main()
+{
+    float scale = 2.0;
+    o = u * scale;
+})";
+    compile(kShader);
+
+    EXPECT_TRUE(notFoundInCode("scale"));
+}
+
+// Test that a chain of copies is replaced with the variable that is copied.
+TEST_F(PropagateLocalValuesTest, Copies)
+{
+    const char kShader[] = R"(#version 300 es
+precision highp float;
+uniform vec4 u;
+out vec4 o;
+void main()
+{
+    vec4 color = u;
+    vec4 colorCopy = color;
+    o = colorCopy;
+})";
+    compile(kShader);
+
+    EXPECT_TRUE(notFoundInCode("color"));
+}
+
+// Test that locals that are written after their declaration are kept.
+TEST_F(PropagateLocalValuesTest, WrittenLocalsKept)
+{
+    const char kShader[] = R"(#version 300 es
+precision highp float;
+uniform vec4 u;
+out vec4 o;
+void setOne(out float value)
+{
+    value = 1.0;
+}
+void main()
+{
+    float assigned = 2.0;
+    if (u.x > 0.0)
+    {
+        assigned = 3.0;
+    }
+    vec4 swizzled = u;
+    swizzled.x += 1.0;
+    float outArgument = 0.0;
+    setOne(outArgument);
+    o = vec4(assigned, outArgument, 0, 0) + swizzled;
+})";
+    compile(kShader);
+
+    EXPECT_TRUE(foundInCode("assigned"));
+    EXPECT_TRUE(foundInCode("swizzled"));
+    EXPECT_TRUE(foundInCode("outArgument"));
+}
+
+// Test that copies of variables that change are kept.
+TEST_F(PropagateLocalValuesTest, CopiesOfChangingVariablesKept)
+{
+    const char kShader[] = R"(#version 300 es
+precision highp float;
+uniform vec4 u;
+out vec4 o;
+void main()
+{
+    vec4 value = u;
+    vec4 copyBeforeWrite = value;
+    value *= 2.0;
+    o = value + copyBeforeWrite;
+})";
+    compile(kShader);
+
+    EXPECT_TRUE(foundInCode("copyBeforeWrite"));
+}
+
+// Test that a copy is kept if the variable it copies is hidden by another where the copy is read.
+TEST_F(PropagateLocalValuesTest, CopyOfShadowedVariableKept)
+{
+    const char kShader[] = R"(#version 300 es
+precision highp float;
+uniform vec4 u;
+out vec4 o;
+void main()
+{
+    vec4 color = u;
+    {
+        vec4 u = vec4(1.0);
+        o = color + u;
+    }
+})";
+    compile(kShader);
+
+    EXPECT_TRUE(foundInCode("color"));
+}
+
+// Test that branches on locals that are constant are pruned.
+TEST_F(PropagateLocalValuesTest, ConstantBranchesPruned)
+{
+    const char kShader[] = R"(#version 300 es
+precision highp float;
+uniform vec4 u;
+out vec4 o;
+void main()
+{
+    bool debug = false;
+    if (debug)
+    {
+        vec4 debugValue = u * 4.0;
+        o = debugValue;
+    }
+    else
+    {
+        o = u;
+    }
+    while (debug)
+    {
+        float loopValue = u.x;
+        o.x += loopValue;
+    }
+})";
+    compile(kShader);
+
+    EXPECT_TRUE(notFoundInCode("debug"));
+    EXPECT_TRUE(notFoundInCode("loopValue"));
+    EXPECT_TRUE(notFoundInCode("while ("));
+}
+
+// Test that the variables declared in the taken branch keep their scope.
+TEST_F(PropagateLocalValuesTest, TakenBranchScope)
+{
+    const char kShader[] = R"(#version 300 es
+precision highp float;
+uniform vec4 u;
+out vec4 o;
+void main()
+{
+    const bool enabled = true;
+    vec4 result = u;
+    if (enabled)
+    {
+        vec4 result = u * 2.0;
+        o = result;
+    }
+    o += result;
+})";
+    compile(kShader);
+
+    EXPECT_TRUE(notFoundInCode("if ("));
+}
+
+// Test that nothing is propagated without the option.
+TEST_F(PropagateLocalValuesTest, DisabledByDefault)
+{
+    const char kShader[] = R"(#version 300 es
+precision highp float;
+uniform vec4 u;
+out vec4 o;
+void main()
+{
+    float scale = 2.0;
+    o = u * scale;
+})";
+    ShCompileOptions compileOptions = {};
+    compileOptions.validateAST      = true;
+    compile(kShader, compileOptions);
+
+    EXPECT_TRUE(foundInCode("scale"));
+}
+
+}  // anonymous namespace
@@ -228,3 +228,49 @@ TEST_F(ShCompileTest, DecimalSepLocale)
         }
     }
 }
+
+// Test that pass statistics are only recorded if requested, and that they cover the compilation
+// from parsing to the generation of the output.
+TEST_F(ShCompileTest, PassStatistics)
+{
+    constexpr char kFragmentShader[] = R"(precision mediump float;
+uniform vec4 u;
+void main()
+{
+    gl_FragColor = u * 2.0;
+})";
+
+    const char *shaderStrings[] = {kFragmentShader};
+
+    testCompile(shaderStrings, 1, true);
+    const std::vector<ShPassStatistics> *passes = sh::GetPassStatistics(mCompiler);
+    ASSERT_NE(passes, nullptr);
+    EXPECT_TRUE(passes->empty());
+
+    ShCompileOptions options     = {};
+    options.objectCode           = true;
+    options.recordPassStatistics = true;
+    ASSERT_TRUE(sh::Compile(mCompiler, shaderStrings, 1, options));
+
+    passes = sh::GetPassStatistics(mCompiler);
+    ASSERT_NE(passes, nullptr);
+    ASSERT_GE(passes->size(), 2u);
+    EXPECT_STREQ(passes->front().name, "Parse");
+    EXPECT_EQ(passes->front().nodeCountBefore, 0u);
+    EXPECT_STREQ(passes->back().name, "OutputGLSL");
+
+    for (size_t passIndex = 0; passIndex < passes->size(); ++passIndex)
+    {
+        const ShPassStatistics &pass = (*passes)[passIndex];
+        EXPECT_GE(pass.timeSeconds, 0.0) << pass.name;
+        EXPECT_GT(pass.nodeCountAfter, 0u) << pass.name;
+        if (passIndex > 0)
+        {
+            EXPECT_EQ(pass.nodeCountBefore, (*passes)[passIndex - 1].nodeCountAfter) << pass.name;
+        }
+    }
+
+    // The statistics are reset with the results of the compilation.
+    sh::ClearResults(mCompiler);
+    EXPECT_TRUE(sh::GetPassStatistics(mCompiler)->empty());
+}
@@ -670,6 +670,151 @@ TEST_P(EGLBlobCacheInternalRejectionTest, ShaderCacheFunctional)
     glDeleteShader(shaderID);
 }
 
+class EGLBlobCachePipelineCacheTest : public EGLBlobCacheTest
+{
+  protected:
+    // Creates a display with the global pipeline cache sharded or not, draws |frameCount| frames
+    // to a pbuffer with it and terminates it.  Program and shader caching are disabled so that the
+    // pipeline cache is the only user of the blob cache.  The pipeline cache is compressed and
+    // stored synchronously, so it is in the blob cache by the time the frames are drawn.
+    void drawWithNewDisplay(bool shardPipelineCache, uint32_t frameCount)
+    {
+        std::vector<const char *> enabledFeatures = {
+            GetFeatureName(Feature::SyncMonolithicPipelinesToBlobCache),
+            GetFeatureName(Feature::DisableProgramCaching),
+        };
+        std::vector<const char *> disabledFeatures = {
+            GetFeatureName(Feature::SkipPipelineCacheSerialization),
+            GetFeatureName(Feature::EnableAsyncPipelineCacheCompression),
+            GetFeatureName(Feature::CacheCompiledShader),
+        };
+        (shardPipelineCache ? enabledFeatures : disabledFeatures)
+            .push_back(GetFeatureName(Feature::ShardGlobalPipelineCache));
+        enabledFeatures.push_back(nullptr);
+        disabledFeatures.push_back(nullptr);
+
+        std::vector<EGLAttrib> displayAttributes = {
+            EGL_PLATFORM_ANGLE_TYPE_ANGLE,
+            GetParam().getRenderer(),
+            EGL_FEATURE_OVERRIDES_ENABLED_ANGLE,
+            reinterpret_cast<EGLAttrib>(enabledFeatures.data()),
+            EGL_FEATURE_OVERRIDES_DISABLED_ANGLE,
+            reinterpret_cast<EGLAttrib>(disabledFeatures.data()),
+        };
+        if (GetParam().getDeviceType() != EGL_DONT_CARE)
+        {
+            displayAttributes.push_back(EGL_PLATFORM_ANGLE_DEVICE_TYPE_ANGLE);
+            displayAttributes.push_back(GetParam().getDeviceType());
+        }
+        displayAttributes.push_back(EGL_NONE);
+
+        EGLDisplay display = eglGetPlatformDisplay(EGL_PLATFORM_ANGLE_ANGLE,
+                                                   reinterpret_cast<void *>(EGL_DEFAULT_DISPLAY),
+                                                   displayAttributes.data());
+        ASSERT_NE(EGL_NO_DISPLAY, display);
+        ASSERT_EGL_TRUE(eglInitialize(display, nullptr, nullptr));
+
+        // The blob cache functions are reset when the display is terminated.
+        eglSetBlobCacheFuncsANDROID(display, SetBlob, GetBlob);
+        ASSERT_EGL_SUCCESS();
+
+        const EGLint configAttributes[] = {EGL_RED_SIZE,
+                                           8,
+                                           EGL_GREEN_SIZE,
+                                           8,
+                                           EGL_BLUE_SIZE,
+                                           8,
+                                           EGL_ALPHA_SIZE,
+                                           8,
+                                           EGL_RENDERABLE_TYPE,
+                                           EGL_OPENGL_ES3_BIT,
+                                           EGL_SURFACE_TYPE,
+                                           EGL_PBUFFER_BIT,
+                                           EGL_NONE};
+        EGLConfig config   = EGL_NO_CONFIG_KHR;
+        EGLint configCount = 0;
+        ASSERT_EGL_TRUE(eglChooseConfig(display, configAttributes, &config, 1, &configCount));
+        ASSERT_GT(configCount, 0);
+
+        const EGLint surfaceAttribs[] = {EGL_WIDTH, 16, EGL_HEIGHT, 16, EGL_NONE};
+        EGLSurface surface            = eglCreatePbufferSurface(display, config, surfaceAttribs);
+        ASSERT_NE(EGL_NO_SURFACE, surface);
+
+        const EGLint contextAttribs[] = {EGL_CONTEXT_MAJOR_VERSION, 3, EGL_NONE};
+        EGLContext context =
+            eglCreateContext(display, config, EGL_NO_CONTEXT, contextAttribs);
+        ASSERT_NE(EGL_NO_CONTEXT, context);
+
+        ASSERT_EGL_TRUE(eglMakeCurrent(display, surface, surface, context));
+
+        {
+            // Draw a triangle that covers the surface, without any vertex attributes.
+            constexpr char kVS[] = R"(#version 300 es
+void main()
+{
+    vec2 position = vec2(float(gl_VertexID % 2), float(gl_VertexID / 2)) * 4.0 - 1.0;
+    gl_Position   = vec4(position, 0.0, 1.0);
+})";
+
+            ANGLE_GL_PROGRAM(program, kVS, essl3_shaders::fs::Red());
+            glUseProgram(program);
+
+            // Every glFinish() is a frame boundary, at which the pipeline cache is periodically
+            // synced to the blob cache.
+            for (uint32_t frame = 0; frame < frameCount; ++frame)
+            {
+                glClear(GL_COLOR_BUFFER_BIT);
+                glDrawArrays(GL_TRIANGLES, 0, 3);
+                glFinish();
+            }
+            EXPECT_GL_NO_ERROR();
+            EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+        }
+
+        EXPECT_EGL_TRUE(eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT));
+        EXPECT_EGL_TRUE(eglDestroyContext(display, context));
+        EXPECT_EGL_TRUE(eglDestroySurface(display, surface));
+        EXPECT_EGL_TRUE(eglTerminate(display));
+    }
+};
+
+// Makes sure that the pipeline cache synced to the blob cache is loaded again by a new display,
+// including after the global pipeline cache is switched between sharded and unsharded.
+TEST_P(EGLBlobCachePipelineCacheTest, ReloadAfterTogglingSharding)
+{
+    // The Vulkan backend syncs the pipeline cache every 60 frame boundaries.
+    constexpr uint32_t kFramesToSync = 64;
+
+    for (bool shardPipelineCache : {false, true})
+    {
+        gApplicationCache.clear();
+
+        // Draw enough frames for the pipeline cache to be stored in the blob cache.
+        gLastCacheOpResult = CacheOpResult::ValueNotSet;
+        drawWithNewDisplay(shardPipelineCache, kFramesToSync);
+        EXPECT_EQ(CacheOpResult::SetSuccess, gLastCacheOpResult) << shardPipelineCache;
+        EXPECT_FALSE(gApplicationCache.empty()) << shardPipelineCache;
+
+        // Reload it with the same setting.
+        gLastCacheOpResult = CacheOpResult::ValueNotSet;
+        drawWithNewDisplay(shardPipelineCache, 1);
+        EXPECT_EQ(CacheOpResult::GetSuccess, gLastCacheOpResult) << shardPipelineCache;
+
+        // Reload it with the setting toggled.  The first shard is stored under the same keys as
+        // the unsharded cache, so it is found either way.
+        gLastCacheOpResult = CacheOpResult::ValueNotSet;
+        drawWithNewDisplay(!shardPipelineCache, 1);
+        EXPECT_EQ(CacheOpResult::GetSuccess, gLastCacheOpResult) << shardPipelineCache;
+
+        // Toggle it back, after the display with the other setting may have stored the cache too.
+        gLastCacheOpResult = CacheOpResult::ValueNotSet;
+        drawWithNewDisplay(shardPipelineCache, 1);
+        EXPECT_EQ(CacheOpResult::GetSuccess, gLastCacheOpResult) << shardPipelineCache;
+    }
+
+    getEGLWindow()->makeCurrent();
+}
+
 ANGLE_INSTANTIATE_TEST(EGLBlobCacheTest,
                        ES2_D3D9(),
                        ES2_D3D11(),
@@ -708,3 +853,6 @@ GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(EGLBlobCacheInternalRejectionTest)
 ANGLE_INSTANTIATE_TEST(EGLBlobCacheInternalRejectionTest,
                        ES2_OPENGL().enable(Feature::CorruptProgramBinaryForTesting),
                        ES2_OPENGLES().enable(Feature::CorruptProgramBinaryForTesting));
+
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(EGLBlobCachePipelineCacheTest);
+ANGLE_INSTANTIATE_TEST(EGLBlobCachePipelineCacheTest, ES3_VULKAN(), ES3_VULKAN_SWIFTSHADER());
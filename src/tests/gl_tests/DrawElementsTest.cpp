@@ -695,8 +695,356 @@ TEST_P(WebGLDrawElementsTest, DrawElementsTypeAlignment)
     EXPECT_GL_ERROR(GL_INVALID_OPERATION);
 }
 
+// Draws quads side by side, one per column of the window, with one glDrawElements call each.  The
+// index ranges of the quads follow each other in the index buffer, which is the pattern that
+// coalesceConsecutiveIndexedDraws binds the index buffer once for and merges.
+class DrawElementsConsecutiveRangesTest : public ANGLETest<>
+{
+  protected:
+    static constexpr GLsizei kQuadCount           = 4;
+    static constexpr GLsizei kWindowSize          = 64;
+    static constexpr GLsizei kColumnWidth         = kWindowSize / kQuadCount;
+    static constexpr GLsizei kIndicesPerQuad      = 6;
+    static constexpr GLsizei kStripIndicesPerQuad = 5;
+
+    DrawElementsConsecutiveRangesTest()
+    {
+        setWindowWidth(kWindowSize);
+        setWindowHeight(kWindowSize);
+        setConfigRedBits(8);
+        setConfigGreenBits(8);
+        setConfigBlueBits(8);
+        setConfigAlphaBits(8);
+    }
+
+    static const GLColor &QuadColor(GLsizei quad)
+    {
+        static const GLColor kColors[kQuadCount] = {GLColor::red, GLColor::green, GLColor::blue,
+                                                    GLColor::yellow};
+        return kColors[quad];
+    }
+
+    // Sets up the vertices of the quads: position at location 0 and color at location 1.  The
+    // vertices of each quad are bottom-left, bottom-right, top-left and top-right.
+    void setupQuads()
+    {
+        std::vector<GLfloat> positions;
+        std::vector<GLColor> colors;
+        for (GLsizei quad = 0; quad < kQuadCount; ++quad)
+        {
+            const GLfloat left  = -1.0f + 2.0f * quad / kQuadCount;
+            const GLfloat right = -1.0f + 2.0f * (quad + 1) / kQuadCount;
+            positions.insert(positions.end(),
+                             {left, -1.0f, right, -1.0f, left, 1.0f, right, 1.0f});
+            colors.insert(colors.end(), 4, QuadColor(quad));
+        }
+
+        glBindVertexArray(mVertexArray);
+
+        glBindBuffer(GL_ARRAY_BUFFER, mPositionBuffer);
+        glBufferData(GL_ARRAY_BUFFER, positions.size() * sizeof(positions[0]), positions.data(),
+                     GL_STATIC_DRAW);
+        glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, nullptr);
+        glEnableVertexAttribArray(0);
+
+        glBindBuffer(GL_ARRAY_BUFFER, mColorBuffer);
+        glBufferData(GL_ARRAY_BUFFER, colors.size() * sizeof(colors[0]), colors.data(),
+                     GL_STATIC_DRAW);
+        glVertexAttribPointer(1, 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, nullptr);
+        glEnableVertexAttribArray(1);
+
+        ASSERT_GL_NO_ERROR();
+    }
+
+    // Returns the triangle list indices of the given quads, in order.
+    static std::vector<GLushort> QuadIndices(const std::vector<GLsizei> &quads)
+    {
+        std::vector<GLushort> indices;
+        for (GLsizei quad : quads)
+        {
+            const GLushort first = static_cast<GLushort>(quad * 4);
+            indices.insert(indices.end(), {first, static_cast<GLushort>(first + 1),
+                                           static_cast<GLushort>(first + 2),
+                                           static_cast<GLushort>(first + 2),
+                                           static_cast<GLushort>(first + 1),
+                                           static_cast<GLushort>(first + 3)});
+        }
+        return indices;
+    }
+
+    void drawRange(GLenum mode, GLsizei count, GLsizei firstIndex)
+    {
+        glDrawElements(mode, count, GL_UNSIGNED_SHORT,
+                       reinterpret_cast<const void *>(
+                           static_cast<uintptr_t>(firstIndex * sizeof(GLushort))));
+    }
+
+    void expectColumn(GLsizei column, const GLColor &color)
+    {
+        EXPECT_PIXEL_COLOR_EQ(column * kColumnWidth + kColumnWidth / 2, kWindowSize / 2, color);
+    }
+
+    void expectColumns(const std::vector<GLColor> &colors)
+    {
+        for (GLsizei column = 0; column < kQuadCount; ++column)
+        {
+            expectColumn(column, colors[column]);
+        }
+    }
+
+    static constexpr char kVS[] = R"(#version 300 es
+layout(location = 0) in vec2 position;
+layout(location = 1) in vec4 color;
+out vec4 vColor;
+void main()
+{
+    gl_Position = vec4(position, 0, 1);
+    vColor = color;
+})";
+
+    static constexpr char kFS[] = R"(#version 300 es
+precision mediump float;
+in vec4 vColor;
+out vec4 colorOut;
+void main()
+{
+    colorOut = vColor;
+})";
+
+    GLVertexArray mVertexArray;
+    GLBuffer mPositionBuffer;
+    GLBuffer mColorBuffer;
+    GLBuffer mIndexBuffer;
+};
+
+class DrawElementsConsecutiveRangesTestES31 : public DrawElementsConsecutiveRangesTest
+{};
+
+// Test draws of adjacent index ranges, in order, out of order and with a gap.
+TEST_P(DrawElementsConsecutiveRangesTest, AdjacentOffsets)
+{
+    ANGLE_GL_PROGRAM(program, kVS, kFS);
+    glUseProgram(program);
+    setupQuads();
+
+    const std::vector<GLushort> indices = QuadIndices({0, 1, 2, 3});
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mIndexBuffer);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(indices[0]), indices.data(),
+                 GL_STATIC_DRAW);
+
+    glClearColor(0, 0, 0, 1);
+
+    // Back to back draws of every quad.
+    glClear(GL_COLOR_BUFFER_BIT);
+    for (GLsizei quad = 0; quad < kQuadCount; ++quad)
+    {
+        drawRange(GL_TRIANGLES, kIndicesPerQuad, quad * kIndicesPerQuad);
+    }
+    expectColumns({QuadColor(0), QuadColor(1), QuadColor(2), QuadColor(3)});
+
+    // A gap between the ranges.
+    glClear(GL_COLOR_BUFFER_BIT);
+    drawRange(GL_TRIANGLES, kIndicesPerQuad, 0);
+    drawRange(GL_TRIANGLES, kIndicesPerQuad, kIndicesPerQuad);
+    drawRange(GL_TRIANGLES, kIndicesPerQuad, 3 * kIndicesPerQuad);
+    expectColumns({QuadColor(0), QuadColor(1), GLColor::black, QuadColor(3)});
+
+    // Ranges in decreasing order, and a range that only covers part of a quad.
+    glClear(GL_COLOR_BUFFER_BIT);
+    drawRange(GL_TRIANGLES, kIndicesPerQuad, 2 * kIndicesPerQuad);
+    drawRange(GL_TRIANGLES, kIndicesPerQuad, kIndicesPerQuad);
+    drawRange(GL_TRIANGLES, 3, 0);
+    drawRange(GL_TRIANGLES, 3, 3);
+    expectColumns({QuadColor(0), QuadColor(1), QuadColor(2), GLColor::black});
+
+    ASSERT_GL_NO_ERROR();
+}
+
+// Test draws of adjacent index ranges with primitive restart enabled, with lists and strips.
+TEST_P(DrawElementsConsecutiveRangesTest, PrimitiveRestart)
+{
+    ANGLE_GL_PROGRAM(program, kVS, kFS);
+    glUseProgram(program);
+    setupQuads();
+
+    glEnable(GL_PRIMITIVE_RESTART_FIXED_INDEX);
+    glClearColor(0, 0, 0, 1);
+
+    // Triangle lists, where each range holds a quad followed by the restart index.
+    std::vector<GLushort> listIndices;
+    for (GLsizei quad = 0; quad < kQuadCount; ++quad)
+    {
+        const std::vector<GLushort> quadIndices = QuadIndices({quad});
+        listIndices.insert(listIndices.end(), quadIndices.begin(), quadIndices.end());
+        listIndices.push_back(0xFFFF);
+    }
+    constexpr GLsizei kListIndicesPerQuad = kIndicesPerQuad + 1;
+
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mIndexBuffer);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, listIndices.size() * sizeof(listIndices[0]),
+                 listIndices.data(), GL_STATIC_DRAW);
+
+    glClear(GL_COLOR_BUFFER_BIT);
+    for (GLsizei quad = 0; quad < kQuadCount; ++quad)
+    {
+        drawRange(GL_TRIANGLES, kListIndicesPerQuad, quad * kListIndicesPerQuad);
+    }
+    expectColumns({QuadColor(0), QuadColor(1), QuadColor(2), QuadColor(3)});
+
+    // Triangle strips, one quad per strip, separated by the restart index.  The first draw covers
+    // two strips.
+    std::vector<GLushort> stripIndices;
+    for (GLsizei quad = 0; quad < kQuadCount; ++quad)
+    {
+        const GLushort first = static_cast<GLushort>(quad * 4);
+        stripIndices.insert(stripIndices.end(),
+                            {first, static_cast<GLushort>(first + 1),
+                             static_cast<GLushort>(first + 2), static_cast<GLushort>(first + 3),
+                             0xFFFF});
+    }
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, stripIndices.size() * sizeof(stripIndices[0]),
+                 stripIndices.data(), GL_STATIC_DRAW);
+
+    glClear(GL_COLOR_BUFFER_BIT);
+    drawRange(GL_TRIANGLE_STRIP, 2 * kStripIndicesPerQuad, 0);
+    drawRange(GL_TRIANGLE_STRIP, kStripIndicesPerQuad, 2 * kStripIndicesPerQuad);
+    drawRange(GL_TRIANGLE_STRIP, kStripIndicesPerQuad, 3 * kStripIndicesPerQuad);
+    expectColumns({QuadColor(0), QuadColor(1), QuadColor(2), QuadColor(3)});
+
+    glDisable(GL_PRIMITIVE_RESTART_FIXED_INDEX);
+    ASSERT_GL_NO_ERROR();
+}
+
+// Test that the element array buffer bound between draws of adjacent ranges is used.
+TEST_P(DrawElementsConsecutiveRangesTest, IndexBufferRebound)
+{
+    ANGLE_GL_PROGRAM(program, kVS, kFS);
+    glUseProgram(program);
+    setupQuads();
+
+    const std::vector<GLushort> indices         = QuadIndices({0, 1, 2, 3});
+    const std::vector<GLushort> reversedIndices = QuadIndices({3, 2, 1, 0});
+
+    GLBuffer reversedIndexBuffer;
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, reversedIndexBuffer);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, reversedIndices.size() * sizeof(reversedIndices[0]),
+                 reversedIndices.data(), GL_STATIC_DRAW);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mIndexBuffer);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(indices[0]), indices.data(),
+                 GL_STATIC_DRAW);
+
+    glClearColor(0, 0, 0, 1);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    // The second range of the reversed buffer is the third quad.
+    drawRange(GL_TRIANGLES, kIndicesPerQuad, 0);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, reversedIndexBuffer);
+    drawRange(GL_TRIANGLES, kIndicesPerQuad, kIndicesPerQuad);
+    expectColumns({QuadColor(0), GLColor::black, QuadColor(2), GLColor::black});
+
+    // Switch back to the first buffer, where the next range is the fourth quad.
+    glClear(GL_COLOR_BUFFER_BIT);
+    drawRange(GL_TRIANGLES, kIndicesPerQuad, 2 * kIndicesPerQuad);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mIndexBuffer);
+    drawRange(GL_TRIANGLES, kIndicesPerQuad, 3 * kIndicesPerQuad);
+    expectColumns({GLColor::black, QuadColor(1), GLColor::black, QuadColor(3)});
+
+    ASSERT_GL_NO_ERROR();
+}
+
+// Test that a uniform updated between draws of adjacent ranges applies to the later draws only.
+TEST_P(DrawElementsConsecutiveRangesTest, UniformUpdate)
+{
+    constexpr char kUniformFS[] = R"(#version 300 es
+precision mediump float;
+uniform vec4 uColor;
+out vec4 colorOut;
+void main()
+{
+    colorOut = uColor;
+})";
+
+    ANGLE_GL_PROGRAM(program, kVS, kUniformFS);
+    glUseProgram(program);
+    GLint colorLocation = glGetUniformLocation(program, "uColor");
+    ASSERT_NE(-1, colorLocation);
+    setupQuads();
+
+    const std::vector<GLushort> indices = QuadIndices({0, 1, 2, 3});
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mIndexBuffer);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(indices[0]), indices.data(),
+                 GL_STATIC_DRAW);
+
+    glClearColor(0, 0, 0, 1);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    const GLColor kUniformColors[kQuadCount] = {GLColor::cyan, GLColor::magenta, GLColor::cyan,
+                                                GLColor::white};
+    for (GLsizei quad = 0; quad < kQuadCount; ++quad)
+    {
+        const Vector4 color = kUniformColors[quad].toNormalizedVector();
+        glUniform4f(colorLocation, color[0], color[1], color[2], color[3]);
+        drawRange(GL_TRIANGLES, kIndicesPerQuad, quad * kIndicesPerQuad);
+    }
+    expectColumns({kUniformColors[0], kUniformColors[1], kUniformColors[2], kUniformColors[3]});
+
+    ASSERT_GL_NO_ERROR();
+}
+
+// Test that gl_PrimitiveID restarts at zero with every draw of adjacent ranges.
+TEST_P(DrawElementsConsecutiveRangesTestES31, PrimitiveID)
+{
+    ANGLE_SKIP_TEST_IF(!IsGLExtensionEnabled("GL_EXT_geometry_shader"));
+
+    constexpr char kPrimitiveIDFS[] = R"(#version 310 es
+#extension GL_EXT_geometry_shader : require
+precision mediump float;
+out vec4 colorOut;
+void main()
+{
+    colorOut = gl_PrimitiveID == 0 ? vec4(1, 0, 0, 1)
+             : gl_PrimitiveID == 1 ? vec4(0, 1, 0, 1)
+                                   : vec4(0, 0, 1, 1);
+})";
+
+    ANGLE_GL_PROGRAM(program, kVS, kPrimitiveIDFS);
+    glUseProgram(program);
+    setupQuads();
+
+    const std::vector<GLushort> indices = QuadIndices({0, 1, 2, 3});
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mIndexBuffer);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(indices[0]), indices.data(),
+                 GL_STATIC_DRAW);
+
+    glClearColor(0, 0, 0, 1);
+    glClear(GL_COLOR_BUFFER_BIT);
+    for (GLsizei quad = 0; quad < kQuadCount; ++quad)
+    {
+        drawRange(GL_TRIANGLES, kIndicesPerQuad, quad * kIndicesPerQuad);
+    }
+
+    // In every column, the bottom-left triangle is the first primitive of its draw and the
+    // top-right triangle is the second.
+    for (GLsizei column = 0; column < kQuadCount; ++column)
+    {
+        EXPECT_PIXEL_COLOR_EQ(column * kColumnWidth + 2, 2, GLColor::red);
+        EXPECT_PIXEL_COLOR_EQ(column * kColumnWidth + kColumnWidth - 3, kWindowSize - 3,
+                              GLColor::green);
+    }
+
+    ASSERT_GL_NO_ERROR();
+}
+
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(DrawElementsTest);
 ANGLE_INSTANTIATE_TEST_ES3(DrawElementsTest);
 
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(DrawElementsConsecutiveRangesTest);
+ANGLE_INSTANTIATE_TEST_ES3_AND(DrawElementsConsecutiveRangesTest,
+                               ES3_VULKAN().enable(Feature::CoalesceConsecutiveIndexedDraws));
+
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(DrawElementsConsecutiveRangesTestES31);
+ANGLE_INSTANTIATE_TEST_ES31_AND(DrawElementsConsecutiveRangesTestES31,
+                                ES31_VULKAN().enable(Feature::CoalesceConsecutiveIndexedDraws));
+
 ANGLE_INSTANTIATE_TEST_ES2(WebGLDrawElementsTest);
 }  // namespace
@@ -4229,6 +4229,9 @@ ANGLE_INSTANTIATE_TEST(
     ES3_VULKAN_SWIFTSHADER()
         .enable(Feature::PreferMonolithicPipelinesOverLibraries)
         .disable(Feature::MergeProgramPipelineCachesToGlobalCache),
+    ES3_VULKAN_SWIFTSHADER()
+        .enable(Feature::PreferMonolithicPipelinesOverLibraries)
+        .enable(Feature::ShardGlobalPipelineCache),
     ES3_VULKAN_SWIFTSHADER().enable(Feature::PermanentlySwitchToFramebufferFetchMode),
     ES3_VULKAN_SWIFTSHADER()
         .enable(Feature::PermanentlySwitchToFramebufferFetchMode)
@@ -4253,6 +4256,9 @@ ANGLE_INSTANTIATE_TEST(
     ES3_VULKAN_SWIFTSHADER()
         .enable(Feature::PreferMonolithicPipelinesOverLibraries)
         .disable(Feature::MergeProgramPipelineCachesToGlobalCache),
+    ES3_VULKAN_SWIFTSHADER()
+        .enable(Feature::PreferMonolithicPipelinesOverLibraries)
+        .enable(Feature::ShardGlobalPipelineCache),
     ES3_VULKAN_SWIFTSHADER().enable(Feature::PermanentlySwitchToFramebufferFetchMode),
     ES3_VULKAN_SWIFTSHADER()
         .enable(Feature::PermanentlySwitchToFramebufferFetchMode)
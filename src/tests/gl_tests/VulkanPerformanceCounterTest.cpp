@@ -8252,6 +8252,49 @@ TEST_P(VulkanPerformanceCounterTest, NoUpdatesToGraphicsDriverUniformsOnProgramC
     EXPECT_EQ(program1Count, program2Count + 1);
 }
 
+// Test that consecutive draws of adjacent ranges of one index buffer are merged into one draw call.
+TEST_P(VulkanPerformanceCounterTest, ConsecutiveIndexRangesAreCoalesced)
+{
+    ANGLE_SKIP_TEST_IF(!isFeatureEnabled(Feature::CoalesceConsecutiveIndexedDraws));
+
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), essl1_shaders::fs::Red());
+    glUseProgram(program);
+    GLint positionLocation = glGetAttribLocation(program, essl1_shaders::PositionAttrib());
+    ASSERT_NE(-1, positionLocation);
+
+    // A quad covering the left half of the window followed by one covering the right half.
+    constexpr std::array<GLfloat, 16> kPositions = {
+        -1.0f, -1.0f, 0.0f, -1.0f, 0.0f, 1.0f, -1.0f, 1.0f,
+        0.0f,  -1.0f, 1.0f, -1.0f, 1.0f, 1.0f, 0.0f,  1.0f,
+    };
+    constexpr std::array<GLushort, 12> kIndices = {0, 1, 2, 0, 2, 3, 4, 5, 6, 4, 6, 7};
+
+    GLBuffer vertexBuffer;
+    glBindBuffer(GL_ARRAY_BUFFER, vertexBuffer);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(kPositions), kPositions.data(), GL_STATIC_DRAW);
+    glVertexAttribPointer(positionLocation, 2, GL_FLOAT, GL_FALSE, 0, nullptr);
+    glEnableVertexAttribArray(positionLocation);
+
+    GLBuffer indexBuffer;
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBuffer);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(kIndices), kIndices.data(), GL_STATIC_DRAW);
+
+    glClearColor(0.0f, 0.0f, 1.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    uint64_t expectedCoalescedDraws = getPerfCounters().coalescedDraws + 1;
+
+    glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_SHORT, nullptr);
+    glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_SHORT,
+                   reinterpret_cast<const void *>(6 * sizeof(GLushort)));
+    ASSERT_GL_NO_ERROR();
+
+    EXPECT_EQ(expectedCoalescedDraws, getPerfCounters().coalescedDraws);
+
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+    EXPECT_PIXEL_COLOR_EQ(getWindowWidth() - 1, getWindowHeight() - 1, GLColor::red);
+}
+
 // This is test for optimization in vulkan backend. efootball_pes_2021 usage shows this usage
 // pattern and we expect implementation to reuse the storage for performance.
 TEST_P(VulkanPerformanceCounterTest,
@@ -8372,6 +8415,7 @@ ANGLE_INSTANTIATE_TEST(
     VulkanPerformanceCounterTest,
     ES3_VULKAN(),
     ES3_VULKAN().enable(Feature::PadBuffersToMaxVertexAttribStride),
+    ES3_VULKAN().enable(Feature::CoalesceConsecutiveIndexedDraws),
     ES3_VULKAN_SWIFTSHADER().enable(Feature::PreferMonolithicPipelinesOverLibraries),
     ES3_VULKAN_SWIFTSHADER()
         .enable(Feature::PreferMonolithicPipelinesOverLibraries)
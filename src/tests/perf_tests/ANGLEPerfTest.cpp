@@ -1415,6 +1415,11 @@ void ANGLERenderTest::setRobustResourceInit(bool enabled)
     mConfigParams.robustResourceInit = enabled;
 }
 
+void ANGLERenderTest::setNoErrorEnabled(bool noError)
+{
+    mConfigParams.noError = noError;
+}
+
 std::vector<TraceEvent> &ANGLERenderTest::getTraceEventBuffer()
 {
     return mTraceEventBuffer;
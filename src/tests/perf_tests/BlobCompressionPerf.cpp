@@ -0,0 +1,192 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// BlobCompressionPerf:
+//   Performance test for decompressing program binaries stored in the blob cache, with each of the
+//   codecs supported by angle::CompressBlob.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <sstream>
+
+#include "libANGLE/angletypes.h"
+#include "util/shader_utils.h"
+
+using namespace angle;
+
+namespace
+{
+constexpr unsigned int kProgramCount = 16;
+
+struct BlobCompressionParams final : public RenderTestParams
+{
+    BlobCompressionParams()
+    {
+        iterationsPerStep = 1;
+
+        majorVersion = 3;
+        minorVersion = 0;
+        windowWidth  = 64;
+        windowHeight = 64;
+    }
+
+    std::string story() const override;
+
+    BlobCodec codec = BlobCodec::LZ;
+};
+
+std::string BlobCompressionParams::story() const
+{
+    std::stringstream storyStr;
+    storyStr << RenderTestParams::story() << (codec == BlobCodec::Deflate ? "_deflate" : "_lz");
+    return storyStr.str();
+}
+
+std::ostream &operator<<(std::ostream &os, const BlobCompressionParams &params)
+{
+    os << params.backendAndStory().substr(1);
+    return os;
+}
+
+class BlobCompressionBenchmark : public ANGLERenderTest,
+                                 public ::testing::WithParamInterface<BlobCompressionParams>
+{
+  public:
+    BlobCompressionBenchmark();
+
+    void initializeBenchmark() override;
+    void drawBenchmark() override;
+
+    void reportResults();
+
+  private:
+    std::vector<MemoryBuffer> mCompressedBinaries;
+    size_t mUncompressedSize = 0;
+    size_t mCompressedSize   = 0;
+    MemoryBuffer mUncompressedBinary;
+};
+
+BlobCompressionBenchmark::BlobCompressionBenchmark()
+    : ANGLERenderTest("BlobCompression", GetParam())
+{
+    addExtensionPrerequisite("GL_OES_get_program_binary");
+
+    mReporter->RegisterImportantMetric(".compression_ratio", "ratio");
+    mReporter->RegisterImportantMetric(".decode_throughput", "MB/s");
+}
+
+void BlobCompressionBenchmark::initializeBenchmark()
+{
+    // Link programs of increasing size, so that the binaries hold a representative mix of
+    // uniforms, varyings and translated shader source.
+    for (unsigned int programIndex = 0; programIndex < kProgramCount; ++programIndex)
+    {
+        const unsigned int uniformCount = 4 + programIndex * 4;
+
+        std::stringstream vs;
+        vs << "#version 300 es\n"
+              "in vec4 aPosition;\n"
+              "out vec4 vColor;\n"
+              "uniform vec4 uOffset["
+           << uniformCount
+           << "];\n"
+              "void main()\n"
+              "{\n"
+              "    vec4 sum = vec4(0);\n"
+              "    for (int i = 0; i < "
+           << uniformCount
+           << "; ++i)\n"
+              "    {\n"
+              "        sum += uOffset[i] * float(i);\n"
+              "    }\n"
+              "    vColor      = sum;\n"
+              "    gl_Position = aPosition + sum;\n"
+              "}\n";
+
+        std::stringstream fs;
+        fs << "#version 300 es\n"
+              "precision highp float;\n"
+              "in vec4 vColor;\n"
+              "out vec4 color;\n"
+              "uniform sampler2D uTextures["
+           << (1 + programIndex % 8)
+           << "];\n"
+              "void main()\n"
+              "{\n"
+              "    color = vColor;\n";
+        for (unsigned int i = 0; i < 1 + programIndex % 8; ++i)
+        {
+            fs << "    color += texture(uTextures[" << i << "], vColor.xy * " << (i + 1)
+               << ".0);\n";
+        }
+        fs << "}\n";
+
+        GLuint program = CompileProgram(vs.str().c_str(), fs.str().c_str());
+        ASSERT_NE(0u, program);
+
+        GLint binaryLength = 0;
+        glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH_OES, &binaryLength);
+        ASSERT_GT(binaryLength, 0);
+
+        std::vector<uint8_t> binary(binaryLength);
+        GLenum binaryFormat = GL_NONE;
+        glGetProgramBinaryOES(program, binaryLength, nullptr, &binaryFormat, binary.data());
+        glDeleteProgram(program);
+        ASSERT_GL_NO_ERROR();
+
+        MemoryBuffer compressed;
+        ASSERT_TRUE(CompressBlob(binary.size(), binary.data(), GetParam().codec, &compressed));
+
+        mUncompressedSize += binary.size();
+        mCompressedSize += compressed.size();
+        mCompressedBinaries.push_back(std::move(compressed));
+    }
+}
+
+void BlobCompressionBenchmark::drawBenchmark()
+{
+    for (const MemoryBuffer &compressed : mCompressedBinaries)
+    {
+        ASSERT_TRUE(DecompressBlob(compressed.data(), compressed.size(),
+                                   std::numeric_limits<size_t>::max(), &mUncompressedBinary));
+    }
+}
+
+void BlobCompressionBenchmark::reportResults()
+{
+    if (mCompressedSize == 0 || mTrialNumStepsPerformed == 0)
+    {
+        return;
+    }
+
+    recordDoubleMetric(".compression_ratio",
+                       static_cast<double>(mUncompressedSize) / mCompressedSize, "ratio");
+
+    const double bytesDecoded = static_cast<double>(mUncompressedSize) * mTrialNumStepsPerformed;
+    const double seconds      = mTrialTimer.getElapsedWallClockTime();
+    recordDoubleMetric(".decode_throughput", bytesDecoded / seconds / 1e6, "MB/s");
+}
+
+// Measures the compression ratio and decompression speed of serialized program executables.
+TEST_P(BlobCompressionBenchmark, Run)
+{
+    run();
+    reportResults();
+}
+
+BlobCompressionParams VulkanParams(BlobCodec codec)
+{
+    BlobCompressionParams params;
+    params.eglParameters = egl_platform::VULKAN_NULL();
+    params.codec         = codec;
+    return params;
+}
+
+ANGLE_INSTANTIATE_TEST(BlobCompressionBenchmark,
+                       VulkanParams(BlobCodec::Deflate),
+                       VulkanParams(BlobCodec::LZ));
+
+}  // anonymous namespace
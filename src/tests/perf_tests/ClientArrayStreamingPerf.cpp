@@ -0,0 +1,215 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// ClientArrayStreamingPerf:
+//   Performance test for draws that source many interleaved attributes from client memory, which
+//   the back-end has to copy (and possibly convert) into its own buffers on every draw call.
+//
+
+#include <sstream>
+
+#include "ANGLEPerfTest.h"
+#include "util/shader_utils.h"
+
+using namespace angle;
+
+namespace
+{
+// Position (3 floats), normal (3 normalized bytes, padded to 4), color (4 normalized unsigned
+// bytes) and texture coordinates (2 normalized shorts).
+struct Vertex
+{
+    GLfloat position[3];
+    GLbyte normal[4];
+    GLubyte color[4];
+    GLshort texCoord[2];
+};
+
+struct ClientArrayStreamingParams final : public RenderTestParams
+{
+    ClientArrayStreamingParams()
+    {
+        iterationsPerStep = 1;
+
+        majorVersion = 2;
+        minorVersion = 0;
+        windowWidth  = 64;
+        windowHeight = 64;
+    }
+
+    std::string story() const override;
+
+    unsigned int numVertices = 256 * 1024;
+    bool parallelStreaming   = true;
+};
+
+std::string ClientArrayStreamingParams::story() const
+{
+    std::stringstream storyStr;
+    storyStr << RenderTestParams::story() << "_" << (numVertices / 1024) << "k_vertices";
+    if (eglParameters.renderer == EGL_PLATFORM_ANGLE_TYPE_VULKAN_ANGLE)
+    {
+        storyStr << (parallelStreaming ? "_parallel" : "_serial");
+    }
+    return storyStr.str();
+}
+
+std::ostream &operator<<(std::ostream &os, const ClientArrayStreamingParams &params)
+{
+    os << params.backendAndStory().substr(1);
+    return os;
+}
+
+class ClientArrayStreamingBenchmark
+    : public ANGLERenderTest,
+      public ::testing::WithParamInterface<ClientArrayStreamingParams>
+{
+  public:
+    ClientArrayStreamingBenchmark();
+
+    void initializeBenchmark() override;
+    void destroyBenchmark() override;
+    void drawBenchmark() override;
+
+  private:
+    GLuint mProgram = 0;
+    std::vector<Vertex> mVertices;
+};
+
+ClientArrayStreamingBenchmark::ClientArrayStreamingBenchmark()
+    : ANGLERenderTest("ClientArrayStreaming", GetParam())
+{}
+
+void ClientArrayStreamingBenchmark::initializeBenchmark()
+{
+    const auto &params = GetParam();
+
+    // Every attribute contributes to the output so that none of them can be optimized out.
+    constexpr char kVS[] =
+        "attribute vec3 aPosition;"
+        "attribute vec3 aNormal;"
+        "attribute vec4 aColor;"
+        "attribute vec2 aTexCoord;"
+        "varying vec4 vColor;"
+        "void main()"
+        "{"
+        "    gl_PointSize = 1.0;"
+        "    gl_Position  = vec4(aPosition, 1.0);"
+        "    vColor = aColor * vec4(aNormal, 1.0) + vec4(aTexCoord, 0.0, 0.0);"
+        "}";
+
+    constexpr char kFS[] =
+        "precision mediump float;"
+        "varying vec4 vColor;"
+        "void main()"
+        "{"
+        "    gl_FragColor = vColor;"
+        "}";
+
+    mProgram = CompileProgram(kVS, kFS);
+    ASSERT_NE(0u, mProgram);
+    glUseProgram(mProgram);
+
+    mVertices.resize(params.numVertices);
+    for (size_t i = 0; i < mVertices.size(); ++i)
+    {
+        Vertex &vertex     = mVertices[i];
+        vertex.position[0] = static_cast<float>(rand() % 2048) / 1024.0f - 1.0f;
+        vertex.position[1] = static_cast<float>(rand() % 2048) / 1024.0f - 1.0f;
+        vertex.position[2] = 0.0f;
+        for (size_t j = 0; j < 4; ++j)
+        {
+            vertex.normal[j] = static_cast<GLbyte>(rand() % 255 - 127);
+            vertex.color[j]  = static_cast<GLubyte>(rand() % 255);
+        }
+        vertex.texCoord[0] = static_cast<GLshort>(rand() % 32767);
+        vertex.texCoord[1] = static_cast<GLshort>(rand() % 32767);
+    }
+
+    const GLsizei stride = static_cast<GLsizei>(sizeof(Vertex));
+    const Vertex *data   = mVertices.data();
+
+    GLint positionLocation = glGetAttribLocation(mProgram, "aPosition");
+    GLint normalLocation   = glGetAttribLocation(mProgram, "aNormal");
+    GLint colorLocation    = glGetAttribLocation(mProgram, "aColor");
+    GLint texCoordLocation = glGetAttribLocation(mProgram, "aTexCoord");
+    ASSERT_NE(-1, positionLocation);
+    ASSERT_NE(-1, normalLocation);
+    ASSERT_NE(-1, colorLocation);
+    ASSERT_NE(-1, texCoordLocation);
+
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glVertexAttribPointer(positionLocation, 3, GL_FLOAT, GL_FALSE, stride, data->position);
+    glVertexAttribPointer(normalLocation, 3, GL_BYTE, GL_TRUE, stride, data->normal);
+    glVertexAttribPointer(colorLocation, 4, GL_UNSIGNED_BYTE, GL_TRUE, stride, data->color);
+    glVertexAttribPointer(texCoordLocation, 2, GL_SHORT, GL_TRUE, stride, data->texCoord);
+    glEnableVertexAttribArray(positionLocation);
+    glEnableVertexAttribArray(normalLocation);
+    glEnableVertexAttribArray(colorLocation);
+    glEnableVertexAttribArray(texCoordLocation);
+
+    glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+
+    ASSERT_GL_NO_ERROR();
+}
+
+void ClientArrayStreamingBenchmark::destroyBenchmark()
+{
+    glDeleteProgram(mProgram);
+}
+
+void ClientArrayStreamingBenchmark::drawBenchmark()
+{
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    // Each draw call streams the whole client arrays again.
+    for (size_t k = 0; k < 4; k++)
+    {
+        glDrawArrays(GL_POINTS, 0, GetParam().numVertices);
+    }
+
+    ASSERT_GL_NO_ERROR();
+}
+
+TEST_P(ClientArrayStreamingBenchmark, Run)
+{
+    run();
+}
+
+ClientArrayStreamingParams VulkanParams(unsigned int numVertices, bool parallelStreaming)
+{
+    ClientArrayStreamingParams params;
+    params.numVertices       = numVertices;
+    params.parallelStreaming = parallelStreaming;
+    params.eglParameters     = egl_platform::VULKAN();
+    if (parallelStreaming)
+    {
+        params.eglParameters.enable(Feature::EnableParallelClientAttribStreaming);
+    }
+    else
+    {
+        params.eglParameters.disable(Feature::EnableParallelClientAttribStreaming);
+    }
+    return params;
+}
+
+ClientArrayStreamingParams OpenGLOrGLESParams(unsigned int numVertices)
+{
+    ClientArrayStreamingParams params;
+    params.numVertices   = numVertices;
+    params.eglParameters = egl_platform::OPENGL_OR_GLES();
+    return params;
+}
+
+ANGLE_INSTANTIATE_TEST(ClientArrayStreamingBenchmark,
+                       VulkanParams(16 * 1024, false),
+                       VulkanParams(16 * 1024, true),
+                       VulkanParams(256 * 1024, false),
+                       VulkanParams(256 * 1024, true),
+                       VulkanParams(1024 * 1024, false),
+                       VulkanParams(1024 * 1024, true),
+                       OpenGLOrGLESParams(256 * 1024));
+
+}  // anonymous namespace
@@ -12,9 +12,20 @@
 #include "ANGLEPerfTest.h"
 
 #include "GLSLANG/ShaderLang.h"
+#include "compiler/translator/BuiltInFunctionEmulator.h"
 #include "compiler/translator/Compiler.h"
+#include "compiler/translator/Diagnostics.h"
+#include "compiler/translator/Initialize.h"
 #include "compiler/translator/InitializeGlobals.h"
 #include "compiler/translator/PoolAlloc.h"
+#include "compiler/translator/ValidateOutputs.h"
+#include "compiler/translator/ValidateTypeSizeLimitations.h"
+#include "compiler/translator/ValidateVaryingLocations.h"
+#include "compiler/translator/tree_ops/PruneEmptyCases.h"
+#include "compiler/translator/tree_util/FusedTraverser.h"
+#include "compiler/translator/tree_util/IntermTraverse.h"
+
+#include <sstream>
 
 namespace
 {
@@ -258,6 +269,7 @@ class CompilerPerfTest : public ANGLEPerfTest,
     const char *mTestShader;
 
     ShBuiltInResources mResources;
+    sh::TExtensionBehavior mExtensionBehavior;
     angle::PoolAllocator mAllocator;
     sh::TCompiler *mTranslator;
 };
@@ -345,4 +357,662 @@ ANGLE_INSTANTIATE_TEST(
     CompilerPerfParameters(SH_ESSL_OUTPUT, kRealWorldESSL100FragSource, kRealWorldESSL100Id),
     CompilerPerfParameters(SH_ESSL_OUTPUT, kTrickyESSL300FragSource, kTrickyESSL300Id));
 
+
+// Generates a large shader made of many functions, as is typical of uber-shaders.
+std::string MakeLargeESSL300FragSource(int functionCount)
+{
+    std::stringstream source;
+    source << R"(#version 300 es
+precision highp float;
+uniform int ui;
+uniform vec4 uColors[16];
+uniform sampler2D uTexture;
+in vec2 vTexCoord;
+out vec4 my_FragColor;
+)";
+    for (int i = 0; i < functionCount; ++i)
+    {
+        source << "vec4 f" << i << "(vec4 v)\n"
+               << R"({
+    vec4 result = v;
+    float values[4] = float[4](v.x, v.y, v.z, v.w);
+    for (int j = 0; j < 4; ++j)
+    {
+        result += uColors[(ui + j) % 16] * values[j];
+    }
+    switch (ui)
+    {
+      case 0:
+        result.xy = sin(result.yx);
+        break;
+      case 1:
+        result = texture(uTexture, vTexCoord * result.xy);
+        break;
+      default:
+        result = clamp(result, 0.0, 1.0);
+    }
+    return result;
+}
+)";
+    }
+    source << "void main()\n{\n    vec4 color = vec4(0);\n";
+    for (int i = 0; i < functionCount; ++i)
+    {
+        source << "    color = f" << i << "(color);\n";
+    }
+    source << "    my_FragColor = color;\n}\n";
+    return source.str();
+}
+
+// Measures the passes that TCompiler runs in fused walks of the AST, grouped as in
+// TCompiler::checkAndSimplifyAST().  The separate mode walks the tree once per pass and reports
+// the time of each pass.
+class CompilerPassFusionPerfTest : public ANGLEPerfTest, public ::testing::WithParamInterface<bool>
+{
+  public:
+    CompilerPassFusionPerfTest();
+
+    void step() override;
+
+    void SetUp() override;
+    void TearDown() override;
+
+    void reportPassTimes();
+
+  private:
+    enum Pass
+    {
+        // Fused in the interface validation walk.
+        kValidateVaryingLocations,
+        kValidateOutputs,
+        // Fused in the walk after RemoveUnreferencedVariables.
+        kValidateTypeSizeLimitations,
+        kEmulateBuiltInFunctions,
+        kPruneEmptyCases,
+        kPassCount,
+    };
+
+    void addPass(Pass pass, sh::TFusedTraverser *fusedTraverser, sh::TDiagnostics *diagnostics);
+
+    std::string mShaderSource;
+    ShBuiltInResources mResources;
+    sh::TExtensionBehavior mExtensionBehavior;
+    angle::PoolAllocator mAllocator;
+    sh::TCompiler *mTranslator = nullptr;
+    sh::TIntermBlock *mRoot    = nullptr;
+
+    sh::TInfoSinkBase mInfoSink;
+    sh::BuiltInFunctionEmulator mBuiltInFunctionEmulator;
+
+    double mPassTimes[kPassCount] = {};
+};
+
+CompilerPassFusionPerfTest::CompilerPassFusionPerfTest()
+    : ANGLEPerfTest("CompilerPassFusionPerf",
+                    "",
+                    GetParam() ? "Fused" : "Separate",
+                    kNumIterationsPerStep)
+{}
+
+void CompilerPassFusionPerfTest::SetUp()
+{
+    ANGLEPerfTest::SetUp();
+
+    InitializePoolIndex();
+    mAllocator.push();
+    SetGlobalPoolAllocator(&mAllocator);
+
+    mTranslator = sh::ConstructCompiler(GL_FRAGMENT_SHADER, SH_GLES3_1_SPEC, SH_ESSL_OUTPUT);
+    sh::InitBuiltInResources(&mResources);
+    mResources.FragmentPrecisionHigh = true;
+    if (!mTranslator->Init(mResources))
+    {
+        SafeDelete(mTranslator);
+        return;
+    }
+
+    sh::InitExtensionBehavior(mResources, mExtensionBehavior);
+
+    // The varying locations are only validated in ESSL 3.10 shaders.
+    mShaderSource = MakeLargeESSL300FragSource(200);
+    mShaderSource.replace(mShaderSource.find("300 es"), 6, "310 es");
+    const char *shaderStrings[] = {mShaderSource.c_str()};
+
+    ShCompileOptions compileOptions = {};
+    mRoot = mTranslator->compileTreeForTesting(shaderStrings, 1, compileOptions);
+}
+
+void CompilerPassFusionPerfTest::TearDown()
+{
+    SafeDelete(mTranslator);
+
+    SetGlobalPoolAllocator(nullptr);
+    mAllocator.pop();
+
+    FreePoolIndex();
+
+    ANGLEPerfTest::TearDown();
+}
+
+void CompilerPassFusionPerfTest::addPass(Pass pass,
+                                         sh::TFusedTraverser *fusedTraverser,
+                                         sh::TDiagnostics *diagnostics)
+{
+    switch (pass)
+    {
+        case kValidateVaryingLocations:
+            sh::ValidateVaryingLocations(fusedTraverser, diagnostics, GL_FRAGMENT_SHADER);
+            break;
+        case kValidateOutputs:
+            sh::ValidateOutputs(fusedTraverser, mExtensionBehavior, mResources, false, false,
+                                diagnostics);
+            break;
+        case kValidateTypeSizeLimitations:
+            sh::ValidateTypeSizeLimitations(fusedTraverser, &mTranslator->getSymbolTable(),
+                                            diagnostics);
+            break;
+        case kEmulateBuiltInFunctions:
+            mBuiltInFunctionEmulator.markBuiltInFunctionsForEmulation(fusedTraverser);
+            break;
+        case kPruneEmptyCases:
+            sh::PruneEmptyCases(fusedTraverser);
+            break;
+        default:
+            UNREACHABLE();
+            break;
+    }
+}
+
+void CompilerPassFusionPerfTest::step()
+{
+    if (mRoot == nullptr)
+    {
+        abortTest();
+        FAIL() << "Compiling perf test shader failed";
+    }
+
+    sh::TDiagnostics diagnostics(mInfoSink);
+
+    for (unsigned int iteration = 0; iteration < kNumIterationsPerStep; ++iteration)
+    {
+        if (GetParam())
+        {
+            sh::TFusedTraverser validateInterface;
+            addPass(kValidateVaryingLocations, &validateInterface, &diagnostics);
+            addPass(kValidateOutputs, &validateInterface, &diagnostics);
+            ASSERT_TRUE(validateInterface.run(mTranslator, mRoot));
+
+            sh::TFusedTraverser fusedTraverser;
+            addPass(kValidateTypeSizeLimitations, &fusedTraverser, &diagnostics);
+            addPass(kEmulateBuiltInFunctions, &fusedTraverser, &diagnostics);
+            addPass(kPruneEmptyCases, &fusedTraverser, &diagnostics);
+            ASSERT_TRUE(fusedTraverser.run(mTranslator, mRoot));
+            continue;
+        }
+
+        // Each pass is run through its own fused traverser so that the same code is measured.
+        for (int pass = 0; pass < kPassCount; ++pass)
+        {
+            Timer timer;
+            timer.start();
+
+            sh::TFusedTraverser fusedTraverser;
+            addPass(static_cast<Pass>(pass), &fusedTraverser, &diagnostics);
+            ASSERT_TRUE(fusedTraverser.run(mTranslator, mRoot));
+
+            timer.stop();
+            mPassTimes[pass] += timer.getElapsedWallClockTime();
+        }
+    }
+}
+
+void CompilerPassFusionPerfTest::reportPassTimes()
+{
+    if (GetParam() || mTrialNumStepsPerformed == 0)
+    {
+        return;
+    }
+
+    constexpr const char *kPassMetrics[kPassCount] = {
+        ".validate_varying_locations_time",
+        ".validate_outputs_time",
+        ".validate_type_size_limitations_time",
+        ".emulate_built_in_functions_time",
+        ".prune_empty_cases_time",
+    };
+
+    // Note that the times accumulate over all trials, as do the steps.
+    const double iterations = static_cast<double>(mTotalNumStepsPerformed) * kNumIterationsPerStep;
+    for (int pass = 0; pass < kPassCount; ++pass)
+    {
+        recordDoubleMetric(kPassMetrics[pass], mPassTimes[pass] / iterations * 1e6, "us");
+    }
+}
+
+TEST_P(CompilerPassFusionPerfTest, Run)
+{
+    run();
+    reportPassTimes();
+}
+
+INSTANTIATE_TEST_SUITE_P(,
+                         CompilerPassFusionPerfTest,
+                         ::testing::Bool(),
+                         [](const ::testing::TestParamInfo<bool> &info) {
+                             return info.param ? "Fused" : "Separate";
+                         });
+
+#if defined(ANGLE_ENABLE_VULKAN)
+// Generates a shader whose functions are specialized through constant locals, as is typical of
+// uber-shaders that select features with #defines turned into constants.
+std::string MakeSpecializedESSL300FragSource(int functionCount)
+{
+    std::stringstream source;
+    source << R"(#version 300 es
+precision highp float;
+uniform vec4 uColor;
+uniform vec4 uDebugColor;
+out vec4 my_FragColor;
+)";
+    for (int i = 0; i < functionCount; ++i)
+    {
+        source << "vec4 f" << i << "(vec4 v)\n"
+               << R"({
+    bool debugEnabled = false;
+    float scale = 0.5;
+    vec4 color = uColor;
+    vec4 result = v * scale + color;
+    if (debugEnabled)
+    {
+        result = mix(result, uDebugColor, scale);
+    }
+    while (debugEnabled)
+    {
+        result += uDebugColor;
+    }
+    return result;
+}
+)";
+    }
+    source << "void main()\n{\n    vec4 color = vec4(0);\n";
+    for (int i = 0; i < functionCount; ++i)
+    {
+        source << "    color = f" << i << "(color);\n";
+    }
+    source << "    my_FragColor = color;\n}\n";
+    return source.str();
+}
+
+// Measures the SPIR-V generation of a specialized shader with and without
+// ShCompileOptions::optimizeAST, and reports the size of the generated SPIR-V.
+class CompilerOptimizeASTPerfTest : public ANGLEPerfTest, public ::testing::WithParamInterface<bool>
+{
+  public:
+    CompilerOptimizeASTPerfTest();
+
+    void step() override;
+
+    void SetUp() override;
+    void TearDown() override;
+
+    void reportSpirvSize();
+
+  private:
+    std::string mShaderSource;
+    angle::PoolAllocator mAllocator;
+    sh::TCompiler *mTranslator = nullptr;
+};
+
+CompilerOptimizeASTPerfTest::CompilerOptimizeASTPerfTest()
+    : ANGLEPerfTest("CompilerOptimizeASTPerf",
+                    "",
+                    GetParam() ? "Optimized" : "NotOptimized",
+                    kNumIterationsPerStep)
+{}
+
+void CompilerOptimizeASTPerfTest::SetUp()
+{
+    ANGLEPerfTest::SetUp();
+
+    InitializePoolIndex();
+    mAllocator.push();
+    SetGlobalPoolAllocator(&mAllocator);
+
+    mTranslator =
+        sh::ConstructCompiler(GL_FRAGMENT_SHADER, SH_GLES3_SPEC, SH_SPIRV_VULKAN_OUTPUT);
+    ShBuiltInResources resources;
+    sh::InitBuiltInResources(&resources);
+    resources.FragmentPrecisionHigh = true;
+    if (!mTranslator->Init(resources))
+    {
+        SafeDelete(mTranslator);
+    }
+
+    mShaderSource = MakeSpecializedESSL300FragSource(100);
+}
+
+void CompilerOptimizeASTPerfTest::TearDown()
+{
+    SafeDelete(mTranslator);
+
+    SetGlobalPoolAllocator(nullptr);
+    mAllocator.pop();
+
+    FreePoolIndex();
+
+    ANGLEPerfTest::TearDown();
+}
+
+void CompilerOptimizeASTPerfTest::step()
+{
+    if (mTranslator == nullptr)
+    {
+        abortTest();
+        FAIL() << "Initializing the compiler failed";
+    }
+
+    ShCompileOptions compileOptions = {};
+    compileOptions.objectCode       = true;
+    compileOptions.optimizeAST      = GetParam();
+
+    const char *shaderStrings[] = {mShaderSource.c_str()};
+    for (unsigned int iteration = 0; iteration < kNumIterationsPerStep; ++iteration)
+    {
+        ASSERT_TRUE(mTranslator->compile(shaderStrings, 1, compileOptions));
+    }
+}
+
+void CompilerOptimizeASTPerfTest::reportSpirvSize()
+{
+    if (mTranslator == nullptr)
+    {
+        return;
+    }
+
+    // Skip the header, then count the instructions by the word count in their first word.
+    constexpr size_t kHeaderWordCount = 5;
+    const sh::BinaryBlob &spirv       = mTranslator->getInfoSink().obj.getBinary();
+    size_t instructionCount           = 0;
+    for (size_t wordIndex = kHeaderWordCount; wordIndex < spirv.size();
+         wordIndex += spirv[wordIndex] >> 16)
+    {
+        ASSERT_NE(0u, spirv[wordIndex] >> 16);
+        ++instructionCount;
+    }
+
+    recordIntegerMetric(".spirv_words", spirv.size(), "count");
+    recordIntegerMetric(".spirv_instructions", instructionCount, "count");
+}
+
+TEST_P(CompilerOptimizeASTPerfTest, Run)
+{
+    run();
+    reportSpirvSize();
+}
+
+INSTANTIATE_TEST_SUITE_P(,
+                         CompilerOptimizeASTPerfTest,
+                         ::testing::Bool(),
+                         [](const ::testing::TestParamInfo<bool> &info) {
+                             return info.param ? "Optimized" : "NotOptimized";
+                         });
+#endif  // defined(ANGLE_ENABLE_VULKAN)
+
+// Measures a bare walk over the AST of a large shader.  The traverser visits every node without
+// doing any work, so the time is spent on dispatching on the nodes and following child pointers.
+class CompilerTraversalPerfTest : public ANGLEPerfTest
+{
+  public:
+    CompilerTraversalPerfTest();
+
+    void step() override;
+
+    void SetUp() override;
+    void TearDown() override;
+
+  private:
+    class NodeCounter : public sh::TIntermTraverser
+    {
+      public:
+        NodeCounter() : sh::TIntermTraverser(true, false, false) {}
+
+        void visitSymbol(sh::TIntermSymbol *node) override { ++mNodeCount; }
+        void visitConstantUnion(sh::TIntermConstantUnion *node) override { ++mNodeCount; }
+        void visitFunctionPrototype(sh::TIntermFunctionPrototype *node) override { ++mNodeCount; }
+        bool visitSwizzle(sh::Visit visit, sh::TIntermSwizzle *node) override { return count(); }
+        bool visitBinary(sh::Visit visit, sh::TIntermBinary *node) override { return count(); }
+        bool visitUnary(sh::Visit visit, sh::TIntermUnary *node) override { return count(); }
+        bool visitTernary(sh::Visit visit, sh::TIntermTernary *node) override { return count(); }
+        bool visitIfElse(sh::Visit visit, sh::TIntermIfElse *node) override { return count(); }
+        bool visitSwitch(sh::Visit visit, sh::TIntermSwitch *node) override { return count(); }
+        bool visitCase(sh::Visit visit, sh::TIntermCase *node) override { return count(); }
+        bool visitFunctionDefinition(sh::Visit visit, sh::TIntermFunctionDefinition *node) override
+        {
+            return count();
+        }
+        bool visitAggregate(sh::Visit visit, sh::TIntermAggregate *node) override
+        {
+            return count();
+        }
+        bool visitBlock(sh::Visit visit, sh::TIntermBlock *node) override { return count(); }
+        bool visitDeclaration(sh::Visit visit, sh::TIntermDeclaration *node) override
+        {
+            return count();
+        }
+        bool visitLoop(sh::Visit visit, sh::TIntermLoop *node) override { return count(); }
+        bool visitBranch(sh::Visit visit, sh::TIntermBranch *node) override { return count(); }
+
+        size_t getNodeCount() const { return mNodeCount; }
+
+      private:
+        bool count()
+        {
+            ++mNodeCount;
+            return true;
+        }
+
+        size_t mNodeCount = 0;
+    };
+
+    std::string mShaderSource;
+    angle::PoolAllocator mAllocator;
+    sh::TCompiler *mTranslator = nullptr;
+    sh::TIntermBlock *mRoot    = nullptr;
+    size_t mNodeCount          = 0;
+};
+
+CompilerTraversalPerfTest::CompilerTraversalPerfTest()
+    : ANGLEPerfTest("CompilerTraversalPerf", "", "ManyFunctionsESSL300", kNumIterationsPerStep)
+{}
+
+void CompilerTraversalPerfTest::SetUp()
+{
+    ANGLEPerfTest::SetUp();
+
+    InitializePoolIndex();
+    mAllocator.push();
+    SetGlobalPoolAllocator(&mAllocator);
+
+    mTranslator = sh::ConstructCompiler(GL_FRAGMENT_SHADER, SH_GLES3_SPEC, SH_ESSL_OUTPUT);
+    ShBuiltInResources resources;
+    sh::InitBuiltInResources(&resources);
+    resources.FragmentPrecisionHigh = true;
+    if (!mTranslator->Init(resources))
+    {
+        SafeDelete(mTranslator);
+        return;
+    }
+
+    mShaderSource               = MakeLargeESSL300FragSource(200);
+    const char *shaderStrings[] = {mShaderSource.c_str()};
+
+    ShCompileOptions compileOptions = {};
+    mRoot = mTranslator->compileTreeForTesting(shaderStrings, 1, compileOptions);
+}
+
+void CompilerTraversalPerfTest::TearDown()
+{
+    SafeDelete(mTranslator);
+
+    SetGlobalPoolAllocator(nullptr);
+    mAllocator.pop();
+
+    FreePoolIndex();
+
+    ANGLEPerfTest::TearDown();
+}
+
+void CompilerTraversalPerfTest::step()
+{
+    if (mRoot == nullptr)
+    {
+        abortTest();
+        FAIL() << "Compiling perf test shader failed";
+    }
+
+    for (unsigned int iteration = 0; iteration < kNumIterationsPerStep; ++iteration)
+    {
+        NodeCounter counter;
+        mRoot->traverse(&counter);
+        ASSERT_TRUE(mNodeCount == 0 || mNodeCount == counter.getNodeCount());
+        mNodeCount = counter.getNodeCount();
+    }
+}
+
+TEST_F(CompilerTraversalPerfTest, Run)
+{
+    run();
+}
+
+// Measures the latency of getting a new compiler to its first compiled shader, which is paid by
+// every context and by every worker thread of parallel shader compilation.  Another compiler with
+// the same resources is kept alive throughout, as is the case when the application has other
+// contexts.
+class CompilerConstructionPerfTest : public ANGLEPerfTest,
+                                     public ::testing::WithParamInterface<CompilerParameters>
+{
+  public:
+    CompilerConstructionPerfTest();
+
+    void step() override;
+
+    void SetUp() override;
+    void TearDown() override;
+
+    void reportLatencies();
+
+  private:
+    sh::TCompiler *constructCompiler();
+
+    ShBuiltInResources mResources;
+    angle::PoolAllocator mAllocator;
+    sh::TCompiler *mKeepAliveTranslator = nullptr;
+
+    double mConstructionTime = 0;
+    double mFirstCompileTime = 0;
+};
+
+CompilerConstructionPerfTest::CompilerConstructionPerfTest()
+    : ANGLEPerfTest("CompilerConstructionPerf", "", GetParam().str(), kNumIterationsPerStep)
+{}
+
+void CompilerConstructionPerfTest::SetUp()
+{
+    ANGLEPerfTest::SetUp();
+
+    InitializePoolIndex();
+    mAllocator.push();
+    SetGlobalPoolAllocator(&mAllocator);
+
+    sh::InitBuiltInResources(&mResources);
+    mResources.FragmentPrecisionHigh = true;
+
+    mKeepAliveTranslator = constructCompiler();
+}
+
+void CompilerConstructionPerfTest::TearDown()
+{
+    SafeDelete(mKeepAliveTranslator);
+
+    SetGlobalPoolAllocator(nullptr);
+    mAllocator.pop();
+
+    FreePoolIndex();
+
+    ANGLEPerfTest::TearDown();
+}
+
+sh::TCompiler *CompilerConstructionPerfTest::constructCompiler()
+{
+    sh::TCompiler *translator =
+        sh::ConstructCompiler(GL_FRAGMENT_SHADER, SH_WEBGL2_SPEC, GetParam().output);
+    if (translator != nullptr && !translator->Init(mResources))
+    {
+        SafeDelete(translator);
+    }
+    return translator;
+}
+
+void CompilerConstructionPerfTest::step()
+{
+    if (mKeepAliveTranslator == nullptr)
+    {
+        abortTest();
+        FAIL() << "Constructing the compiler failed";
+    }
+
+    const char *shaderStrings[] = {kRealWorldESSL100FragSource};
+
+    ShCompileOptions compileOptions              = {};
+    compileOptions.objectCode                    = true;
+    compileOptions.initializeUninitializedLocals = true;
+    compileOptions.initOutputVariables           = true;
+
+    for (unsigned int iteration = 0; iteration < kNumIterationsPerStep; ++iteration)
+    {
+        Timer constructionTimer;
+        constructionTimer.start();
+        sh::TCompiler *translator = constructCompiler();
+        constructionTimer.stop();
+        ASSERT_NE(nullptr, translator);
+
+        Timer compileTimer;
+        compileTimer.start();
+        const bool compiled = translator->compile(shaderStrings, 1, compileOptions);
+        compileTimer.stop();
+        SafeDelete(translator);
+        ASSERT_TRUE(compiled);
+
+        mConstructionTime += constructionTimer.getElapsedWallClockTime();
+        mFirstCompileTime += compileTimer.getElapsedWallClockTime();
+    }
+}
+
+void CompilerConstructionPerfTest::reportLatencies()
+{
+    if (mTotalNumStepsPerformed == 0)
+    {
+        return;
+    }
+
+    // Note that the times accumulate over all trials, as do the steps.
+    const double iterations = static_cast<double>(mTotalNumStepsPerformed) * kNumIterationsPerStep;
+    recordDoubleMetric(".construction_time", mConstructionTime / iterations * 1e6, "us");
+    recordDoubleMetric(".first_compile_time", mFirstCompileTime / iterations * 1e6, "us");
+}
+
+TEST_P(CompilerConstructionPerfTest, Run)
+{
+    run();
+    reportLatencies();
+}
+
+INSTANTIATE_TEST_SUITE_P(,
+                         CompilerConstructionPerfTest,
+                         ::testing::Values(CompilerParameters(SH_GLSL_450_CORE_OUTPUT),
+                                           CompilerParameters(SH_ESSL_OUTPUT)),
+                         [](const ::testing::TestParamInfo<CompilerParameters> &info) {
+                             return std::string(info.param.str());
+                         });
+
 }  // anonymous namespace
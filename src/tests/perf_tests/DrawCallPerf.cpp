@@ -44,6 +44,10 @@ struct DrawArraysPerfParams : public DrawCallPerfParams
     std::string story() const override;
 
     StateChange stateChange = StateChange::NoChange;
+
+    // Creates the context with KHR_create_context_no_error, which skips validation.  The
+    // difference with the same story without "_no_error" is the cost of draw call validation.
+    bool noError = false;
 };
 
 std::string DrawArraysPerfParams::story() const
@@ -85,6 +89,11 @@ std::string DrawArraysPerfParams::story() const
             break;
     }
 
+    if (noError)
+    {
+        strstr << "_no_error";
+    }
+
     return strstr.str();
 }
 
@@ -158,6 +167,8 @@ DrawCallPerfBenchmark::DrawCallPerfBenchmark() : ANGLERenderTest("DrawCallPerf",
     {
         skipTest("https://issuetracker.google.com/issues/298407224 Fails on Pixel 6 GLES");
     }
+
+    setNoErrorEnabled(params.noError);
 }
 
 void DrawCallPerfBenchmark::initializeBenchmark()
@@ -654,10 +665,27 @@ DrawArraysPerfParams CombineStateChange(const DrawArraysPerfParams &in, StateCha
     return out;
 }
 
+DrawArraysPerfParams NoError(const DrawArraysPerfParams &in)
+{
+    DrawArraysPerfParams out = in;
+    out.noError              = true;
+    return out;
+}
+
 using P = DrawArraysPerfParams;
 
-std::vector<P> gTestsWithStateChange =
-    CombineWithValues({P()}, angle::AllEnums<StateChange>(), CombineStateChange);
+std::vector<P> GetTestsWithStateChange()
+{
+    std::vector<P> tests =
+        CombineWithValues({P()}, angle::AllEnums<StateChange>(), CombineStateChange);
+
+    // Validation overhead is measured without state changes, which keeps the back-end work
+    // minimal.
+    tests.push_back(NoError(P()));
+    return tests;
+}
+
+std::vector<P> gTestsWithStateChange = GetTestsWithStateChange();
 std::vector<P> gTestsWithRenderer =
     CombineWithFuncs(gTestsWithStateChange, {D3D11<P>, GL<P>, Metal<P>, Vulkan<P>, WGL<P>});
 std::vector<P> gTestsWithDevice =
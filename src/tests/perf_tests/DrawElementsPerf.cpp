@@ -7,6 +7,7 @@
 //   Performance tests for ANGLE DrawElements call overhead.
 //
 
+#include <algorithm>
 #include <sstream>
 
 #include "ANGLEPerfTest.h"
@@ -15,6 +16,10 @@
 
 namespace
 {
+// Number of separately drawn index ranges sharing one index buffer in the partial update tests.
+constexpr int kPartialUpdateRangeCount = 256;
+// Number of indices updated per draw in the large draw partial update tests.
+constexpr int kLargeDrawUpdateCount = 64;
 
 GLuint CreateElementArrayBuffer(size_t count, GLenum type, GLenum usage)
 {
@@ -46,6 +51,21 @@ struct DrawElementsPerfParams final : public DrawCallPerfParams
             strstr << "_index_buffer_changed";
         }
 
+        if (indexBufferPartialUpdate)
+        {
+            strstr << "_index_buffer_partial_update";
+        }
+
+        if (largeDrawPartialUpdate)
+        {
+            strstr << "_large_draw_partial_update";
+        }
+
+        if (consecutiveRanges)
+        {
+            strstr << "_consecutive_ranges";
+        }
+
         if (type == GL_UNSIGNED_SHORT)
         {
             strstr << "_ushort";
@@ -56,6 +76,15 @@ struct DrawElementsPerfParams final : public DrawCallPerfParams
 
     GLenum type             = GL_UNSIGNED_INT;
     bool indexBufferChanged = false;
+    // Draw many ranges of one large index buffer while updating a small part of it with
+    // glBufferSubData between draws.
+    bool indexBufferPartialUpdate = false;
+    // Draw one large index buffer while updating a few of its indices with glBufferSubData
+    // between draws, like streamed dynamic geometry.
+    bool largeDrawPartialUpdate = false;
+    // Draw the ranges of one large index buffer one after the other, like a batch of meshes that
+    // share an index buffer.
+    bool consecutiveRanges = false;
 };
 
 std::ostream &operator<<(std::ostream &os, const DrawElementsPerfParams &params)
@@ -119,10 +148,14 @@ void DrawElementsPerfBenchmark::initializeBenchmark()
 
     glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
 
+    const int rangeCount = params.indexBufferPartialUpdate || params.consecutiveRanges
+                               ? kPartialUpdateRangeCount
+                               : 1;
+
     mBuffer      = Create2DTriangleBuffer(params.numTris, GL_STATIC_DRAW);
-    mIndexBuffer = CreateElementArrayBuffer(mCount, params.type, GL_STATIC_DRAW);
+    mIndexBuffer = CreateElementArrayBuffer(mCount * rangeCount, params.type, GL_STATIC_DRAW);
 
-    for (int i = 0; i < mCount; i++)
+    for (int i = 0; i < mCount * rangeCount; i++)
     {
         ASSERT_GE(std::numeric_limits<GLushort>::max(), mCount);
         mShortIndexData.push_back(static_cast<GLushort>(rand() % mCount));
@@ -131,7 +164,7 @@ void DrawElementsPerfBenchmark::initializeBenchmark()
 
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mIndexBuffer);
 
-    mBufferSize = ElementTypeSize(params.type) * mCount;
+    mBufferSize = ElementTypeSize(params.type) * mCount * rangeCount;
 
     if (params.type == GL_UNSIGNED_INT)
     {
@@ -191,6 +224,58 @@ void DrawElementsPerfBenchmark::drawBenchmark()
             glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(mCount), params.type, 0);
         }
     }
+    else if (params.indexBufferPartialUpdate)
+    {
+        const GLsizei rangeSize = ElementTypeSize(params.type) * mCount;
+        const uint8_t *bufferData =
+            (params.type == GL_UNSIGNED_INT)
+                ? reinterpret_cast<const uint8_t *>(mIntIndexData.data())
+                : reinterpret_cast<const uint8_t *>(mShortIndexData.data());
+        for (unsigned int it = 0; it < params.iterationsPerStep; it++)
+        {
+            // Update one range and draw every range, so that all but one cached index range
+            // remain valid.
+            GLintptr updateOffset = (it % kPartialUpdateRangeCount) * rangeSize;
+            glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, updateOffset, rangeSize,
+                            bufferData + updateOffset);
+            for (int range = 0; range < kPartialUpdateRangeCount; range++)
+            {
+                glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(mCount), params.type,
+                               reinterpret_cast<const void *>(
+                                   static_cast<uintptr_t>(range * rangeSize)));
+            }
+        }
+    }
+    else if (params.consecutiveRanges)
+    {
+        const GLsizei rangeSize = ElementTypeSize(params.type) * mCount;
+        for (unsigned int it = 0; it < params.iterationsPerStep; it++)
+        {
+            for (int range = 0; range < kPartialUpdateRangeCount; range++)
+            {
+                glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(mCount), params.type,
+                               reinterpret_cast<const void *>(
+                                   static_cast<uintptr_t>(range * rangeSize)));
+            }
+        }
+    }
+    else if (params.largeDrawPartialUpdate)
+    {
+        const uint8_t *bufferData =
+            (params.type == GL_UNSIGNED_INT)
+                ? reinterpret_cast<const uint8_t *>(mIntIndexData.data())
+                : reinterpret_cast<const uint8_t *>(mShortIndexData.data());
+
+        const GLsizei updateSize  = ElementTypeSize(params.type) * kLargeDrawUpdateCount;
+        const GLsizei updateSlots = mBufferSize / updateSize;
+        for (unsigned int it = 0; it < params.iterationsPerStep; it++)
+        {
+            GLintptr updateOffset = (it % updateSlots) * updateSize;
+            glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, updateOffset, updateSize,
+                            bufferData + updateOffset);
+            glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(mCount), params.type, 0);
+        }
+    }
     else
     {
         for (unsigned int it = 0; it < params.iterationsPerStep; it++)
@@ -230,12 +315,48 @@ P CombineIndexBufferChanged(const P &in, bool indexBufferChanged)
     return out;
 }
 
+P CombineIndexBufferPartialUpdate(const P &in)
+{
+    P out                        = in;
+    out.indexBufferPartialUpdate = true;
+    out.iterationsPerStep        = std::max(1u, out.iterationsPerStep / kPartialUpdateRangeCount);
+    return out;
+}
+
+P CombineLargeDrawPartialUpdate(const P &in)
+{
+    P out                      = in;
+    out.largeDrawPartialUpdate = true;
+    out.numTris                = 20000;
+    out.iterationsPerStep /= 100;
+    return out;
+}
+
+P CombineConsecutiveRanges(const P &in)
+{
+    P out                 = in;
+    out.consecutiveRanges = true;
+    out.iterationsPerStep = std::max(1u, out.iterationsPerStep / kPartialUpdateRangeCount);
+    return out;
+}
+
+std::vector<P> CombineIndexBufferUpdates(const std::vector<P> &in)
+{
+    std::vector<P> out = CombineWithValues(in, {false, true}, CombineIndexBufferChanged);
+    for (const P &params : in)
+    {
+        out.push_back(CombineIndexBufferPartialUpdate(params));
+        out.push_back(CombineLargeDrawPartialUpdate(params));
+        out.push_back(CombineConsecutiveRanges(params));
+    }
+    return out;
+}
+
 std::vector<GLenum> gIndexTypes = {GL_UNSIGNED_INT, GL_UNSIGNED_SHORT};
 std::vector<P> gWithIndexType   = CombineWithValues({P()}, gIndexTypes, CombineIndexType);
 std::vector<P> gWithRenderer =
     CombineWithFuncs(gWithIndexType, {D3D11<P>, GL<P>, Metal<P>, Vulkan<P>, WGL<P>});
-std::vector<P> gWithChange =
-    CombineWithValues(gWithRenderer, {false, true}, CombineIndexBufferChanged);
+std::vector<P> gWithChange = CombineIndexBufferUpdates(gWithRenderer);
 std::vector<P> gWithDevice = CombineWithFuncs(gWithChange, {Passthrough<P>, NullDevice<P>});
 
 ANGLE_INSTANTIATE_TEST_ARRAY(DrawElementsPerfBenchmark, gWithDevice);
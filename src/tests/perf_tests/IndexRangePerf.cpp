@@ -0,0 +1,214 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// IndexRangePerf:
+//   Performance test for the CPU index range scan done by gl::ComputeIndexRange.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include "common/utilities.h"
+#include "libANGLE/IndexRangeCache.h"
+#include "libANGLE/formatutils.h"
+
+#include <sstream>
+
+using namespace testing;
+
+namespace
+{
+// Large enough to not fit in L1/L2, like a streamed index buffer.
+constexpr size_t kIndexDataSize    = 4 * 1024 * 1024;
+constexpr unsigned int kIterations = 4;
+
+struct IndexRangePerfParams
+{
+    gl::DrawElementsType type;
+    bool primitiveRestart;
+};
+
+std::ostream &operator<<(std::ostream &os, const IndexRangePerfParams &params)
+{
+    switch (params.type)
+    {
+        case gl::DrawElementsType::UnsignedByte:
+            os << "u8";
+            break;
+        case gl::DrawElementsType::UnsignedShort:
+            os << "u16";
+            break;
+        default:
+            os << "u32";
+            break;
+    }
+    if (params.primitiveRestart)
+    {
+        os << "_restart";
+    }
+    return os;
+}
+
+class IndexRangePerfTest : public ANGLEPerfTest, public WithParamInterface<IndexRangePerfParams>
+{
+  public:
+    IndexRangePerfTest();
+
+    void step() override;
+
+    void reportThroughput();
+
+  private:
+    static std::string GetName();
+
+    std::vector<uint8_t> mIndexData;
+    size_t mIndexCount;
+    GLuint mRestartIndex;
+};
+
+IndexRangePerfTest::IndexRangePerfTest()
+    : ANGLEPerfTest(GetName(), "", "_run", kIterations, "us"), mIndexData(kIndexDataSize)
+{
+    const IndexRangePerfParams &params = GetParam();
+    const size_t indexSize             = gl::GetDrawElementsTypeSize(params.type);
+    mIndexCount                        = kIndexDataSize / indexSize;
+
+    // Fill the buffer with a repeating pattern of small indices, sprinkled with restart indices
+    // so that the restart mask has to do real work.
+    mRestartIndex = gl::GetPrimitiveRestartIndex(params.type);
+    for (size_t i = 0; i < mIndexCount; ++i)
+    {
+        GLuint index = (i % 64 == 63) ? mRestartIndex : static_cast<GLuint>(i % 200);
+        memcpy(mIndexData.data() + i * indexSize, &index, indexSize);
+    }
+
+    mReporter->RegisterImportantMetric(".throughput", "GB/s");
+}
+
+std::string IndexRangePerfTest::GetName()
+{
+    std::stringstream ss;
+    ss << UnitTest::GetInstance()->current_test_suite()->name() << "/" << GetParam();
+    return ss.str();
+}
+
+void IndexRangePerfTest::step()
+{
+    const IndexRangePerfParams &params = GetParam();
+
+    for (unsigned int iteration = 0; iteration < kIterations; ++iteration)
+    {
+        gl::IndexRange range = gl::ComputeIndexRange(params.type, mIndexData.data(), mIndexCount,
+                                                     params.primitiveRestart);
+        ASSERT_EQ(gl::IndexRange(0, params.primitiveRestart ? 199 : mRestartIndex), range);
+    }
+}
+
+void IndexRangePerfTest::reportThroughput()
+{
+    if (mTrialNumStepsPerformed == 0)
+    {
+        return;
+    }
+
+    const double bytesScanned =
+        static_cast<double>(kIndexDataSize) * kIterations * mTrialNumStepsPerformed;
+    const double seconds = mTrialTimer.getElapsedWallClockTime();
+    recordDoubleMetric(".throughput", bytesScanned / seconds / 1e9, "GB/s");
+}
+
+// Measures the speed of scanning index data for the min/max range.
+TEST_P(IndexRangePerfTest, Run)
+{
+    run();
+    reportThroughput();
+}
+
+INSTANTIATE_TEST_SUITE_P(,
+                         IndexRangePerfTest,
+                         Values(IndexRangePerfParams{gl::DrawElementsType::UnsignedByte, false},
+                                IndexRangePerfParams{gl::DrawElementsType::UnsignedByte, true},
+                                IndexRangePerfParams{gl::DrawElementsType::UnsignedShort, false},
+                                IndexRangePerfParams{gl::DrawElementsType::UnsignedShort, true},
+                                IndexRangePerfParams{gl::DrawElementsType::UnsignedInt, false},
+                                IndexRangePerfParams{gl::DrawElementsType::UnsignedInt, true}),
+                         PrintToStringParamName());
+
+// Measures gl::IndexRangeCache when many ranges of one index buffer are drawn and one of them is
+// updated between draws, and reports the hits, misses and evictions of the cache.  The parameter
+// is the number of ranges, which exceeds the cache size in the second instantiation.
+class IndexRangeCachePerfTest : public ANGLEPerfTest, public WithParamInterface<size_t>
+{
+  public:
+    IndexRangeCachePerfTest();
+
+    void step() override;
+
+    void reportStats();
+
+  private:
+    static constexpr size_t kRangeIndexCount = 1024;
+
+    std::vector<GLushort> mIndexData;
+    gl::IndexRangeCache mCache;
+    size_t mNextUpdatedRange = 0;
+};
+
+IndexRangeCachePerfTest::IndexRangeCachePerfTest()
+    : ANGLEPerfTest("IndexRangeCachePerf", "", "_" + std::to_string(GetParam()), 1, "us"),
+      mIndexData(GetParam() * kRangeIndexCount)
+{
+    for (size_t i = 0; i < mIndexData.size(); ++i)
+    {
+        mIndexData[i] = static_cast<GLushort>(i % 200);
+    }
+}
+
+void IndexRangeCachePerfTest::step()
+{
+    constexpr size_t kRangeSize = kRangeIndexCount * sizeof(GLushort);
+
+    mCache.invalidateRange(mNextUpdatedRange * kRangeSize, kRangeSize);
+    mNextUpdatedRange = (mNextUpdatedRange + 1) % GetParam();
+
+    for (size_t range = 0; range < GetParam(); ++range)
+    {
+        const size_t offset = range * kRangeSize;
+        gl::IndexRange indexRange;
+        if (!mCache.findRange(gl::DrawElementsType::UnsignedShort, offset, kRangeIndexCount,
+                              false, &indexRange))
+        {
+            indexRange =
+                gl::ComputeIndexRange(gl::DrawElementsType::UnsignedShort,
+                                      mIndexData.data() + range * kRangeIndexCount,
+                                      kRangeIndexCount, false);
+            mCache.addRange(gl::DrawElementsType::UnsignedShort, offset, kRangeIndexCount, false,
+                            indexRange);
+        }
+    }
+}
+
+void IndexRangeCachePerfTest::reportStats()
+{
+    const gl::IndexRangeCacheStats &stats = mCache.getStats();
+    recordIntegerMetric(".cache_hits", static_cast<size_t>(stats.hits), "count");
+    recordIntegerMetric(".cache_misses", static_cast<size_t>(stats.misses), "count");
+    recordIntegerMetric(".cache_evictions", static_cast<size_t>(stats.evictions), "count");
+    recordIntegerMetric(".cache_invalidation_visits",
+                        static_cast<size_t>(stats.invalidationVisits), "count");
+}
+
+TEST_P(IndexRangeCachePerfTest, Run)
+{
+    run();
+    reportStats();
+}
+
+INSTANTIATE_TEST_SUITE_P(,
+                         IndexRangeCachePerfTest,
+                         Values(gl::IndexRangeCache::kDefaultMaxEntries / 2,
+                                gl::IndexRangeCache::kDefaultMaxEntries * 2),
+                         PrintToStringParamName());
+
+}  // anonymous namespace
@@ -73,6 +73,22 @@ struct ParallelLinkProgramParams final : public RenderTestParams
             strstr << "_serial";
         }
 
+        if (std::find(eglParameters.enabledFeatureOverrides.begin(),
+                      eglParameters.enabledFeatureOverrides.end(),
+                      Feature::MergeProgramPipelineCachesToGlobalCache) !=
+            eglParameters.enabledFeatureOverrides.end())
+        {
+            strstr << "_merged_pipeline_cache";
+        }
+
+        if (std::find(eglParameters.enabledFeatureOverrides.begin(),
+                      eglParameters.enabledFeatureOverrides.end(),
+                      Feature::ShardGlobalPipelineCache) !=
+            eglParameters.enabledFeatureOverrides.end())
+        {
+            strstr << "_sharded_pipeline_cache";
+        }
+
         if (eglParameters.deviceType == EGL_PLATFORM_ANGLE_DEVICE_TYPE_NULL_ANGLE)
         {
             strstr << "_null";
@@ -325,6 +341,23 @@ ParallelLinkProgramParams ParallelLinkProgramVulkanParams(CompileLinkOrder compi
     return params;
 }
 
+// Links in parallel, merging the programs' pipeline caches into the global pipeline cache.  Without
+// sharding, all merges contend on a single lock.
+ParallelLinkProgramParams ParallelLinkProgramVulkanMergedCacheParams(
+    CompileLinkOrder compileLinkOrder,
+    bool shardGlobalPipelineCache)
+{
+    ParallelLinkProgramParams params(compileLinkOrder);
+    params.eglParameters = VULKAN();
+    params.enable(Feature::EnableParallelCompileAndLink);
+    params.enable(Feature::MergeProgramPipelineCachesToGlobalCache);
+    if (shardGlobalPipelineCache)
+    {
+        params.enable(Feature::ShardGlobalPipelineCache);
+    }
+    return params;
+}
+
 ParallelLinkProgramParams SerialLinkProgramVulkanParams(CompileLinkOrder compileLinkOrder)
 {
     ParallelLinkProgramParams params(compileLinkOrder);
@@ -350,6 +383,10 @@ ANGLE_INSTANTIATE_TEST(
     ParallelLinkProgramVulkanParams(CompileLinkOrder::AllCompilesFirst),
     ParallelLinkProgramVulkanParams(CompileLinkOrder::Interleaved),
     ParallelLinkProgramVulkanParams(CompileLinkOrder::InterleavedAndImmediateQuery),
+    ParallelLinkProgramVulkanMergedCacheParams(CompileLinkOrder::AllCompilesFirst, false),
+    ParallelLinkProgramVulkanMergedCacheParams(CompileLinkOrder::Interleaved, false),
+    ParallelLinkProgramVulkanMergedCacheParams(CompileLinkOrder::AllCompilesFirst, true),
+    ParallelLinkProgramVulkanMergedCacheParams(CompileLinkOrder::Interleaved, true),
     SerialLinkProgramVulkanParams(CompileLinkOrder::AllCompilesFirst),
     SerialLinkProgramVulkanParams(CompileLinkOrder::Interleaved),
     SerialLinkProgramVulkanParams(CompileLinkOrder::InterleavedAndImmediateQuery));
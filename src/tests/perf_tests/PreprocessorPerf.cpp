@@ -0,0 +1,130 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// PreprocessorPerf:
+//   Performance test for the shader preprocessor.  Each step runs a generated shader that is
+//   dominated by macro definitions, conditionals and macro invocations through the preprocessor,
+//   as is typical of shaders assembled from "uber-shader" sources.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <sstream>
+
+#include "compiler/preprocessor/DiagnosticsBase.h"
+#include "compiler/preprocessor/DirectiveHandlerBase.h"
+#include "compiler/preprocessor/Preprocessor.h"
+#include "compiler/preprocessor/Token.h"
+
+using namespace angle;
+
+namespace
+{
+constexpr unsigned int kFeatureCount = 2000;
+
+class NullDiagnostics : public pp::Diagnostics
+{
+  protected:
+    void print(ID id, const pp::SourceLocation &loc, const std::string &text) override {}
+};
+
+class NullDirectiveHandler : public pp::DirectiveHandler
+{
+  public:
+    void handleError(const pp::SourceLocation &loc, const std::string &msg) override {}
+    void handlePragma(const pp::SourceLocation &loc,
+                      const std::string &name,
+                      const std::string &value,
+                      bool stdgl) override
+    {}
+    void handleExtension(const pp::SourceLocation &loc,
+                         const std::string &name,
+                         const std::string &behavior) override
+    {}
+    void handleVersion(const pp::SourceLocation &loc,
+                       int version,
+                       ShShaderSpec spec,
+                       pp::MacroSet *macroSet) override
+    {}
+};
+
+std::string GenerateMacroHeavyShader(unsigned int featureCount)
+{
+    std::stringstream shader;
+    shader << "#version 300 es\n"
+              "precision highp float;\n";
+    for (unsigned int i = 0; i < featureCount; ++i)
+    {
+        shader << "#define FEATURE_CONSTANT_" << i << " " << i << "\n";
+        shader << "#define FEATURE_SCALE_" << i << "(x, y) ((x) * float(FEATURE_CONSTANT_" << i
+               << ") + (y))\n";
+    }
+    shader << "out vec4 color;\n"
+              "uniform vec4 u;\n"
+              "void main()\n"
+              "{\n"
+              "    vec4 c = u;\n";
+    for (unsigned int i = 0; i < featureCount; ++i)
+    {
+        shader << "#if defined(FEATURE_CONSTANT_" << i << ") && FEATURE_CONSTANT_" << i
+               << " % 3 == 0\n";
+        shader << "    c = FEATURE_SCALE_" << i << "(c, vec4(FEATURE_CONSTANT_" << i
+               << ")) + FEATURE_SCALE_" << (i / 2) << "(c.yzwx, c);\n";
+        shader << "#endif\n";
+    }
+    shader << "    color = c;\n"
+              "}\n";
+    return shader.str();
+}
+
+class PreprocessorPerfTest : public ANGLEPerfTest
+{
+  public:
+    PreprocessorPerfTest();
+
+    void SetUp() override;
+    void step() override;
+
+  private:
+    std::string mShader;
+    NullDiagnostics mDiagnostics;
+    NullDirectiveHandler mDirectiveHandler;
+};
+
+PreprocessorPerfTest::PreprocessorPerfTest()
+    : ANGLEPerfTest("PreprocessorPerf", "", "_macro_heavy", 1)
+{}
+
+void PreprocessorPerfTest::SetUp()
+{
+    ANGLEPerfTest::SetUp();
+    mShader = GenerateMacroHeavyShader(kFeatureCount);
+}
+
+void PreprocessorPerfTest::step()
+{
+    const char *shaderStrings[] = {mShader.c_str()};
+
+    pp::Preprocessor preprocessor(&mDiagnostics, &mDirectiveHandler,
+                                  pp::PreprocessorSettings(SH_GLES3_SPEC));
+    if (!preprocessor.init(1, shaderStrings, nullptr))
+    {
+        abortTest();
+        FAIL() << "Initializing the preprocessor failed";
+    }
+
+    pp::Token token;
+    do
+    {
+        preprocessor.lex(&token);
+    } while (token.type != pp::Token::LAST);
+}
+
+// Measures preprocessing a shader made mostly of macros.
+TEST_F(PreprocessorPerfTest, Run)
+{
+    run();
+}
+}  // anonymous namespace
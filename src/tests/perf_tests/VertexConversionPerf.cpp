@@ -0,0 +1,155 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// VertexConversionPerf:
+//   Performance test for the CPU vertex format conversion functions used by the back-ends when a
+//   vertex format is not natively supported.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include "libANGLE/renderer/copyvertex.h"
+
+#include <sstream>
+
+using namespace testing;
+
+namespace
+{
+constexpr size_t kVertexCount      = 256 * 1024;
+constexpr unsigned int kIterations = 4;
+
+struct VertexConversionPerfParams
+{
+    const char *name;
+    rx::VertexCopyFunction copyFunction;
+    size_t inputSize;
+    size_t stride;
+    size_t outputSize;
+};
+
+std::ostream &operator<<(std::ostream &os, const VertexConversionPerfParams &params)
+{
+    os << params.name;
+    if (params.stride != params.inputSize)
+    {
+        os << "_interleaved";
+    }
+    return os;
+}
+
+class VertexConversionPerfTest : public ANGLEPerfTest,
+                                 public WithParamInterface<VertexConversionPerfParams>
+{
+  public:
+    VertexConversionPerfTest();
+
+    void step() override;
+
+    void reportThroughput();
+
+  private:
+    static std::string GetName();
+
+    std::vector<uint8_t> mInput;
+    std::vector<uint8_t> mOutput;
+};
+
+VertexConversionPerfTest::VertexConversionPerfTest()
+    : ANGLEPerfTest(GetName(), "", "_run", kIterations, "us"),
+      mInput(kVertexCount * GetParam().stride),
+      mOutput(kVertexCount * GetParam().outputSize)
+{
+    for (size_t i = 0; i < mInput.size(); ++i)
+    {
+        mInput[i] = static_cast<uint8_t>(i * 37);
+    }
+
+    mReporter->RegisterImportantMetric(".throughput", "GB/s");
+}
+
+std::string VertexConversionPerfTest::GetName()
+{
+    std::stringstream ss;
+    ss << UnitTest::GetInstance()->current_test_suite()->name() << "/" << GetParam();
+    return ss.str();
+}
+
+void VertexConversionPerfTest::step()
+{
+    const VertexConversionPerfParams &params = GetParam();
+
+    for (unsigned int iteration = 0; iteration < kIterations; ++iteration)
+    {
+        params.copyFunction(mInput.data(), params.stride, kVertexCount, mOutput.data());
+    }
+}
+
+void VertexConversionPerfTest::reportThroughput()
+{
+    if (mTrialNumStepsPerformed == 0)
+    {
+        return;
+    }
+
+    // Count the bytes of vertex data read, excluding the other attributes of interleaved vertices.
+    const double bytesConverted = static_cast<double>(kVertexCount) * GetParam().inputSize *
+                                  kIterations * mTrialNumStepsPerformed;
+    const double seconds = mTrialTimer.getElapsedWallClockTime();
+    recordDoubleMetric(".throughput", bytesConverted / seconds / 1e9, "GB/s");
+}
+
+// Measures the speed of converting vertex data from one format to another.
+TEST_P(VertexConversionPerfTest, Run)
+{
+    run();
+    reportThroughput();
+}
+
+VertexConversionPerfParams MakeParams(const char *name,
+                                      rx::VertexCopyFunction copyFunction,
+                                      size_t inputSize,
+                                      size_t outputSize,
+                                      bool interleaved)
+{
+    // Interleaved vertices are padded with another 16 bytes of attributes.
+    return {name, copyFunction, inputSize, interleaved ? inputSize + 16 : inputSize, outputSize};
+}
+
+std::vector<VertexConversionPerfParams> GetVertexConversionPerfParams()
+{
+    std::vector<VertexConversionPerfParams> params;
+    for (bool interleaved : {false, true})
+    {
+        params.push_back(MakeParams("s8x3_norm_to_f32x4",
+                                    rx::CopyToFloatVertexData<GLbyte, 3, 4, true, false>, 3, 16,
+                                    interleaved));
+        params.push_back(MakeParams("u8x4_norm_to_f32x4",
+                                    rx::CopyToFloatVertexData<GLubyte, 4, 4, true, false>, 4, 16,
+                                    interleaved));
+        params.push_back(MakeParams("u8x3_to_f16x4",
+                                    rx::CopyToFloatVertexData<GLubyte, 3, 4, false, true>, 3, 8,
+                                    interleaved));
+        params.push_back(MakeParams("s16x2_norm_to_f32x2",
+                                    rx::CopyToFloatVertexData<GLshort, 2, 2, true, false>, 4, 8,
+                                    interleaved));
+        params.push_back(MakeParams("s16x3_norm_to_f32x4",
+                                    rx::CopyToFloatVertexData<GLshort, 3, 4, true, false>, 6, 16,
+                                    interleaved));
+        params.push_back(MakeParams("u16x3_to_f32x3",
+                                    rx::CopyToFloatVertexData<GLushort, 3, 3, false, false>, 6, 12,
+                                    interleaved));
+        params.push_back(MakeParams("fixedx3_to_f32x3", rx::Copy32FixedTo32FVertexData<3, 3>, 12,
+                                    12, interleaved));
+    }
+    return params;
+}
+
+INSTANTIATE_TEST_SUITE_P(,
+                         VertexConversionPerfTest,
+                         ValuesIn(GetVertexConversionPerfParams()),
+                         PrintToStringParamName());
+
+}  // anonymous namespace
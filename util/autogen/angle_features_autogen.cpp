@@ -71,6 +71,7 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::ClearsWithGapsNeedFlush, "clearsWithGapsNeedFlush"},
     {Feature::ClearToZeroOrOneBroken, "clearToZeroOrOneBroken"},
     {Feature::ClipSrcRegionForBlitFramebuffer, "clipSrcRegionForBlitFramebuffer"},
+    {Feature::CoalesceConsecutiveIndexedDraws, "coalesceConsecutiveIndexedDraws"},
     {Feature::CompileJobIsThreadSafe, "compileJobIsThreadSafe"},
     {Feature::CompressVertexData, "compressVertexData"},
     {Feature::CopyIOSurfaceToNonIOSurfaceForReadOptimization, "copyIOSurfaceToNonIOSurfaceForReadOptimization"},
@@ -150,6 +151,7 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::EnableMergeClientAttribBuffer, "enableMergeClientAttribBuffer"},
     {Feature::EnableMultisampledRenderToTexture, "enableMultisampledRenderToTexture"},
     {Feature::EnableMultisampledRenderToTextureOnNonTilers, "enableMultisampledRenderToTextureOnNonTilers"},
+    {Feature::EnableParallelClientAttribStreaming, "enableParallelClientAttribStreaming"},
     {Feature::EnableParallelCompileAndLink, "enableParallelCompileAndLink"},
     {Feature::EnableParallelMtlLibraryCompilation, "enableParallelMtlLibraryCompilation"},
     {Feature::EnablePipelineCacheDataCompression, "enablePipelineCacheDataCompression"},
@@ -229,6 +231,7 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::LogMemoryReportStats, "logMemoryReportStats"},
     {Feature::LoseContextOnOutOfMemory, "loseContextOnOutOfMemory"},
     {Feature::MapUnspecifiedColorSpaceToPassThrough, "mapUnspecifiedColorSpaceToPassThrough"},
+    {Feature::MemoizeCompileResults, "memoizeCompileResults"},
     {Feature::MergeProgramPipelineCachesToGlobalCache, "mergeProgramPipelineCachesToGlobalCache"},
     {Feature::MrtPerfWorkaround, "mrtPerfWorkaround"},
     {Feature::MultisampleColorFormatShaderReadWorkaround, "multisampleColorFormatShaderReadWorkaround"},
@@ -286,6 +289,7 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::SetDataFasterThanImageUpload, "setDataFasterThanImageUpload"},
     {Feature::SetPrimitiveRestartFixedIndexForDrawArrays, "setPrimitiveRestartFixedIndexForDrawArrays"},
     {Feature::SetZeroLevelBeforeGenerateMipmap, "setZeroLevelBeforeGenerateMipmap"},
+    {Feature::ShardGlobalPipelineCache, "shardGlobalPipelineCache"},
     {Feature::ShiftInstancedArrayDataWithOffset, "shiftInstancedArrayDataWithOffset"},
     {Feature::SingleThreadedTextureDecompression, "singleThreadedTextureDecompression"},
     {Feature::SkipPipelineCacheSerialization, "skipPipelineCacheSerialization"},
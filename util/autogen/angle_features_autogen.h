@@ -71,6 +71,7 @@ enum class Feature
     ClearsWithGapsNeedFlush,
     ClearToZeroOrOneBroken,
     ClipSrcRegionForBlitFramebuffer,
+    CoalesceConsecutiveIndexedDraws,
     CompileJobIsThreadSafe,
     CompressVertexData,
     CopyIOSurfaceToNonIOSurfaceForReadOptimization,
@@ -150,6 +151,7 @@ enum class Feature
     EnableMergeClientAttribBuffer,
     EnableMultisampledRenderToTexture,
     EnableMultisampledRenderToTextureOnNonTilers,
+    EnableParallelClientAttribStreaming,
     EnableParallelCompileAndLink,
     EnableParallelMtlLibraryCompilation,
     EnablePipelineCacheDataCompression,
@@ -229,6 +231,7 @@ enum class Feature
     LogMemoryReportStats,
     LoseContextOnOutOfMemory,
     MapUnspecifiedColorSpaceToPassThrough,
+    MemoizeCompileResults,
     MergeProgramPipelineCachesToGlobalCache,
     MrtPerfWorkaround,
     MultisampleColorFormatShaderReadWorkaround,
@@ -286,6 +289,7 @@ enum class Feature
     SetDataFasterThanImageUpload,
     SetPrimitiveRestartFixedIndexForDrawArrays,
     SetZeroLevelBeforeGenerateMipmap,
+    ShardGlobalPipelineCache,
     ShiftInstancedArrayDataWithOffset,
     SingleThreadedTextureDecompression,
     SkipPipelineCacheSerialization,